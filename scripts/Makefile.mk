@@ -48,6 +48,7 @@ EXTRA_DIST += scripts/geopmpy/analysis.py \
               scripts/MANIFEST.in \
               scripts/test/TestAffinity.py \
               scripts/test/TestAnalysis.py \
+              scripts/test/TestIO.py \
               scripts/test/TestSubsetOptionParser.py \
               scripts/test/geopm_context.py \
               scripts/test/__init__.py \
@@ -71,6 +72,10 @@ PYTEST_TESTS = scripts/test/pytest_links/TestAffinity.test_affinity_0 \
                scripts/test/pytest_links/TestAnalysis.test_offline_baseline_comparison_report \
                scripts/test/pytest_links/TestAnalysis.test_online_baseline_comparison_report \
                scripts/test/pytest_links/TestAnalysis.test_stream_dgemm_mix_report \
+               scripts/test/pytest_links/TestIO.test_trace_chunked \
+               scripts/test/pytest_links/TestIO.test_trace_filter \
+               scripts/test/pytest_links/TestIO.test_trace_cache \
+               scripts/test/pytest_links/TestIO.test_trace_cache_path \
                scripts/test/pytest_links/TestSubsetOptionParser.test_all_param_unknown \
                scripts/test/pytest_links/TestSubsetOptionParser.test_some_param_known \
                scripts/test/pytest_links/TestSubsetOptionParser.test_geopm_srun_mix_arg_overlap \
@@ -34,6 +34,7 @@ GEOPM IO - Helper module for parsing/processing report and trace files.
 """
 
 import os
+import hashlib
 import json
 import re
 import pandas
@@ -77,9 +78,15 @@ class AppOutput(object):
         trace_glob: The string pattern to use to search for trace files.
         dir_name: The directory path to use when searching for files.
         verbose: A bool to control whether verbose output is printed to stdout.
+        trace_columns: Optional list of trace column names to load.
+        trace_region_ids: Optional list of region IDs; only trace rows
+                          for these regions are loaded.
+        trace_cache_dir: Optional directory used to cache parsed traces
+                         in HDF5 format (see Trace).
 
     """
-    def __init__(self, reports=None, traces=None, dir_name='.', verbose=False):
+    def __init__(self, reports=None, traces=None, dir_name='.', verbose=False,
+                 trace_columns=None, trace_region_ids=None, trace_cache_dir=None):
         self._reports = {}
         self._reports_df = pandas.DataFrame()
         self._traces = {}
@@ -173,7 +180,8 @@ class AppOutput(object):
                     sys.stdout.write('\rParsing trace file {} of {} ({})... '.format(fileno, len(trace_paths), filesize))
                     sys.stdout.flush()
                 fileno += 1
-                tt = Trace(tp)
+                tt = Trace(tp, columns=trace_columns, region_ids=trace_region_ids,
+                           cache_dir=trace_cache_dir)
                 self._traces[tt.get_node_name()] = tt.get_df() # Basic dict assumes one node per trace
                 self.add_trace_df(tt) # Handles multiple traces per node
             if verbose:
@@ -803,15 +811,36 @@ class Trace(object):
     Using the raw object in a list and calling concat will cause an
     error.
 
+    The file is parsed chunksize rows at a time and the column and
+    region filters are applied to each chunk as it is read, so only
+    the selected data is ever held in memory.  When cache_dir is
+    given, the complete parsed trace is stored there in HDF5 format
+    (requires PyTables) and reused until the modification time of the
+    trace file changes.
+
     Attributes:
         trace_path: The path to the trace file to parse.
+        columns: Optional list of column names to load.  All columns
+                 are loaded by default.
+        region_ids: Optional list of region IDs (int or string) to
+                    keep.  All rows are kept by default.
+        chunksize: The number of rows parsed at a time.
+        cache_dir: Optional directory for the HDF5 cache.
 
     """
-    def __init__(self, trace_path, use_agent=False):
+    def __init__(self, trace_path, use_agent=False, columns=None, region_ids=None,
+                 chunksize=100000, cache_dir=None):
         self._path = trace_path
-        self._df = pandas.read_csv(trace_path, sep='|', comment='#', dtype={'region_id': str})  # region_id must be a string because pandas can't handle 64-bit integers
-        self._df.columns = list(map(str.strip, self._df[:0]))  # Strip whitespace from column names
-        self._df['region_id'] = self._df['region_id'].astype(str).map(str.strip)  # Strip whitespace from region ID's
+        if cache_dir is None:
+            # Chunks are already filtered, concatenate them once so
+            # the rows are not copied again for every chunk
+            chunk_list = list(Trace.iter_df(trace_path, columns, region_ids, chunksize))
+            if chunk_list:
+                self._df = pandas.concat(chunk_list, ignore_index=True)
+            else:
+                self._df = pandas.DataFrame(columns=columns)
+        else:
+            self._df = Trace._read_cache_df(trace_path, columns, region_ids, chunksize, cache_dir)
         self._version = None
         self._profile_name = None
         self._power_budget = None
@@ -856,6 +885,116 @@ class Trace(object):
         """
         return self._df.__getitem__(key)
 
+    @staticmethod
+    def iter_df(trace_path, columns=None, region_ids=None, chunksize=100000):
+        """Parses a trace file one chunk of rows at a time.
+
+        Args:
+            trace_path: The path to the trace file to parse.
+            columns: Optional list of column names to load.
+            region_ids: Optional list of region IDs to keep.
+            chunksize: The number of rows parsed at a time.
+
+        Yields:
+            pandas.DataFrame: The selected columns of the selected
+                rows in each chunk.
+        """
+        usecols = None
+        if columns is not None:
+            usecols_set = set(columns)
+            if region_ids is not None:
+                usecols_set.add('region_id')
+            usecols = lambda name: name.strip() in usecols_set
+        # region_id must be a string because pandas can't handle 64-bit integers
+        reader = pandas.read_csv(trace_path, sep='|', comment='#', dtype={'region_id': str},
+                                 usecols=usecols, chunksize=chunksize)
+        for chunk in reader:
+            chunk.columns = [name.strip() for name in chunk.columns]  # Strip whitespace from column names
+            yield Trace._filter_df(chunk, columns, region_ids)
+
+    @staticmethod
+    def _filter_df(df, columns, region_ids):
+        """Applies the column and region selection to a parsed chunk."""
+        if 'region_id' in df:
+            df['region_id'] = df['region_id'].astype(str).map(str.strip)  # Strip whitespace from region ID's
+        if region_ids is not None:
+            df = df[df['region_id'].isin(Trace._region_id_set(region_ids))]
+        if columns is not None:
+            df = df[list(columns)]
+        return df
+
+    @staticmethod
+    def _region_id_set(region_ids):
+        """Returns every spelling of the region IDs used in traces.
+
+        Current traces print region IDs as 0x prefixed 16 digit hex
+        while older traces print them in decimal.
+        """
+        result = set()
+        for rid in region_ids:
+            if type(rid) is str:
+                rid = int(rid.strip(), 0)
+            result.add('0x{:016x}'.format(rid))
+            result.add(str(rid))
+        return result
+
+    @staticmethod
+    def cache_path(trace_path, cache_dir):
+        """Returns the path of the HDF5 cache file for a trace.
+
+        The name includes a hash of the absolute trace path so that
+        traces with the same name in different directories do not
+        share a cache file.
+        """
+        abs_path = os.path.abspath(trace_path)
+        path_hash = hashlib.sha1(abs_path.encode()).hexdigest()[:16]
+        return os.path.join(cache_dir, '{}-{}.h5'.format(os.path.basename(abs_path), path_hash))
+
+    @staticmethod
+    def _read_cache_df(trace_path, columns, region_ids, chunksize, cache_dir):
+        """Reads the trace through the HDF5 cache, creating the cache
+        first if it is missing or older than the trace file.  Chunks
+        are written straight to the store and the selection is read
+        back as a single DataFrame.
+        """
+        cache_path = Trace.cache_path(trace_path, cache_dir)
+        abs_path = os.path.abspath(trace_path)
+        trace_mtime = os.stat(trace_path).st_mtime
+        is_valid = False
+        if os.path.exists(cache_path):
+            with pandas.HDFStore(cache_path, mode='r') as store:
+                if '/trace' in store.keys():
+                    attrs = store.get_storer('trace').attrs
+                    is_valid = (getattr(attrs, 'trace_path', None) == abs_path and
+                                getattr(attrs, 'trace_mtime', None) == trace_mtime)
+        if not is_valid:
+            with pandas.HDFStore(cache_path, mode='w') as store:
+                for chunk in Trace.iter_df(trace_path, chunksize=chunksize):
+                    # Column types must match across chunks: store
+                    # numbers as float and strings (region ID and hex
+                    # columns) with a fixed width.
+                    min_itemsize = {}
+                    for name in chunk.columns:
+                        if pandas.api.types.is_numeric_dtype(chunk[name]):
+                            chunk[name] = chunk[name].astype(numpy.float64)
+                        else:
+                            min_itemsize[name] = 20
+                    store.append('trace', chunk, data_columns=['region_id'],
+                                 min_itemsize=min_itemsize, index=False)
+                if '/trace' in store.keys():
+                    attrs = store.get_storer('trace').attrs
+                    attrs.trace_path = abs_path
+                    attrs.trace_mtime = trace_mtime
+        with pandas.HDFStore(cache_path, mode='r') as store:
+            if '/trace' not in store.keys():
+                return pandas.DataFrame(columns=columns)
+            where = None
+            if region_ids is not None:
+                region_id_list = list(Trace._region_id_set(region_ids))
+                where = 'region_id = region_id_list'
+            result = store.select('trace', where=where, columns=columns)
+        return result.reset_index(drop=True)
+
     def _parse_header(self, trace_path):
         """Parses the configuration header out of the top of the trace file.
 
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions
+#  are met:
+#
+#      * Redistributions of source code must retain the above copyright
+#        notice, this list of conditions and the following disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above copyright
+#        notice, this list of conditions and the following disclaimer in
+#        the documentation and/or other materials provided with the
+#        distribution.
+#
+#      * Neither the name of Intel Corporation nor the names of its
+#        contributors may be used to endorse or promote products derived
+#        from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+#  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+import os
+import tempfile
+import unittest
+try:
+    import pandas
+    import geopm_context
+    import geopmpy.io
+    g_skip_io_test = False
+    g_skip_io_ex = None
+except ImportError as ex:
+    g_skip_io_test = True
+    g_skip_io_ex = "Warning, trace parsing requires the pandas module to be installed: {}".format(ex)
+
+trace_header = ('# "geopm_version" : "0.5.0",\n'
+                '# "profile_name" : "io_test",\n'
+                '# "power_budget" : -1,\n'
+                '# "tree_decider" : "static_policy",\n'
+                '# "leaf_decider" : "power_governing",\n'
+                '# "node_name" : "mynode",\n'
+                '# "agent" : "monitor"\n'
+                'seconds|region_id|progress-0|runtime-0\n')
+region_a = 0x123
+region_b = 0x456
+num_row = 10
+
+
+class TestIO(unittest.TestCase):
+    def setUp(self):
+        if g_skip_io_test:
+            self.skipTest(g_skip_io_ex)
+        self._tmp_dir = tempfile.mkdtemp()
+        self._trace_path = os.path.join(self._tmp_dir, 'io_test_trace-mynode')
+        with open(self._trace_path, 'w') as fid:
+            fid.write(trace_header)
+            for idx in range(num_row):
+                rid = region_a if idx % 2 == 0 else region_b
+                fid.write('{:.1e}|0x{:016x}|{}|{:.1e}\n'.format(idx * 0.5, rid, 0.0, idx * 0.25))
+
+    def tearDown(self):
+        for name in os.listdir(self._tmp_dir):
+            os.remove(os.path.join(self._tmp_dir, name))
+        os.rmdir(self._tmp_dir)
+
+    def test_trace_chunked(self):
+        full = geopmpy.io.Trace(self._trace_path)
+        chunked = geopmpy.io.Trace(self._trace_path, chunksize=3)
+        self.assertEqual(num_row, len(full.get_df()))
+        self.assertEqual(list(full.get_df().columns), list(chunked.get_df().columns))
+        self.assertTrue(full.get_df().equals(chunked.get_df()))
+        self.assertEqual('mynode', chunked.get_node_name())
+
+    def test_trace_filter(self):
+        tt = geopmpy.io.Trace(self._trace_path, columns=['seconds', 'runtime-0'],
+                              region_ids=[region_b], chunksize=3)
+        df = tt.get_df()
+        self.assertEqual(['seconds', 'runtime-0'], list(df.columns))
+        self.assertEqual([0.5, 1.5, 2.5, 3.5, 4.5], list(df['seconds']))
+        # region IDs given as strings select the same rows
+        tt = geopmpy.io.Trace(self._trace_path, columns=['seconds', 'runtime-0'],
+                              region_ids=[hex(region_b)], chunksize=3)
+        self.assertTrue(df.equals(tt.get_df()))
+
+    def test_trace_cache(self):
+        try:
+            import tables
+        except ImportError as ex:
+            self.skipTest("Warning, the trace cache requires the tables module to be installed: {}".format(ex))
+        expected = geopmpy.io.Trace(self._trace_path, region_ids=[region_a]).get_df()
+        for ii in range(2):
+            tt = geopmpy.io.Trace(self._trace_path, region_ids=[region_a], cache_dir=self._tmp_dir)
+            self.assertTrue(os.path.exists(geopmpy.io.Trace.cache_path(self._trace_path, self._tmp_dir)))
+            self.assertEqual(list(expected['seconds']), list(tt.get_df()['seconds']))
+        # a modified trace replaces the cached data
+        with open(self._trace_path, 'a') as fid:
+            fid.write('{:.1e}|0x{:016x}|{}|{:.1e}\n'.format(9.0, region_a, 0.0, 1.0))
+        os.utime(self._trace_path, (0, 0))
+        tt = geopmpy.io.Trace(self._trace_path, region_ids=[region_a], cache_dir=self._tmp_dir)
+        self.assertEqual(list(expected['seconds']) + [9.0], list(tt.get_df()['seconds']))
+
+    def test_trace_cache_path(self):
+        # traces with the same name in different directories get
+        # different cache files
+        other_dir = os.path.join(self._tmp_dir, 'other')
+        other_path = os.path.join(other_dir, os.path.basename(self._trace_path))
+        self.assertNotEqual(geopmpy.io.Trace.cache_path(self._trace_path, self._tmp_dir),
+                            geopmpy.io.Trace.cache_path(other_path, self._tmp_dir))
+        # relative and absolute spellings of one trace share a file
+        rel_path = os.path.relpath(self._trace_path)
+        self.assertEqual(geopmpy.io.Trace.cache_path(self._trace_path, self._tmp_dir),
+                         geopmpy.io.Trace.cache_path(rel_path, self._tmp_dir))
+
+
+if __name__ == '__main__':
+    unittest.main()
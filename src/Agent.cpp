@@ -30,7 +30,9 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "geopm_agent.h"
 #include "string.h"
@@ -131,6 +133,29 @@ namespace geopm
         return result;
     }
 
+    std::vector<SampleFilter::m_threshold_s> Agent::sample_threshold(void) const
+    {
+        return {};
+    }
+
+    const ILoopScheduler *Agent::loop_scheduler(void) const
+    {
+        return nullptr;
+    }
+
+    bool Agent::descend(const std::vector<double> &in_policy, ChildMatrix &out_policy)
+    {
+        std::vector<std::vector<double> > policy_rows = out_policy.rows();
+        bool result = descend(in_policy, policy_rows);
+        out_policy.rows(policy_rows);
+        return result;
+    }
+
+    bool Agent::ascend(const ChildMatrix &in_sample, std::vector<double> &out_sample)
+    {
+        return ascend(in_sample.rows(), out_sample);
+    }
+
     std::map<std::string, std::string> Agent::make_dictionary(const std::vector<std::string> &policy_names,
                                                                const std::vector<std::string> &sample_names)
     {
@@ -163,6 +188,154 @@ namespace geopm
         }
     }
 
+    void Agent::aggregate_sample(const ChildMatrix &in_sample,
+                                 const std::vector<std::function<double(const std::vector<double>&)> > &agg_func,
+                                 std::vector<double> &out_sample)
+    {
+        size_t num_children = in_sample.num_child();
+        size_t stride = in_sample.stride();
+        // Storage for aggregation functions that need a vector,
+        // allocated only when the fan-in grows.
+        static thread_local std::vector<double> child_sample;
+        for (size_t sig_idx = 0; sig_idx < out_sample.size(); ++sig_idx) {
+            const double *column = in_sample.column(sig_idx);
+            agg_column_f column_func = agg_column(agg_func[sig_idx]);
+            if (column_func) {
+                out_sample[sig_idx] = column_func(column, num_children, stride);
+            }
+            else {
+                child_sample.resize(num_children);
+                for (size_t child_idx = 0; child_idx < num_children; ++child_idx) {
+                    child_sample[child_idx] = column[child_idx * stride];
+                }
+                out_sample[sig_idx] = agg_func[sig_idx](child_sample);
+            }
+        }
+    }
+
+    Agent::agg_column_f Agent::agg_column(const std::function<double(const std::vector<double>&)> &agg_func)
+    {
+        static const std::vector<std::pair<double (*)(const std::vector<double>&), agg_column_f> > kernel_map {
+            {IPlatformIO::agg_sum, agg_column_sum},
+            {IPlatformIO::agg_average, agg_column_average},
+            {IPlatformIO::agg_median, agg_column_median},
+            {IPlatformIO::agg_and, agg_column_and},
+            {IPlatformIO::agg_or, agg_column_or},
+            {IPlatformIO::agg_min, agg_column_min},
+            {IPlatformIO::agg_max, agg_column_max},
+        };
+        agg_column_f result = nullptr;
+        auto target = agg_func.target<double (*)(const std::vector<double>&)>();
+        if (target) {
+            for (const auto &kernel : kernel_map) {
+                if (*target == kernel.first) {
+                    result = kernel.second;
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_sum(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = 0.0;
+            for (size_t child_idx = 0; child_idx < num_child; ++child_idx) {
+                result += column[child_idx * stride];
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_average(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = agg_column_sum(column, num_child, stride) / num_child;
+        }
+        return result;
+    }
+
+    double Agent::agg_column_median(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            static thread_local std::vector<double> sorted;
+            sorted.resize(num_child);
+            for (size_t child_idx = 0; child_idx < num_child; ++child_idx) {
+                sorted[child_idx] = column[child_idx * stride];
+            }
+            auto mid_it = sorted.begin() + num_child / 2;
+            std::nth_element(sorted.begin(), mid_it, sorted.end());
+            result = *mid_it;
+            if (num_child % 2 == 0) {
+                // The lower middle value is the largest value in the
+                // lower partition.
+                result += *std::max_element(sorted.begin(), mid_it);
+                result /= 2.0;
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_and(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = 1.0;
+            for (size_t child_idx = 0; result == 1.0 && child_idx < num_child; ++child_idx) {
+                if (column[child_idx * stride] == 0.0) {
+                    result = 0.0;
+                }
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_or(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = 0.0;
+            for (size_t child_idx = 0; result == 0.0 && child_idx < num_child; ++child_idx) {
+                if (column[child_idx * stride] != 0.0) {
+                    result = 1.0;
+                }
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_min(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = column[0];
+            for (size_t child_idx = 1; child_idx < num_child; ++child_idx) {
+                if (column[child_idx * stride] < result) {
+                    result = column[child_idx * stride];
+                }
+            }
+        }
+        return result;
+    }
+
+    double Agent::agg_column_max(const double *column, size_t num_child, size_t stride)
+    {
+        double result = NAN;
+        if (num_child) {
+            result = column[0];
+            for (size_t child_idx = 1; child_idx < num_child; ++child_idx) {
+                if (column[child_idx * stride] > result) {
+                    result = column[child_idx * stride];
+                }
+            }
+        }
+        return result;
+    }
+
 }
 
 int geopm_agent_supported(const char *agent_name)
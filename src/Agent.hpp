@@ -39,9 +39,13 @@
 
 #include "PluginFactory.hpp"
 #include "PlatformIO.hpp"
+#include "ChildMatrix.hpp"
+#include "SampleFilter.hpp"
 
 namespace geopm
 {
+    class ILoopScheduler;
+
     class Agent
     {
         public:
@@ -77,6 +81,30 @@ namespace geopm
             ///         call.
             virtual bool ascend(const std::vector<std::vector<double> > &in_sample,
                                 std::vector<double> &out_sample) = 0;
+            /// @brief Called by Kontroller to split policy for
+            ///        children at next level down the tree.  The
+            ///        default implementation copies through the
+            ///        vector of rows interface; agents override it to
+            ///        write the policies in place.
+            /// @param [in] in_policy Policy values from the parent.
+            /// @param [in,out] out_policy Matrix holding the policy
+            ///        of each child in one row.
+            /// @return True if out_policy has been updated since last call.
+            virtual bool descend(const std::vector<double> &in_policy,
+                                 ChildMatrix &out_policy);
+            /// @brief Called by Kontroller to aggregate samples from
+            ///        children for the next level up the tree.  The
+            ///        default implementation copies through the
+            ///        vector of rows interface; agents override it to
+            ///        read the samples in place.
+            /// @param [in] in_sample Matrix holding the sample of
+            ///        each child in one row.
+            /// @param [out] out_sample Aggregated sample values to be
+            ///        sent up to the parent.
+            /// @return True if out_sample has been updated since last
+            ///         call.
+            virtual bool ascend(const ChildMatrix &in_sample,
+                                std::vector<double> &out_sample);
             /// @brief Adjust the platform settings based the policy
             ///        from above.
             /// @param [in] policy Settings for each control in the
@@ -107,6 +135,17 @@ namespace geopm
             /// @brief Called by Kontroller to get latest values to be
             ///        added to the trace.
             virtual void trace_values(std::vector<double> &values) = 0;
+            /// @brief Change thresholds for each value of the sample
+            ///        vector sent up the tree.  A sample that has not
+            ///        moved beyond any threshold is not resent and
+            ///        the parent reuses the values last sent.  The
+            ///        default of an empty vector sends every sample.
+            virtual std::vector<SampleFilter::m_threshold_s> sample_threshold(void) const;
+            /// @brief Scheduler that paces wait(), used by the
+            ///        Kontroller to report overruns and wakeup
+            ///        jitter.  The default of nullptr omits these
+            ///        from the report.
+            virtual const ILoopScheduler *loop_scheduler(void) const;
             /// @brief Used to look up the number of values in the
             ///        policy vector sent down the tree for a specific
             ///        Agent.  This should be called with the
@@ -158,7 +197,34 @@ namespace geopm
             static void aggregate_sample(const std::vector<std::vector<double> > &in_sample,
                                          const std::vector<std::function<double(const std::vector<double>&)> > &agg_func,
                                          std::vector<double> &out_sample);
+            /// @brief Aggregate a matrix of child samples one column
+            ///        at a time.  The sum, average, min, max, median,
+            ///        and, and or aggregations of IPlatformIO are
+            ///        computed in place without building a vector
+            ///        per sample; other functions are applied to a
+            ///        reused copy of the column.
+            /// @param [in] in_sample Matrix holding the sample
+            ///        received from each child in one row.
+            /// @param [in] agg_func A vector over agent samples of
+            ///        the aggregation function that is applied.
+            /// @param [out] out_sample Sample vector resulting from
+            ///        the applying the aggregation across child
+            ///        samples.
+            static void aggregate_sample(const ChildMatrix &in_sample,
+                                         const std::vector<std::function<double(const std::vector<double>&)> > &agg_func,
+                                         std::vector<double> &out_sample);
         private:
+            typedef double (*agg_column_f)(const double *column, size_t num_child, size_t stride);
+            /// @brief Returns the column kernel that matches an
+            ///        IPlatformIO aggregation function or nullptr.
+            static agg_column_f agg_column(const std::function<double(const std::vector<double>&)> &agg_func);
+            static double agg_column_sum(const double *column, size_t num_child, size_t stride);
+            static double agg_column_average(const double *column, size_t num_child, size_t stride);
+            static double agg_column_median(const double *column, size_t num_child, size_t stride);
+            static double agg_column_and(const double *column, size_t num_child, size_t stride);
+            static double agg_column_or(const double *column, size_t num_child, size_t stride);
+            static double agg_column_min(const double *column, size_t num_child, size_t stride);
+            static double agg_column_max(const double *column, size_t num_child, size_t stride);
             static const std::string m_num_sample_string;
             static const std::string m_num_policy_string;
             static const std::string m_sample_prefix;
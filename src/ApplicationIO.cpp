@@ -260,7 +260,7 @@ namespace geopm
         double energy = 0.0;
         int num_package = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE);
         for (int pkg = 0; pkg < num_package; ++pkg) {
-            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, pkg);
         }
         return energy;
    }
@@ -270,7 +270,7 @@ namespace geopm
         double energy = 0.0;
         int num_dram = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY);
         for (int dram = 0; dram < num_dram; ++dram) {
-            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, 0);
+            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, dram);
         }
         return energy;
     }
@@ -323,6 +323,18 @@ namespace geopm
         return m_epoch_regulator->total_epoch_ignore_time();
     }
 
+    size_t ApplicationIO::total_app_num_drop(void) const
+    {
+#ifdef GEOPM_DEBUG
+        if (!m_is_connected) {
+            throw Exception("ApplicationIO::" + std::string(__func__) +
+                            " called before connect().",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        return m_sampler->num_drop();
+    }
+
     int ApplicationIO::total_count(uint64_t region_id) const
     {
 #ifdef GEOPM_DEBUG
@@ -355,6 +367,18 @@ namespace geopm
         m_profile_io_sample->update(m_prof_sample.cbegin(), m_prof_sample.cbegin() + length);
     }
 
+    void ApplicationIO::notify_read_batch(void)
+    {
+#ifdef GEOPM_DEBUG
+        if (!m_is_connected) {
+            throw Exception("ApplicationIO::" + std::string(__func__) +
+                            " called before connect().",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        m_epoch_regulator->notify_read_batch();
+    }
+
     std::list<geopm_region_info_s> ApplicationIO::region_info(void) const
     {
 #ifdef GEOPM_DEBUG
@@ -86,6 +86,10 @@ namespace geopm
             /// @brief Returns the total time spent in ignored regions
             ///        for the application after the first call to epoch.
             virtual double total_epoch_ignore_runtime(void) const = 0;
+            /// @brief Returns the number of profile samples that the
+            ///        application discarded because the controller
+            ///        did not keep up.
+            virtual size_t total_app_num_drop(void) const = 0;
             /// @brief Returns the total runtime after the first epoch
             ///        call.
             virtual double total_epoch_runtime(void) const = 0;
@@ -107,6 +111,10 @@ namespace geopm
             /// @param [in] comm Shared pointer to the comm used by
             ///        the Controller.
             virtual void update(std::shared_ptr<Comm> comm) = 0;
+            /// @brief Notify that PlatformIO::read_batch() has been
+            ///        called so that signals used for the
+            ///        application totals can be recorded.
+            virtual void notify_read_batch(void) = 0;
             /// @brief Returns the list of all regions entered or
             ///        exited since the last call to
             ///        clear_region_info().
@@ -151,12 +159,14 @@ namespace geopm
             double total_app_energy_dram(void) const override;
             double total_app_mpi_runtime(void) const override;
             double total_epoch_ignore_runtime(void) const override;
+            size_t total_app_num_drop(void) const override;
             double total_epoch_runtime(void) const override;
             double total_epoch_mpi_runtime(void) const override;
             double total_epoch_energy_pkg(void) const override;
             double total_epoch_energy_dram(void) const override;
             int total_count(uint64_t region_id) const override;
             void update(std::shared_ptr<Comm> comm) override;
+            void notify_read_batch(void) override;
             std::list<geopm_region_info_s> region_info(void) const override;
             void clear_region_info(void) override;
             void controller_ready(void) override;
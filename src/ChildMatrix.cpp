@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "ChildMatrix.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    ChildMatrix::ChildMatrix()
+        : ChildMatrix(0, 0)
+    {
+
+    }
+
+    ChildMatrix::ChildMatrix(size_t num_child, size_t num_field)
+        : m_num_child(num_child)
+        , m_num_field(num_field)
+        , m_stride(num_field)
+        , m_data(num_child * num_field, NAN)
+    {
+
+    }
+
+    ChildMatrix::ChildMatrix(const std::vector<std::vector<double> > &rows)
+        : ChildMatrix(rows.size(), rows.size() ? rows[0].size() : 0)
+    {
+        this->rows(rows);
+    }
+
+    size_t ChildMatrix::num_child(void) const
+    {
+        return m_num_child;
+    }
+
+    size_t ChildMatrix::num_field(void) const
+    {
+        return m_num_field;
+    }
+
+    size_t ChildMatrix::stride(void) const
+    {
+        return m_stride;
+    }
+
+    double *ChildMatrix::data(void)
+    {
+        return m_data.data();
+    }
+
+    const double *ChildMatrix::data(void) const
+    {
+        return m_data.data();
+    }
+
+    double *ChildMatrix::row(size_t child_idx)
+    {
+#ifdef GEOPM_DEBUG
+        if (child_idx >= m_num_child) {
+            throw Exception("ChildMatrix::row(): child_idx out of range",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        return m_data.data() + child_idx * m_stride;
+    }
+
+    const double *ChildMatrix::row(size_t child_idx) const
+    {
+#ifdef GEOPM_DEBUG
+        if (child_idx >= m_num_child) {
+            throw Exception("ChildMatrix::row(): child_idx out of range",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        return m_data.data() + child_idx * m_stride;
+    }
+
+    const double *ChildMatrix::column(size_t field_idx) const
+    {
+#ifdef GEOPM_DEBUG
+        if (field_idx >= m_num_field) {
+            throw Exception("ChildMatrix::column(): field_idx out of range",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        return m_data.data() + field_idx;
+    }
+
+    double ChildMatrix::value(size_t child_idx, size_t field_idx) const
+    {
+        return row(child_idx)[field_idx];
+    }
+
+    void ChildMatrix::fill(double value)
+    {
+        std::fill(m_data.begin(), m_data.end(), value);
+    }
+
+    void ChildMatrix::row(size_t child_idx, const std::vector<double> &value)
+    {
+        if (child_idx >= m_num_child || value.size() != m_num_field) {
+            throw Exception("ChildMatrix::row(): row does not fit in matrix",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        memcpy(row(child_idx), value.data(), m_num_field * sizeof(double));
+    }
+
+    bool ChildMatrix::is_any_nan(void) const
+    {
+        return std::any_of(m_data.begin(), m_data.end(),
+                           [](double val) {return std::isnan(val);});
+    }
+
+    std::vector<std::vector<double> > ChildMatrix::rows(void) const
+    {
+        std::vector<std::vector<double> > result(m_num_child);
+        for (size_t child_idx = 0; child_idx != m_num_child; ++child_idx) {
+            const double *child_row = row(child_idx);
+            result[child_idx].assign(child_row, child_row + m_num_field);
+        }
+        return result;
+    }
+
+    void ChildMatrix::rows(const std::vector<std::vector<double> > &value)
+    {
+        if (value.size() != m_num_child) {
+            throw Exception("ChildMatrix::rows(): number of rows does not match matrix",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t child_idx = 0; child_idx != m_num_child; ++child_idx) {
+            row(child_idx, value[child_idx]);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CHILDMATRIX_HPP_INCLUDE
+#define CHILDMATRIX_HPP_INCLUDE
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Values exchanged with the children of a tree level
+    ///        stored as one contiguous row per child.
+    ///
+    /// Field f of child c is found at data()[c * stride() + f], so
+    /// the values of one field over all children form a column
+    /// with elements stride() apart.  Column operations walk memory
+    /// in order without gathering into temporary vectors.
+    class ChildMatrix
+    {
+        public:
+            ChildMatrix();
+            /// @brief Create a matrix with every value set to NAN.
+            ChildMatrix(size_t num_child, size_t num_field);
+            /// @brief Create a matrix holding a copy of a vector of
+            ///        rows which must all be the same size.
+            explicit ChildMatrix(const std::vector<std::vector<double> > &rows);
+            virtual ~ChildMatrix() = default;
+            size_t num_child(void) const;
+            size_t num_field(void) const;
+            /// @brief Distance between the start of consecutive
+            ///        rows in number of doubles.
+            size_t stride(void) const;
+            double *data(void);
+            const double *data(void) const;
+            /// @brief Pointer to the num_field() values of a child.
+            double *row(size_t child_idx);
+            const double *row(size_t child_idx) const;
+            /// @brief Pointer to the value of a field for the first
+            ///        child; later children follow every stride()
+            ///        values.
+            const double *column(size_t field_idx) const;
+            double value(size_t child_idx, size_t field_idx) const;
+            /// @brief Set every field of every child to value.
+            void fill(double value);
+            /// @brief Set the fields of one child.
+            void row(size_t child_idx, const std::vector<double> &value);
+            /// @brief Returns true if any value is NAN.
+            bool is_any_nan(void) const;
+            /// @brief Copy of the matrix as a vector of rows.
+            std::vector<std::vector<double> > rows(void) const;
+            /// @brief Copy a vector of rows into the matrix; the
+            ///        dimensions must match.
+            void rows(const std::vector<std::vector<double> > &value);
+        private:
+            size_t m_num_child;
+            size_t m_num_field;
+            size_t m_stride;
+            std::vector<double> m_data;
+    };
+}
+
+#endif
@@ -184,21 +184,17 @@ namespace geopm
     template <class type>
     void CircularBuffer<type>::set_capacity(const unsigned int size)
     {
-        if (size < m_count) {
-            int size_diff = m_count - size;
-            std::vector<type> temp;
-            //Copy newest data into temporary vector
-            for (unsigned int i = m_head + size_diff; i < ((m_head + m_count) % m_max_size); i = ((i + 1) % m_max_size)) {
-                temp.push_back(m_buffer[i]);
-            }
-            //now re-size and swap out with tmp vector data
-            m_buffer.resize(size);
-            m_buffer.swap(temp);
-            m_count = size;
-        }
-        else {
-            m_buffer.resize(size);
+        unsigned int size_diff = m_count > size ? m_count - size : 0;
+        std::vector<type> temp;
+        temp.reserve(size);
+        //Copy newest data in order into temporary vector
+        for (unsigned int i = size_diff; i < m_count; ++i) {
+            temp.push_back(value(i));
         }
+        //now re-size and swap out with tmp vector data
+        temp.resize(size);
+        m_buffer.swap(temp);
+        m_count -= size_diff;
         m_head = 0;
         m_max_size = size;
     }
@@ -58,6 +58,85 @@ namespace geopm
         return m_agg_function(values);
     }
 
+    constexpr int PerRegionDerivativeCombinedSignal::M_NUM_SAMPLE_HISTORY_DEFAULT;
+
+    PerRegionDerivativeCombinedSignal::PerRegionDerivativeCombinedSignal()
+        : PerRegionDerivativeCombinedSignal(M_NUM_SAMPLE_HISTORY_DEFAULT)
+    {
+
+    }
+
+    PerRegionDerivativeCombinedSignal::PerRegionDerivativeCombinedSignal(int num_sample_history)
+        : m_num_sample_history(num_sample_history)
+        , m_region_id_last(NAN)
+        , m_region_idx_last(0)
+    {
+        if (m_num_sample_history < 2) {
+            throw Exception("PerRegionDerivativeCombinedSignal(): at least two samples are required for the fit",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    PerRegionDerivativeCombinedSignal::m_region_s &PerRegionDerivativeCombinedSignal::region(double region_id)
+    {
+        // Consecutive samples nearly always come from the same
+        // region, so only a change of region requires the lookup.
+        if (region_id != m_region_id_last) {
+            auto it = m_region_idx.find(region_id);
+            if (it == m_region_idx.end()) {
+                it = m_region_idx.emplace(region_id, m_region.size()).first;
+                m_region.push_back({CircularBuffer<m_sample_s>(m_num_sample_history),
+                                    {NAN, NAN}, 0.0, 0.0, 0.0, 0.0, 0, NAN});
+            }
+            m_region_id_last = region_id;
+            m_region_idx_last = it->second;
+        }
+        return m_region[m_region_idx_last];
+    }
+
+    void PerRegionDerivativeCombinedSignal::add(m_region_s &region, const m_sample_s &sample)
+    {
+        if (region.history.size() == 0) {
+            region.origin = sample;
+        }
+        double time = sample.time - region.origin.time;
+        double sig = sample.sample - region.origin.sample;
+        region.sum_time += time;
+        region.sum_sample += sig;
+        region.sum_time_time += time * time;
+        region.sum_time_sample += time * sig;
+    }
+
+    void PerRegionDerivativeCombinedSignal::remove(m_region_s &region, const m_sample_s &sample)
+    {
+        double time = sample.time - region.origin.time;
+        double sig = sample.sample - region.origin.sample;
+        region.sum_time -= time;
+        region.sum_sample -= sig;
+        region.sum_time_time -= time * time;
+        region.sum_time_sample -= time * sig;
+        ++region.num_remove;
+    }
+
+    void PerRegionDerivativeCombinedSignal::resum(m_region_s &region)
+    {
+        region.origin = region.history.value(0);
+        region.sum_time = 0.0;
+        region.sum_sample = 0.0;
+        region.sum_time_time = 0.0;
+        region.sum_time_sample = 0.0;
+        for (int buf_off = 0; buf_off < region.history.size(); ++buf_off) {
+            const m_sample_s &sample = region.history.value(buf_off);
+            double time = sample.time - region.origin.time;
+            double sig = sample.sample - region.origin.sample;
+            region.sum_time += time;
+            region.sum_sample += sig;
+            region.sum_time_time += time * time;
+            region.sum_time_sample += time * sig;
+        }
+        region.num_remove = 0;
+    }
+
     double PerRegionDerivativeCombinedSignal::sample(const std::vector<double> &values)
     {
 #ifdef GEOPM_DEBUG
@@ -67,51 +146,30 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        double region_id = values[0];
-        if (m_history.find(region_id) == m_history.end()) {
-            m_history[region_id] = CircularBuffer<m_sample_s>(M_NUM_SAMPLE_HISTORY);
+        m_region_s &reg = region(values[0]);
+        m_sample_s ins_sample {values[1], values[2]};
+        // insert time and signal, evicting the oldest sample from the
+        // regression sums when the history is full
+        if (reg.history.size() == reg.history.capacity()) {
+            remove(reg, reg.history.value(0));
         }
-        if (m_derivative_last.find(region_id) == m_derivative_last.end()) {
-            m_derivative_last[region_id] = NAN;
-        }
-        if (m_derivative_num_fit.find(region_id) == m_derivative_num_fit.end()) {
-            m_derivative_num_fit[region_id] = 0;
+        add(reg, ins_sample);
+        reg.history.insert(ins_sample);
+        if (reg.num_remove >= m_num_sample_history) {
+            // Re-anchor once per window so that rounding error from
+            // the removals does not accumulate.
+            resum(reg);
         }
 
-        double ins_time = values[1];
-        double ins_signal = values[2];
-        // insert time and signal
-        m_history[region_id].insert({ins_time, ins_signal});
-        if (m_derivative_num_fit.at(region_id) < M_NUM_SAMPLE_HISTORY) {
-            ++(m_derivative_num_fit[region_id]);
-        }
-
-        const CircularBuffer<m_sample_s> &history_buffer = m_history.at(region_id);
-        int num_fit = m_derivative_num_fit.at(region_id);
-
         // Least squares linear regression to approximate the
         // derivative with noisy data.
-        double result = m_derivative_last.at(region_id);
+        double result = reg.derivative_last;
+        int num_fit = reg.history.size();
         if (num_fit >= 2) {
-            size_t buf_size = history_buffer.size();
-            double A = 0.0, B = 0.0, C = 0.0, D = 0.0;
-            double E = 1.0 / num_fit;
-            double time_0 = history_buffer.value(buf_size - num_fit).time;
-            const double sig_0 = history_buffer.value(buf_size - num_fit).sample;
-            for (size_t buf_off = buf_size - num_fit;
-                 buf_off < buf_size; ++buf_off) {
-                double tt = history_buffer.value(buf_off).time;
-                double time = tt - time_0;
-                double sig = history_buffer.value(buf_off).sample - sig_0;
-                A += time * sig;
-                B += time;
-                C += sig;
-                D += time * time;
-            }
-            double ssxx = D - B * B * E;
-            double ssxy = A - B * C * E;
+            double ssxx = reg.sum_time_time - reg.sum_time * reg.sum_time / num_fit;
+            double ssxy = reg.sum_time_sample - reg.sum_time * reg.sum_sample / num_fit;
             result = ssxy / ssxx;
-            m_derivative_last[region_id] = result;
+            reg.derivative_last = result;
         }
         return result;
     }
@@ -61,7 +61,10 @@ namespace geopm
     class PerRegionDerivativeCombinedSignal : public CombinedSignal
     {
         public:
-            PerRegionDerivativeCombinedSignal() = default;
+            PerRegionDerivativeCombinedSignal();
+            /// @param [in] num_sample_history Number of samples per
+            ///        region used in the least squares fit.
+            PerRegionDerivativeCombinedSignal(int num_sample_history);
             virtual ~PerRegionDerivativeCombinedSignal() = default;
             double sample(const std::vector<double> &values) override;
         private:
@@ -69,11 +72,31 @@ namespace geopm
                 double time;
                 double sample;
             };
-            // map from region ID to time+energy history for that region
-            std::map<double, CircularBuffer<m_sample_s> > m_history;
-            std::map<double, double> m_derivative_last;
-            std::map<double, int> m_derivative_num_fit;
-            const int M_NUM_SAMPLE_HISTORY = 8;
+            /// @brief Fit history for one region.  The regression
+            ///        sums are kept relative to an origin sample near
+            ///        the start of the window so that they do not lose
+            ///        precision as time and energy grow.
+            struct m_region_s {
+                CircularBuffer<m_sample_s> history;
+                m_sample_s origin;
+                double sum_time;
+                double sum_sample;
+                double sum_time_time;
+                double sum_time_sample;
+                int num_remove;
+                double derivative_last;
+            };
+            m_region_s &region(double region_id);
+            void add(m_region_s &region, const m_sample_s &sample);
+            void remove(m_region_s &region, const m_sample_s &sample);
+            void resum(m_region_s &region);
+            const int m_num_sample_history;
+            // map from region ID to index into m_region
+            std::map<double, size_t> m_region_idx;
+            std::vector<m_region_s> m_region;
+            double m_region_id_last;
+            size_t m_region_idx_last;
+            static constexpr int M_NUM_SAMPLE_HISTORY_DEFAULT = 8;
     };
 }
 
@@ -128,6 +128,70 @@ namespace geopm
             ///
             /// @param [in] rank Rank of the locked window.
             virtual void window_unlock(size_t window_id, int rank) const = 0;
+            /// @brief Check if all ranks of the communicator can
+            ///        share memory, i.e. they run on the same node.
+            ///
+            /// This is a collective call.
+            ///
+            /// @return True if window_create_shared() may be used.
+            virtual bool is_node_local(void) const = 0;
+            /// @brief Allocate memory and create a window that all
+            ///        ranks of a node local communicator can load
+            ///        from and store to directly.
+            ///
+            /// @param [in] size Size of the memory this rank
+            ///        contributes to the window.
+            ///
+            /// @param [out] base Address of this rank's memory.
+            ///
+            /// @return Window handle, the memory is released by
+            ///         window_destroy().
+            virtual size_t window_create_shared(size_t size, void **base) = 0;
+            /// @brief Address of another rank's memory in a window
+            ///        created by window_create_shared().
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            ///
+            /// @param [in] rank Rank whose memory is queried.
+            virtual void *window_shared_query(size_t window_id, int rank) const = 0;
+            /// @brief Begin an epoch for RMA to all ranks of the
+            ///        window that remains open until
+            ///        window_unlock_all().
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            virtual void window_lock_all(size_t window_id) const = 0;
+            /// @brief End the epoch begun by window_lock_all().
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            virtual void window_unlock_all(size_t window_id) const = 0;
+            /// @brief Complete all outstanding RMA operations to a
+            ///        rank at both the origin and the target.
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            ///
+            /// @param [in] rank Target rank of the operations.
+            virtual void window_flush(size_t window_id, int rank) const = 0;
+            /// @brief Complete all outstanding RMA operations to a
+            ///        rank at the origin, so that send buffers may
+            ///        be reused.
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            ///
+            /// @param [in] rank Target rank of the operations.
+            virtual void window_flush_local(size_t window_id, int rank) const = 0;
+            /// @brief Synchronize the public and private copies of
+            ///        the calling rank's window memory.  Required
+            ///        before local loads from memory that is the
+            ///        target of puts unless the window uses the
+            ///        unified memory model.
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            virtual void window_sync(size_t window_id) const = 0;
+            /// @brief Returns true if the window uses the unified
+            ///        memory model (MPI_WIN_UNIFIED).
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            virtual bool window_is_unified(size_t window_id) const = 0;
             /// @brief Coordinate in Cartesian grid for specified rank
             ///
             /// @param [in] rank Rank for which coordinates should be calculated
@@ -162,6 +226,17 @@ namespace geopm
             /// @param [in] count Size of buffer in bytes to be transmitted.
             ///
             virtual void reduce_max(double *send_buf, double *recv_buf, size_t count, int root) const = 0;
+            /// @brief Reduce distributed messages across all ranks by summing them, store result on root
+            ///
+            /// @param [in] send_buf Start address of memory buffer to be trasnmitted.
+            ///
+            /// @param [out] recv_buf Start address of memory buffer to receive data.
+            ///
+            /// @param [in] count Number of doubles to be transmitted.
+            ///
+            /// @param [in] root Rank of the target for the transmission.
+            ///
+            virtual void reduce_sum(double *send_buf, double *recv_buf, size_t count, int root) const = 0;
             /// @brief Gather bytes from all processes
             ///
             /// @param [in] send_buf Start address of memory buffer to be trasnmitted.
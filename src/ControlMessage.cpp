@@ -31,6 +31,12 @@
  */
 
 #include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <cmath>
+#include <algorithm>
 
 #include "geopm_signal_handler.h"
 #include "geopm_env.h"
@@ -48,6 +54,7 @@ namespace geopm
         , m_is_ctl(is_ctl)
         , m_is_writer(is_writer)
         , m_last_status(M_STATUS_UNDEFINED)
+        , m_spin_limit(M_SPIN_MIN)
     {
         memset(&m_ctl_msg, 0, sizeof(geopm_ctl_message_s));
     }
@@ -56,9 +63,11 @@ namespace geopm
     {
         if (m_is_ctl && m_ctl_msg.ctl_status != M_STATUS_SHUTDOWN) {
             m_ctl_msg.ctl_status++;
+            wake_status(&m_ctl_msg.ctl_status);
         }
         else if (m_is_writer && m_ctl_msg.app_status != M_STATUS_SHUTDOWN) {
             m_ctl_msg.app_status++;
+            wake_status(&m_ctl_msg.app_status);
         }
     }
 
@@ -69,19 +78,8 @@ namespace geopm
         if (m_last_status != M_STATUS_SHUTDOWN) {
             ++m_last_status;
         }
-        geopm_time_s start;
-        geopm_time_s current;
-        geopm_time(&start);
-        current = start;
-        while (this_status() != m_last_status && geopm_time_diff(&start, &current) < M_WAIT_SEC) {
-            geopm_signal_handler_check();
-            if (this_status() == M_STATUS_ABORT) {
-                throw Exception("ControlMessage::wait(): Abort sent through control message",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
-            geopm_time(&current);
-        }
-        if (this_status() != m_last_status) {
+        volatile uint32_t *status_ptr = m_is_ctl ? &m_ctl_msg.app_status : &m_ctl_msg.ctl_status;
+        if (!wait_status(status_ptr, m_last_status, M_WAIT_SEC, true)) {
             throw Exception("ControlMessage::wait(): Timed out waiting for status " +
                             std::to_string(m_last_status),
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -92,9 +90,11 @@ namespace geopm
     {
         if (m_is_ctl) {
             m_ctl_msg.ctl_status = M_STATUS_ABORT;
+            wake_status(&m_ctl_msg.ctl_status);
         }
         else {
             m_ctl_msg.app_status = M_STATUS_ABORT;
+            wake_status(&m_ctl_msg.app_status);
         }
     }
 
@@ -136,18 +136,64 @@ namespace geopm
     void ControlMessage::loop_begin()
     {
         if (m_is_ctl) {
-            while (m_ctl_msg.app_status != M_STATUS_NAME_LOOP_BEGIN) {
-                geopm_signal_handler_check();
-            }
+            wait_status(&m_ctl_msg.app_status, M_STATUS_NAME_LOOP_BEGIN, INFINITY, false);
             m_ctl_msg.ctl_status = M_STATUS_NAME_LOOP_BEGIN;
+            wake_status(&m_ctl_msg.ctl_status);
         }
         else {
             m_ctl_msg.app_status = M_STATUS_NAME_LOOP_BEGIN;
-            while (m_ctl_msg.ctl_status != M_STATUS_NAME_LOOP_BEGIN) {
-                geopm_signal_handler_check();
-            }
+            wake_status(&m_ctl_msg.app_status);
+            wait_status(&m_ctl_msg.ctl_status, M_STATUS_NAME_LOOP_BEGIN, INFINITY, false);
         }
         m_last_status = M_STATUS_NAME_LOOP_BEGIN;
     }
 
+    bool ControlMessage::wait_status(volatile uint32_t *status_ptr, uint32_t status,
+                                     double timeout, bool is_abort_check)
+    {
+        // Longest time spent asleep before checking for signals
+        static const double M_SLEEP_SEC = 0.01;
+
+        uint32_t curr_status = *status_ptr;
+        int num_spin = 0;
+        while (curr_status != status && num_spin < m_spin_limit) {
+            ++num_spin;
+            curr_status = *status_ptr;
+        }
+        if (curr_status == status) {
+            m_spin_limit = std::min(2 * m_spin_limit, (int)M_SPIN_MAX);
+        }
+        else {
+            m_spin_limit = std::max(m_spin_limit / 2, (int)M_SPIN_MIN);
+        }
+
+        geopm_time_s start;
+        geopm_time_s current;
+        geopm_time(&start);
+        double elapsed = 0.0;
+        while (curr_status != status && elapsed < timeout) {
+            geopm_signal_handler_check();
+            if (is_abort_check && curr_status == M_STATUS_ABORT) {
+                throw Exception("ControlMessage::wait(): Abort sent through control message",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            double sleep_sec = std::min(M_SLEEP_SEC, timeout - elapsed);
+            struct timespec sleep_time = {(time_t)sleep_sec,
+                                          (long)((sleep_sec - (time_t)sleep_sec) * 1E9)};
+            // Returns immediately if the status word no longer
+            // holds curr_status.
+            (void)syscall(SYS_futex, (uint32_t *)status_ptr, FUTEX_WAIT, curr_status,
+                          &sleep_time, NULL, 0);
+            curr_status = *status_ptr;
+            geopm_time(&current);
+            elapsed = geopm_time_diff(&start, &current);
+        }
+        return curr_status == status;
+    }
+
+    void ControlMessage::wake_status(volatile uint32_t *status_ptr)
+    {
+        (void)syscall(SYS_futex, (uint32_t *)status_ptr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+
 }
@@ -148,6 +148,27 @@ namespace geopm
             void loop_begin(void) override;
         protected:
             int this_status() const;
+            /// @brief Wait until the status word reaches the given
+            ///        status.  Spins for a bounded number of reads
+            ///        and then sleeps on a futex on the status word,
+            ///        waking periodically to check for signals.
+            ///
+            /// @param [in] status_ptr Status word in shared memory.
+            ///
+            /// @param [in] status Status to wait for.
+            ///
+            /// @param [in] timeout Seconds to wait before giving up.
+            ///
+            /// @param [in] is_abort_check If true throw if the status
+            ///        word is set to M_STATUS_ABORT.
+            ///
+            /// @return True if the status was reached, false on
+            ///         timeout.
+            bool wait_status(volatile uint32_t *status_ptr, uint32_t status,
+                             double timeout, bool is_abort_check);
+            /// @brief Wake every process sleeping on the status
+            ///        word after it has been written.
+            static void wake_status(volatile uint32_t *status_ptr);
             /// @brief Enum encompassing application and
             /// GEOPM runtime state.
             enum m_status_e {
@@ -163,10 +184,18 @@ namespace geopm
                 M_STATUS_SHUTDOWN,
                 M_STATUS_ABORT = 9999,
             };
+            enum m_spin_e {
+                M_SPIN_MIN = 64,
+                M_SPIN_MAX = 65536,
+            };
             struct geopm_ctl_message_s &m_ctl_msg;
             bool m_is_ctl;
             bool m_is_writer;
             int m_last_status;
+            /// @brief Number of reads of the status word before
+            ///        sleeping.  Doubled when the peer arrives within
+            ///        the spin and halved when it does not.
+            int m_spin_limit;
 
     };
 
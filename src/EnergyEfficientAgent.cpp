@@ -42,6 +42,7 @@
 #include "PlatformTopo.hpp"
 #include "Helper.hpp"
 #include "Exception.hpp"
+#include "LoopScheduler.hpp"
 #include "config.h"
 
 namespace geopm
@@ -59,9 +60,10 @@ namespace geopm
         , m_freq_max(cpu_freq_max())
         , M_FREQ_STEP(get_limit("CPUINFO::FREQ_STEP"))
         , M_SEND_PERIOD(10)
+        , M_WAIT_SEC(0.005)
+        , m_loop_scheduler(geopm::make_unique<LoopScheduler>(M_WAIT_SEC))
         , m_last_freq(NAN)
         , m_curr_adapt_freq(NAN)
-        , m_last_wait{{0, 0}}
     {
         parse_env_map();
         const char* env_freq_online_str = getenv("GEOPM_EFFICIENT_FREQ_ONLINE");
@@ -71,6 +73,8 @@ namespace geopm
         init_platform_io();
     }
 
+    EnergyEfficientAgent::~EnergyEfficientAgent() = default;
+
     std::string EnergyEfficientAgent::plugin_name(void)
     {
         return "energy_efficient";
@@ -122,8 +126,24 @@ namespace geopm
     bool EnergyEfficientAgent::descend(const std::vector<double> &in_policy,
                                        std::vector<std::vector<double> >&out_policy)
     {
+        ChildMatrix policy_mat(out_policy);
+        bool result = descend(in_policy, policy_mat);
+        out_policy = policy_mat.rows();
+        return result;
+    }
+
+    bool EnergyEfficientAgent::ascend(const std::vector<std::vector<double> > &in_sample,
+                                      std::vector<double> &out_sample)
+    {
+        return ascend(ChildMatrix(in_sample), out_sample);
+    }
+
+    bool EnergyEfficientAgent::descend(const std::vector<double> &in_policy,
+                                       ChildMatrix &out_policy)
+    {
 #ifdef GEOPM_DEBUG
-        if (out_policy.size() != (size_t) m_num_children) {
+        if (out_policy.num_child() != (size_t) m_num_children ||
+            out_policy.num_field() != M_NUM_POLICY) {
             throw Exception("EnergyEfficientAgent::" + std::string(__func__) + "(): out_policy vector not correctly sized.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
@@ -131,13 +151,8 @@ namespace geopm
         bool result = update_freq_range(in_policy);
 
         if (result) {
-            for (auto &child_policy : out_policy) {
-#ifdef GEOPM_DEBUG
-        if (child_policy.size() != M_NUM_POLICY) {
-            throw Exception("EnergyEfficientAgent::" + std::string(__func__) + "(): child_policy vector not correctly sized.",
-                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
-        }
-#endif
+            for (size_t child_idx = 0; child_idx != out_policy.num_child(); ++child_idx) {
+                double *child_policy = out_policy.row(child_idx);
                 child_policy[M_POLICY_FREQ_MIN] = m_freq_min;
                 child_policy[M_POLICY_FREQ_MAX] = m_freq_max;
             }
@@ -145,7 +160,7 @@ namespace geopm
         return result;
     }
 
-    bool EnergyEfficientAgent::ascend(const std::vector<std::vector<double> > &in_sample,
+    bool EnergyEfficientAgent::ascend(const ChildMatrix &in_sample,
                                       std::vector<double> &out_sample)
     {
 #ifdef GEOPM_DEBUG
@@ -281,13 +296,12 @@ namespace geopm
 
     void EnergyEfficientAgent::wait(void)
     {
-        static double M_WAIT_SEC = 0.005;
-        geopm_time_s current_time;
-        geopm_time(&current_time);
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC) {
-            geopm_time(&current_time);
-        }
-        geopm_time(&m_last_wait);
+        m_loop_scheduler->wait();
+    }
+
+    const ILoopScheduler *EnergyEfficientAgent::loop_scheduler(void) const
+    {
+        return m_loop_scheduler.get();
     }
 
     std::vector<std::string> EnergyEfficientAgent::policy_names(void)
@@ -48,21 +48,27 @@ namespace geopm
 {
     class IPlatformIO;
     class IPlatformTopo;
+    class ILoopScheduler;
 
     class EnergyEfficientAgent : public Agent
     {
         public:
             EnergyEfficientAgent();
             EnergyEfficientAgent(IPlatformIO &plat_io, IPlatformTopo &topo);
-            virtual ~EnergyEfficientAgent() = default;
+            virtual ~EnergyEfficientAgent();
             void init(int level, const std::vector<int> &fan_in, bool is_level_root) override;
             bool descend(const std::vector<double> &in_policy,
                          std::vector<std::vector<double> >&out_policy) override;
             bool ascend(const std::vector<std::vector<double> > &in_sample,
                         std::vector<double> &out_sample) override;
+            bool descend(const std::vector<double> &in_policy,
+                         ChildMatrix &out_policy) override;
+            bool ascend(const ChildMatrix &in_sample,
+                        std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
             void wait(void) override;
+            const ILoopScheduler *loop_scheduler(void) const override;
             std::vector<std::pair<std::string, std::string> > report_header(void) const override;
             std::vector<std::pair<std::string, std::string> > report_node(void) const override;
             std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > report_region(void) const override;
@@ -100,6 +106,8 @@ namespace geopm
             double m_freq_max;
             const double M_FREQ_STEP;
             const size_t M_SEND_PERIOD;
+            const double M_WAIT_SEC;
+            std::unique_ptr<ILoopScheduler> m_loop_scheduler;
             std::vector<int> m_control_idx;
             double m_last_freq;
             double m_curr_adapt_freq;
@@ -107,7 +115,6 @@ namespace geopm
             // for online adaptive mode
             bool m_is_online = false;
             std::map<uint64_t, std::unique_ptr<EnergyEfficientRegion> > m_region_map;
-            geopm_time_s m_last_wait;
             std::vector<int> m_sample_idx;
             std::vector<int> m_signal_idx;
             std::vector<std::function<double(const std::vector<double>&)> > m_agg_func;
@@ -77,6 +77,15 @@ namespace geopm
             int profile_timeout(void) const;
             int debug_attach(void) const;
             int do_kontroller(void) const;
+            int do_profile_ring(void) const;
+            int msr_async_period(void) const;
+            int msr_num_worker(void) const;
+            int do_trace_binary(void) const;
+            int do_report_summary(void) const;
+            int do_report_node_file(void) const;
+            int do_tree_sequence(void) const;
+            int do_msr_save_scoped(void) const;
+            const char *tree_topology(void) const;
         private:
             bool get_env(const char *name, std::string &env_string) const;
             bool get_env(const char *name, int &value) const;
@@ -96,6 +105,15 @@ namespace geopm
             int m_profile_timeout;
             int m_debug_attach;
             bool m_do_kontroller;
+            bool m_do_profile_ring;
+            int m_msr_async_period;
+            int m_msr_num_worker;
+            bool m_do_trace_binary;
+            bool m_do_report_summary;
+            bool m_do_report_node_file;
+            bool m_do_tree_sequence;
+            bool m_do_msr_save_scoped;
+            std::string m_tree_topology;
             std::vector<std::string> m_trace_signal;
     };
 
@@ -133,11 +151,25 @@ namespace geopm
         m_profile_timeout = 30;
         m_debug_attach = -1;
         m_do_kontroller = false;
+        m_do_profile_ring = false;
+        m_msr_async_period = 0;
+        m_msr_num_worker = 0;
+        m_do_trace_binary = false;
+        m_do_report_summary = false;
+        m_do_report_node_file = false;
+        m_do_tree_sequence = false;
+        m_do_msr_save_scoped = false;
+        m_tree_topology = "";
         m_trace_signal.clear();
 
         std::string tmp_str("");
 
         (void)get_env("GEOPM_REPORT", m_report);
+        m_do_report_summary = get_env("GEOPM_REPORT_SUMMARY", tmp_str);
+        m_do_report_node_file = get_env("GEOPM_REPORT_NODE_FILE", tmp_str);
+        m_do_tree_sequence = get_env("GEOPM_TREE_SEQUENCE", tmp_str);
+        m_do_msr_save_scoped = get_env("GEOPM_MSR_SAVE_SCOPED", tmp_str);
+        (void)get_env("GEOPM_TREE_TOPOLOGY", m_tree_topology);
         (void)get_env("GEOPM_COMM", m_comm);
         (void)get_env("GEOPM_POLICY", m_policy);
         m_do_kontroller = get_env("GEOPM_AGENT", m_agent);
@@ -146,12 +178,16 @@ namespace geopm
             m_shmkey = "/" + m_shmkey;
         }
         m_do_trace = get_env("GEOPM_TRACE", m_trace);
+        m_do_trace_binary = get_env("GEOPM_TRACE_BINARY", tmp_str);
         (void)get_env("GEOPM_PLUGIN_PATH", m_plugin_path);
         if (!get_env("GEOPM_REPORT_VERBOSITY", m_report_verbosity) && m_report.size()) {
             m_report_verbosity = 1;
         }
         m_do_region_barrier = get_env("GEOPM_REGION_BARRIER", tmp_str);
+        m_do_profile_ring = get_env("GEOPM_PROFILE_RING", tmp_str);
         (void)get_env("GEOPM_PROFILE_TIMEOUT", m_profile_timeout);
+        (void)get_env("GEOPM_MSR_ASYNC_PERIOD", m_msr_async_period);
+        (void)get_env("GEOPM_MSR_NUM_WORKER", m_msr_num_worker);
         if (get_env("GEOPM_PMPI_CTL", tmp_str)) {
             if (tmp_str == "process") {
                 m_pmpi_ctl = GEOPM_PMPI_CTL_PROCESS;
@@ -316,6 +352,51 @@ namespace geopm
     {
         return m_do_kontroller;
     }
+
+    int Environment::do_profile_ring(void) const
+    {
+        return m_do_profile_ring;
+    }
+
+    int Environment::msr_async_period(void) const
+    {
+        return m_msr_async_period;
+    }
+
+    int Environment::msr_num_worker(void) const
+    {
+        return m_msr_num_worker;
+    }
+
+    int Environment::do_trace_binary(void) const
+    {
+        return m_do_trace_binary;
+    }
+
+    int Environment::do_report_summary(void) const
+    {
+        return m_do_report_summary;
+    }
+
+    int Environment::do_report_node_file(void) const
+    {
+        return m_do_report_node_file;
+    }
+
+    int Environment::do_tree_sequence(void) const
+    {
+        return m_do_tree_sequence;
+    }
+
+    int Environment::do_msr_save_scoped(void) const
+    {
+        return m_do_msr_save_scoped;
+    }
+
+    const char *Environment::tree_topology(void) const
+    {
+        return m_tree_topology.c_str();
+    }
 }
 
 extern "C"
@@ -413,4 +494,49 @@ extern "C"
     {
         return geopm::environment().do_kontroller();
     }
+
+    int geopm_env_do_profile_ring(void)
+    {
+        return geopm::environment().do_profile_ring();
+    }
+
+    int geopm_env_msr_async_period(void)
+    {
+        return geopm::environment().msr_async_period();
+    }
+
+    int geopm_env_msr_num_worker(void)
+    {
+        return geopm::environment().msr_num_worker();
+    }
+
+    int geopm_env_do_trace_binary(void)
+    {
+        return geopm::environment().do_trace_binary();
+    }
+
+    int geopm_env_do_report_summary(void)
+    {
+        return geopm::environment().do_report_summary();
+    }
+
+    int geopm_env_do_report_node_file(void)
+    {
+        return geopm::environment().do_report_node_file();
+    }
+
+    int geopm_env_do_tree_sequence(void)
+    {
+        return geopm::environment().do_tree_sequence();
+    }
+
+    int geopm_env_do_msr_save_scoped(void)
+    {
+        return geopm::environment().do_msr_save_scoped();
+    }
+
+    const char *geopm_env_tree_topology(void)
+    {
+        return geopm::environment().tree_topology();
+    }
 }
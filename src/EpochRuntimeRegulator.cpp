@@ -64,6 +64,13 @@ namespace geopm
         , m_epoch_start_energy_dram(NAN)
         , m_epoch_total_energy_pkg(NAN)
         , m_epoch_total_energy_dram(NAN)
+        , m_time_idx(-1)
+        , m_energy_pkg_idx(-1)
+        , m_energy_dram_idx(-1)
+        , m_time_ref({{0, 0}})
+        , m_time_ref_signal(0.0)
+        , m_energy_sample{{NAN, NAN, NAN}, {NAN, NAN, NAN}}
+        , m_num_energy_sample(0)
     {
         if (m_rank_per_node <= 0) {
             throw Exception("EpochRuntimeRegulator::EpochRuntimeRegulator(): invalid max rank count",
@@ -83,6 +90,7 @@ namespace geopm
 
     void EpochRuntimeRegulator::init_unmarked_region()
     {
+        push_energy_signal();
         struct geopm_time_s time;
         /// @todo This time should come from the application.
         geopm_time(&time);
@@ -97,7 +105,7 @@ namespace geopm
         double energy = 0.0;
         int num_package = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE);
         for (int pkg = 0; pkg < num_package; ++pkg) {
-            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+            energy += m_platform_io.read_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, pkg);
         }
         return energy;
     }
@@ -107,24 +115,68 @@ namespace geopm
         double energy = 0.0;
         int num_dram = m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_BOARD_MEMORY);
         for (int dram = 0; dram < num_dram; ++dram) {
-            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, 0);
+            energy += m_platform_io.read_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD_MEMORY, dram);
         }
         return energy;
     }
 
+    void EpochRuntimeRegulator::push_energy_signal(void)
+    {
+        m_time_idx = m_platform_io.push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
+        m_energy_pkg_idx = m_platform_io.push_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_BOARD, 0);
+        m_energy_dram_idx = m_platform_io.push_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD, 0);
+        // relate the TIME signal to the message time stamps
+        geopm_time(&m_time_ref);
+        m_time_ref_signal = m_platform_io.read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0);
+    }
+
+    void EpochRuntimeRegulator::sample_energy(const struct geopm_time_s &time,
+                                              double &energy_pkg,
+                                              double &energy_dram)
+    {
+        if (!m_num_energy_sample) {
+            energy_pkg = current_energy_pkg();
+            energy_dram = current_energy_dram();
+        }
+        else if (m_num_energy_sample < 2 ||
+                 m_energy_sample[1].time <= m_energy_sample[0].time) {
+            energy_pkg = m_energy_sample[1].energy_pkg;
+            energy_dram = m_energy_sample[1].energy_dram;
+        }
+        else {
+            // Linear estimate from the last two samples, extrapolated
+            // at most one sample interval past the last sample.
+            const m_energy_sample_s &prev = m_energy_sample[0];
+            const m_energy_sample_s &last = m_energy_sample[1];
+            double interval = last.time - prev.time;
+            double delta = geopm_time_diff(&m_time_ref, &time) + m_time_ref_signal - last.time;
+            if (delta < -interval) {
+                delta = -interval;
+            }
+            else if (delta > interval) {
+                delta = interval;
+            }
+            double factor = delta / interval;
+            energy_pkg = last.energy_pkg + factor * (last.energy_pkg - prev.energy_pkg);
+            energy_dram = last.energy_dram + factor * (last.energy_dram - prev.energy_dram);
+        }
+    }
+
     void EpochRuntimeRegulator::epoch(int rank, struct geopm_time_s epoch_time)
     {
         if (m_seen_first_epoch[rank]) {
             record_exit(GEOPM_REGION_ID_EPOCH, rank, epoch_time);
-            m_epoch_total_energy_pkg = current_energy_pkg() - m_epoch_start_energy_pkg;
-            m_epoch_total_energy_dram = current_energy_dram() - m_epoch_start_energy_dram;
+            double energy_pkg = NAN;
+            double energy_dram = NAN;
+            sample_energy(epoch_time, energy_pkg, energy_dram);
+            m_epoch_total_energy_pkg = energy_pkg - m_epoch_start_energy_pkg;
+            m_epoch_total_energy_dram = energy_dram - m_epoch_start_energy_dram;
         }
         else {
             std::fill(m_curr_mpi_runtime.begin(), m_curr_mpi_runtime.end(), 0.0);
             std::fill(m_curr_ignore_runtime.begin(), m_curr_ignore_runtime.end(), 0.0);
             m_seen_first_epoch[rank] = true;
-            m_epoch_start_energy_pkg = current_energy_pkg();
-            m_epoch_start_energy_dram = current_energy_dram();
+            sample_energy(epoch_time, m_epoch_start_energy_pkg, m_epoch_start_energy_dram);
         }
         record_entry(GEOPM_REGION_ID_EPOCH, rank, epoch_time);
     }
@@ -216,6 +268,22 @@ namespace geopm
         }
     }
 
+    void EpochRuntimeRegulator::notify_read_batch(void)
+    {
+        if (m_time_idx != -1) {
+            double sample_time = m_platform_io.sample(m_time_idx);
+            if (!m_num_energy_sample || sample_time != m_energy_sample[1].time) {
+                m_energy_sample[0] = m_energy_sample[1];
+                m_energy_sample[1] = {sample_time,
+                                      m_platform_io.sample(m_energy_pkg_idx),
+                                      m_platform_io.sample(m_energy_dram_idx)};
+                if (m_num_energy_sample < 2) {
+                    ++m_num_energy_sample;
+                }
+            }
+        }
+    }
+
     const IKruntimeRegulator &EpochRuntimeRegulator::region_regulator(uint64_t region_id) const
     {
         region_id = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, region_id);
@@ -241,7 +309,7 @@ namespace geopm
         return m_rid_regulator_map.at(GEOPM_REGION_ID_EPOCH)->per_rank_count();
     }
 
-    std::vector<double> EpochRuntimeRegulator::per_rank_last_runtime(uint64_t region_id) const
+    const std::vector<double> &EpochRuntimeRegulator::per_rank_last_runtime(uint64_t region_id) const
     {
         auto reg_it = m_rid_regulator_map.find(region_id);
         if (reg_it == m_rid_regulator_map.end()) {
@@ -270,13 +338,10 @@ namespace geopm
             result = IPlatformIO::agg_average(m_agg_epoch_mpi_runtime);
         }
         else {
-            try {
-                region_id = geopm_region_id_set_mpi(region_id);
+            region_id = geopm_region_id_set_mpi(region_id);
+            if (is_regulated(geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, region_id))) {
                 result = total_region_runtime(region_id);
             }
-            catch (const Exception &ex) {
-                /// @todo catch expected exception only
-            }
         }
         return result;
     }
@@ -53,7 +53,9 @@ namespace geopm
             IEpochRuntimeRegulator() = default;
             virtual ~IEpochRuntimeRegulator() = default;
             /// @brief Handle the initial entry into the unmarked
-            ///        region when the application starts.
+            ///        region when the application starts.  Must be
+            ///        called before the first PlatformIO::read_batch()
+            ///        so the energy signals can be pushed.
             virtual void init_unmarked_region() = 0;
             /// @brief Record a transition between epochs with
             ///        entry/exit into the epoch region.
@@ -71,6 +73,11 @@ namespace geopm
             /// @param [in] rank Rank that exited the region.
             /// @param [in] exit_time Time of exit.
             virtual void record_exit(uint64_t region_id, int rank, struct geopm_time_s exit_time) = 0;
+            /// @brief Notify that PlatformIO::read_batch() has been
+            ///        called.  Records the TIME and energy signals
+            ///        pushed by init_unmarked_region() so that epoch
+            ///        energy can be estimated between batches.
+            virtual void notify_read_batch(void) = 0;
             /// @brief Returns a reference to the RuntimeRegulator for
             ///        a given region.  This method is intended for
             ///        internal use by the ApplicationIO.
@@ -143,6 +150,7 @@ namespace geopm
             void epoch(int rank, struct geopm_time_s epoch_time) override;
             void record_entry(uint64_t region_id, int rank, struct geopm_time_s entry_time) override;
             void record_exit(uint64_t region_id, int rank, struct geopm_time_s exit_time) override;
+            void notify_read_batch(void) override;
             const IKruntimeRegulator &region_regulator(uint64_t region_id) const override;
             bool is_regulated(uint64_t region_id) const override;
             std::vector<double> last_epoch_time() const override;
@@ -159,9 +167,23 @@ namespace geopm
             std::list<geopm_region_info_s> region_info(void) const override;
             void clear_region_info(void) override;
         private:
-            std::vector<double> per_rank_last_runtime(uint64_t region_id) const;
+            const std::vector<double> &per_rank_last_runtime(uint64_t region_id) const;
             double current_energy_pkg(void) const;
             double current_energy_dram(void) const;
+            /// @brief Push the board signals sampled for epoch energy
+            ///        accounting.
+            void push_energy_signal(void);
+            /// @brief Estimate the package and DRAM energy at the
+            ///        given time from the values recorded by the last
+            ///        two calls to notify_read_batch().  Falls back
+            ///        to reading the signals if nothing has been
+            ///        recorded yet.
+            void sample_energy(const struct geopm_time_s &time, double &energy_pkg, double &energy_dram);
+            struct m_energy_sample_s {
+                double time;
+                double energy_pkg;
+                double energy_dram;
+            };
             int m_rank_per_node;
             IPlatformIO &m_platform_io;
             IPlatformTopo &m_platform_topo;
@@ -181,6 +203,18 @@ namespace geopm
             double m_epoch_total_energy_pkg;
             double m_epoch_total_energy_dram;
             std::map<uint64_t, int> m_region_rank_count;
+            int m_time_idx;
+            /// @brief True once PlatformIO::read_batch() has been
+            ///        called and the pushed signals can be sampled.
+            int m_energy_pkg_idx;
+            int m_energy_dram_idx;
+            /// @brief Time when the TIME signal was read as
+            ///        m_time_ref_signal.
+            struct geopm_time_s m_time_ref;
+            double m_time_ref_signal;
+            /// @brief The previous and the last distinct samples.
+            m_energy_sample_s m_energy_sample[2];
+            int m_num_energy_sample;
     };
 }
 
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <sstream>
 
 #include "geopm_env.h"
 #include "geopm_signal_handler.h"
@@ -46,6 +47,7 @@
 #include "PlatformTopo.hpp"
 #include "PlatformIO.hpp"
 #include "Agent.hpp"
+#include "LoopScheduler.hpp"
 #include "TreeComm.hpp"
 #include "ManagerIO.hpp"
 #include "config.h"
@@ -116,17 +118,20 @@ namespace geopm
         , m_out_policy(m_num_level_ctl)
         , m_in_sample(m_num_level_ctl)
         , m_out_sample(m_num_send_up, NAN)
+        , m_loop_time{{0, 0}}
+        , m_num_loop(0)
+        , m_loop_period_sum(0.0)
+        , m_loop_period_sq_sum(0.0)
+        , m_loop_period_max(0.0)
         , m_manager_io_sampler(std::move(manager_io_sampler))
     {
-        // Three dimensional vector over levels, children, and message
-        // index.  These are used as temporary storage when passing
-        // messages up and down the tree.
+        // Matrix over children and message index for each level.
+        // These are used as temporary storage when passing messages
+        // up and down the tree.
         for (int level = 0; level != m_num_level_ctl; ++level) {
             int num_children = m_tree_comm->level_size(level);
-            m_out_policy[level] = std::vector<std::vector<double> >(num_children,
-                                                                    std::vector<double>(m_num_send_down, NAN));
-            m_in_sample[level] = std::vector<std::vector<double> >(num_children,
-                                                                   std::vector<double>(m_num_send_up, NAN));
+            m_out_policy[level] = ChildMatrix(num_children, m_num_send_down);
+            m_in_sample[level] = ChildMatrix(num_children, m_num_send_up);
         }
     }
 
@@ -162,6 +167,13 @@ namespace geopm
             throw Exception("Kontroller number of agents is incorrect",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        int num_level_send_up = m_is_root ? m_num_level_ctl : m_num_level_ctl + 1;
+        for (level = 0; level < num_level_send_up; ++level) {
+            auto threshold = m_agent[level]->sample_threshold();
+            if (!threshold.empty()) {
+                m_tree_comm->sample_threshold(level, threshold);
+            }
+        }
     }
 
     void Kontroller::run(void)
@@ -182,6 +194,7 @@ namespace geopm
         m_application_io->update(m_comm);
         geopm_signal_handler_check();
         m_platform_io.read_batch();
+        m_application_io->notify_read_batch();
         geopm_signal_handler_check();
         m_tracer->update(m_trace_sample, m_application_io->region_info());
         geopm_signal_handler_check();
@@ -193,6 +206,7 @@ namespace geopm
         m_application_io->update(m_comm);
         geopm_signal_handler_check();
         m_platform_io.read_batch();
+        m_application_io->notify_read_batch();
         geopm_signal_handler_check();
         m_tracer->update(m_trace_sample, m_application_io->region_info());
         geopm_signal_handler_check();
@@ -208,12 +222,46 @@ namespace geopm
             agent_report_header = m_agent[m_root_level]->report_header();
         }
 
-        auto agent_node_report = m_agent[0]->report_node();
+        // Loop period mean, max and standard deviation over the
+        // intervals between returns of the Agent's wait()
+        double loop_period_mean = 0.0;
+        double loop_period_std = 0.0;
+        if (m_num_loop > 1) {
+            loop_period_mean = m_loop_period_sum / (m_num_loop - 1);
+            loop_period_std = std::sqrt(std::max(0.0, m_loop_period_sq_sum / (m_num_loop - 1) -
+                                                      loop_period_mean * loop_period_mean));
+        }
+        std::ostringstream loop_mean_str;
+        std::ostringstream loop_max_str;
+        std::ostringstream loop_std_str;
+        loop_mean_str << loop_period_mean;
+        loop_max_str << m_loop_period_max;
+        loop_std_str << loop_period_std;
+        std::vector<std::pair<std::string, std::string> > controller_report {
+            {"trace-stall (count)", std::to_string(m_tracer->num_stall())},
+            {"trace-drop (bytes)", std::to_string(m_tracer->num_byte_drop())},
+            {"loop (count)", std::to_string(m_num_loop)},
+            {"loop-period-mean (sec)", loop_mean_str.str()},
+            {"loop-period-max (sec)", loop_max_str.str()},
+            {"loop-period-std (sec)", loop_std_str.str()}};
+        const ILoopScheduler *loop_scheduler = m_agent[0]->loop_scheduler();
+        if (loop_scheduler) {
+            // Deadline misses and lateness of the wakeup with
+            // respect to the deadline as seen by the Agent's wait()
+            std::ostringstream jitter_mean_str;
+            std::ostringstream jitter_max_str;
+            jitter_mean_str << loop_scheduler->jitter_mean();
+            jitter_max_str << loop_scheduler->jitter_max();
+            controller_report.push_back({"loop-overrun (count)", std::to_string(loop_scheduler->num_overrun())});
+            controller_report.push_back({"loop-wake-jitter-mean (sec)", jitter_mean_str.str()});
+            controller_report.push_back({"loop-wake-jitter-max (sec)", jitter_max_str.str()});
+        }
 
         m_reporter->generate(m_agent_name,
                              agent_report_header,
-                             agent_node_report,
+                             m_agent[0]->report_node(),
                              m_agent[0]->report_region(),
+                             controller_report,
                              *m_application_io,
                              m_comm,
                              *m_tree_comm);
@@ -228,6 +276,16 @@ namespace geopm
         walk_up();
         geopm_signal_handler_check();
         m_agent[0]->wait();
+        struct geopm_time_s curr_time;
+        geopm_time(&curr_time);
+        if (m_num_loop) {
+            double period = geopm_time_diff(&m_loop_time, &curr_time);
+            m_loop_period_sum += period;
+            m_loop_period_sq_sum += period * period;
+            m_loop_period_max = std::max(m_loop_period_max, period);
+        }
+        m_loop_time = curr_time;
+        ++m_num_loop;
         geopm_signal_handler_check();
     }
 
@@ -262,6 +320,7 @@ namespace geopm
     {
         m_application_io->update(m_comm);
         m_platform_io.read_batch();
+        m_application_io->notify_read_batch();
         bool do_send = m_agent[0]->sample_platform(m_out_sample);
         m_agent[0]->trace_values(m_trace_sample);
         m_tracer->update(m_trace_sample, m_application_io->region_info());
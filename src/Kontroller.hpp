@@ -40,6 +40,9 @@
 #include <vector>
 #include <map>
 
+#include "geopm_time.h"
+#include "ChildMatrix.hpp"
+
 namespace geopm
 {
     class Comm;
@@ -149,10 +152,17 @@ namespace geopm
             std::vector<std::unique_ptr<Agent> > m_agent;
             const bool m_is_root;
             std::vector<double> m_in_policy;
-            std::vector<std::vector<std::vector<double> > > m_out_policy;
-            std::vector<std::vector<std::vector<double> > > m_in_sample;
+            std::vector<ChildMatrix> m_out_policy;
+            std::vector<ChildMatrix> m_in_sample;
             std::vector<double> m_out_sample;
             std::vector<double> m_trace_sample;
+            // Period between returns of the Agent's wait(), reported
+            // in the controller section
+            struct geopm_time_s m_loop_time;
+            size_t m_num_loop;
+            double m_loop_period_sum;
+            double m_loop_period_sq_sum;
+            double m_loop_period_max;
 
             std::unique_ptr<IManagerIOSampler> m_manager_io_sampler;
 
@@ -158,42 +158,33 @@ namespace geopm
     void KprofileIOGroup::read_batch(void)
     {
         if (m_do_read[M_SIGNAL_REGION_ID]) {
-            m_per_cpu_region_id = m_profile_sample->per_cpu_region_id();
+            m_profile_sample->per_cpu_region_id(m_per_cpu_region_id);
         }
         if (m_do_read[M_SIGNAL_PROGRESS]) {
             struct geopm_time_s read_time;
             geopm_time(&read_time);
-            m_per_cpu_progress = m_profile_sample->per_cpu_progress(read_time);
+            m_profile_sample->per_cpu_progress(read_time, m_per_cpu_progress);
         }
         if (m_do_read[M_SIGNAL_EPOCH_RUNTIME]) {
             std::vector<double> per_rank_epoch_runtime = m_epoch_regulator.last_epoch_time();
             for (size_t cpu_idx = 0; cpu_idx != m_cpu_rank.size(); ++cpu_idx) {
-                m_epoch_runtime[cpu_idx] = per_rank_epoch_runtime[m_cpu_rank[cpu_idx]];
+                if (m_cpu_rank[cpu_idx] != -1) {
+                    m_epoch_runtime[cpu_idx] = per_rank_epoch_runtime[m_cpu_rank[cpu_idx]];
+                }
             }
         }
         if (m_do_read[M_SIGNAL_EPOCH_COUNT]) {
             std::vector<double> per_rank_epoch_count = m_epoch_regulator.epoch_count();
             for (size_t cpu_idx = 0; cpu_idx != m_cpu_rank.size(); ++cpu_idx) {
-                m_epoch_count[cpu_idx] = per_rank_epoch_count[m_cpu_rank[cpu_idx]];
+                if (m_cpu_rank[cpu_idx] != -1) {
+                    m_epoch_count[cpu_idx] = per_rank_epoch_count[m_cpu_rank[cpu_idx]];
+                }
             }
         }
         if (m_do_read[M_SIGNAL_RUNTIME]) {
-            // look up the region for each cpu and cache the per-cpu runtimes for that region
-            std::map<uint64_t, std::vector<double> > cache;
-            for (auto rid : m_per_cpu_region_id) {
-                // add runtimes for each region if not already present
-                auto it = cache.find(rid);
-                if (it == cache.end()) {
-                    cache.emplace(std::piecewise_construct,
-                                  std::forward_as_tuple(rid),
-                                  std::forward_as_tuple(m_profile_sample->per_cpu_runtime(rid)));
-                }
-            }
-            // look up the last runtime for a cpu given its current region
+            // last runtime of the region each cpu is currently in
             // we assume ranks don't move between cpus
-            for (size_t cpu = 0; cpu < m_per_cpu_runtime.size(); ++cpu) {
-                m_per_cpu_runtime[cpu] = cache.at(m_per_cpu_region_id[cpu])[cpu];
-            }
+            m_profile_sample->per_cpu_runtime(m_per_cpu_runtime);
         }
         m_is_batch_read = true;
     }
@@ -257,6 +248,7 @@ namespace geopm
         int cpu_idx = domain_idx;
         struct geopm_time_s read_time;
         uint64_t region_id;
+        std::vector<double> runtime;
         double result = NAN;
         switch (signal_type) {
             case M_SIGNAL_REGION_ID:
@@ -274,7 +266,8 @@ namespace geopm
                 break;
             case M_SIGNAL_RUNTIME:
                 region_id = m_profile_sample->per_cpu_region_id()[cpu_idx];
-                result = m_profile_sample->per_cpu_runtime(region_id)[cpu_idx];
+                m_profile_sample->per_cpu_runtime(region_id, runtime);
+                result = runtime[cpu_idx];
                 break;
             default:
 #ifdef GEOPM_DEBUG
@@ -101,7 +101,6 @@ namespace geopm
             std::vector<double> m_per_cpu_runtime;
             std::vector<double> m_epoch_runtime;
             std::vector<double> m_epoch_count;
-            std::map<int, int> m_rid_idx; // map from runtime signal index to the region id signal it uses
             std::vector<int> m_cpu_rank;
     };
 }
@@ -37,8 +37,6 @@
 
 #include "EpochRuntimeRegulator.hpp"
 #include "KprofileIOSample.hpp"
-#include "ProfileIO.hpp"
-#include "CircularBuffer.hpp"
 #include "KruntimeRegulator.hpp"
 #include "PlatformIO.hpp"
 #include "PlatformTopo.hpp"
@@ -48,21 +46,55 @@
 namespace geopm
 {
     KprofileIOSample::KprofileIOSample(const std::vector<int> &cpu_rank, IEpochRuntimeRegulator &epoch_regulator)
+        : KprofileIOSample(cpu_rank, epoch_regulator, platform_io())
+    {
+
+    }
+
+    KprofileIOSample::KprofileIOSample(const std::vector<int> &cpu_rank, IEpochRuntimeRegulator &epoch_regulator,
+                                       IPlatformIO &platform_io)
         : m_epoch_regulator(epoch_regulator)
+        , m_cpu_rank(cpu_rank.size(), -1)
+        , m_num_rank(0)
+        , m_rank_min(0)
     {
         // This object is created when app connects
         geopm_time(&m_app_start_time);
 
         // Ths following is necessary because all other usages of "time zero" query the TimeIOGroup.
-        double elapsed = platform_io().read_signal("TIME", PlatformTopo::M_DOMAIN_BOARD, 0);
+        double elapsed = platform_io.read_signal("TIME", PlatformTopo::M_DOMAIN_BOARD, 0);
         geopm_time_add(&m_app_start_time, elapsed * -1, &m_app_start_time);
 
-        m_rank_idx_map = ProfileIO::rank_to_node_local_rank(cpu_rank);
-        m_cpu_rank = ProfileIO::rank_to_node_local_rank_per_cpu(cpu_rank);
-        m_num_rank = m_rank_idx_map.size();
+        std::set<int> rank_set;
+        for (auto rank : cpu_rank) {
+            if (rank != -1) {
+                rank_set.insert(rank);
+            }
+        }
+        m_rank_sorted.assign(rank_set.begin(), rank_set.end());
+        m_num_rank = m_rank_sorted.size();
+        if (m_num_rank) {
+            m_rank_min = m_rank_sorted.front();
+            // Use a direct lookup table unless the ranks on the node
+            // are spread sparsely through the MPI communicator.
+            size_t rank_span = m_rank_sorted.back() - m_rank_min + 1;
+            if (rank_span <= M_DENSE_SPAN_FACTOR * m_num_rank) {
+                m_rank_dense_idx.resize(rank_span, -1);
+                for (size_t idx = 0; idx != m_num_rank; ++idx) {
+                    m_rank_dense_idx[m_rank_sorted[idx] - m_rank_min] = idx;
+                }
+            }
+        }
+        for (size_t cpu_idx = 0; cpu_idx != cpu_rank.size(); ++cpu_idx) {
+            if (cpu_rank[cpu_idx] != -1) {
+                m_cpu_rank[cpu_idx] = local_rank(cpu_rank[cpu_idx]);
+            }
+        }
 
         // 2 samples for linear interpolation
-        m_rank_sample_buffer.resize(m_num_rank, CircularBuffer<struct m_rank_sample_s>(2));
+        m_sample_count.resize(m_num_rank, 0);
+        m_sample_time.resize(2 * m_num_rank, {{0, 0}});
+        m_sample_progress.resize(2 * m_num_rank, 0.0);
         m_region_id.resize(m_num_rank, GEOPM_REGION_ID_UNMARKED);
     }
 
@@ -71,6 +103,38 @@ namespace geopm
 
     }
 
+    int KprofileIOSample::local_rank(int rank) const
+    {
+        int result = -1;
+        if (m_rank_dense_idx.size()) {
+            int offset = rank - m_rank_min;
+            if (offset >= 0 && offset < (int)m_rank_dense_idx.size()) {
+                result = m_rank_dense_idx[offset];
+            }
+        }
+        else {
+            auto it = std::lower_bound(m_rank_sorted.begin(), m_rank_sorted.end(), rank);
+            if (it != m_rank_sorted.end() && *it == rank) {
+                result = it - m_rank_sorted.begin();
+            }
+        }
+        return result;
+    }
+
+    void KprofileIOSample::insert_sample(int local_rank, const struct geopm_time_s &timestamp, double progress)
+    {
+        int &count = m_sample_count[local_rank];
+        size_t base = 2 * local_rank;
+        if (count == 2) {
+            m_sample_time[base] = m_sample_time[base + 1];
+            m_sample_progress[base] = m_sample_progress[base + 1];
+            count = 1;
+        }
+        m_sample_time[base + count] = timestamp;
+        m_sample_progress[base + count] = progress;
+        ++count;
+    }
+
     void KprofileIOSample::finalize_unmarked_region()
     {
         struct geopm_time_s time;
@@ -88,32 +152,32 @@ namespace geopm
                                   std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_end)
     {
         for (auto sample_it = prof_sample_begin; sample_it != prof_sample_end; ++sample_it) {
-            auto rank_idx_it = m_rank_idx_map.find(sample_it->second.rank);
+            int local_rank = this->local_rank(sample_it->second.rank);
+            if (local_rank == -1) {
 #ifdef GEOPM_DEBUG
-            if (rank_idx_it == m_rank_idx_map.end()) {
                 throw Exception("KprofileIOSample::update(): invalid profile sample data",
                                 GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
-            }
 #endif
-            size_t local_rank = rank_idx_it->second;
+                continue;
+            }
             uint64_t region_id = sample_it->second.region_id;
+            const struct geopm_time_s &timestamp = sample_it->second.timestamp;
+            double progress = sample_it->second.progress;
             if (geopm_region_id_is_epoch(region_id)) {
-                m_epoch_regulator.epoch(local_rank, sample_it->second.timestamp);
+                m_epoch_regulator.epoch(local_rank, timestamp);
             }
             else {
-                struct m_rank_sample_s rank_sample { .timestamp = sample_it->second.timestamp,
-                                                     .progress = sample_it->second.progress };
                 if (m_region_id[local_rank] != region_id) {
-                    if (rank_sample.progress == 0.0) {
+                    if (progress == 0.0) {
                         if (m_region_id[local_rank] == GEOPM_REGION_ID_UNMARKED) {
-                            m_epoch_regulator.record_exit(GEOPM_REGION_ID_UNMARKED, local_rank, rank_sample.timestamp);
+                            m_epoch_regulator.record_exit(GEOPM_REGION_ID_UNMARKED, local_rank, timestamp);
                         }
-                        m_epoch_regulator.record_entry(region_id, local_rank, rank_sample.timestamp);
+                        m_epoch_regulator.record_entry(region_id, local_rank, timestamp);
                     }
-                    m_rank_sample_buffer[local_rank].clear();
+                    m_sample_count[local_rank] = 0;
                 }
-                if (rank_sample.progress == 1.0) {
-                    m_epoch_regulator.record_exit(region_id, local_rank, rank_sample.timestamp);
+                if (progress == 1.0) {
+                    m_epoch_regulator.record_exit(region_id, local_rank, timestamp);
                     uint64_t mpi_parent_rid = geopm_region_id_unset_mpi(region_id);
                     if (m_epoch_regulator.is_regulated(mpi_parent_rid)) {
                         m_region_id[local_rank] = mpi_parent_rid;
@@ -121,101 +185,103 @@ namespace geopm
                     else {
                         if (m_region_id[local_rank] != GEOPM_REGION_ID_UNMARKED) {
                             m_region_id[local_rank] = GEOPM_REGION_ID_UNMARKED;
-                            m_epoch_regulator.record_entry(GEOPM_REGION_ID_UNMARKED, local_rank, rank_sample.timestamp);
+                            m_epoch_regulator.record_entry(GEOPM_REGION_ID_UNMARKED, local_rank, timestamp);
                         }
                     }
                 }
                 else {
                     m_region_id[local_rank] = region_id;
                 }
-                m_rank_sample_buffer[local_rank].insert(rank_sample);
+                insert_sample(local_rank, timestamp, progress);
             }
         }
     }
 
     std::vector<double> KprofileIOSample::per_cpu_progress(const struct geopm_time_s &extrapolation_time) const
     {
-        std::vector<double> result(m_cpu_rank.size(), 0.0);
-        std::vector<double> rank_progress = per_rank_progress(extrapolation_time);
-        int cpu_idx = 0;
-        for (auto it : m_cpu_rank) {
-            result[cpu_idx] = rank_progress[it];
-            ++cpu_idx;
-        }
+        std::vector<double> result;
+        per_cpu_progress(extrapolation_time, result);
         return result;
     }
 
-    std::vector<double> KprofileIOSample::per_rank_progress(const struct geopm_time_s &extrapolation_time) const
+    void KprofileIOSample::per_cpu_progress(const struct geopm_time_s &extrapolation_time,
+                                            std::vector<double> &result) const
     {
+        result.resize(m_cpu_rank.size());
+        auto result_it = result.begin();
+        for (auto rank : m_cpu_rank) {
+            *result_it = rank == -1 ? 0.0 : rank_progress(rank, extrapolation_time);
+            ++result_it;
+        }
+    }
+
+    double KprofileIOSample::rank_progress(int local_rank, const struct geopm_time_s &extrapolation_time) const
+    {
+        double result = 0.0;
+        size_t base = 2 * local_rank;
+        const struct geopm_time_s *timestamp_prev = m_sample_time.data() + base;
+        const double *progress_prev = m_sample_progress.data() + base;
         double delta;
         double factor;
         double dsdt;
-        geopm_time_s timestamp_prev[2];
-        std::vector<double> result(m_num_rank);
-#ifdef GEOPM_DEBUG
-        if (m_rank_sample_buffer.size() != m_num_rank) {
-            throw Exception("m_rank_sample_buffer was wrong size", GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
-        }
-#endif
-
-        auto result_it = result.begin();
-        for (auto sample_it = m_rank_sample_buffer.begin();
-             sample_it != m_rank_sample_buffer.end();
-             ++sample_it, ++result_it) {
-            switch(sample_it->size()) {
-                case M_INTERP_TYPE_NONE:
-                    *result_it = 0.0;
-                    break;
-                case M_INTERP_TYPE_NEAREST:
-                    // if there is only one sample insert it directly
-                    *result_it = sample_it->value(0).progress;
-                    break;
-                case M_INTERP_TYPE_LINEAR:
-                    // if there are two samples, extrapolate to the given timestamp
-                    timestamp_prev[0] = sample_it->value(0).timestamp;
-                    timestamp_prev[1] = sample_it->value(1).timestamp;
+        switch (m_sample_count[local_rank]) {
+            case M_INTERP_TYPE_NONE:
+                result = 0.0;
+                break;
+            case M_INTERP_TYPE_NEAREST:
+                // if there is only one sample insert it directly
+                result = progress_prev[0];
+                break;
+            case M_INTERP_TYPE_LINEAR:
+                // if there are two samples, extrapolate to the given timestamp
+                if (progress_prev[1] == 1.0) {
+                    result = 1.0;
+                }
+                else if (progress_prev[0] == 0.0) {
+                    // so we don't miss region entry
+                    result = 0.0;
+                }
+                else {
                     delta = geopm_time_diff(timestamp_prev + 1, &extrapolation_time);
                     factor = 1.0 / geopm_time_diff(timestamp_prev, timestamp_prev + 1);
-                    dsdt = (sample_it->value(1).progress - sample_it->value(0).progress) * factor;
+                    dsdt = (progress_prev[1] - progress_prev[0]) * factor;
                     dsdt = dsdt > 0.0 ? dsdt : 0.0; // progress does not decrease over time
-                    if (sample_it->value(1).progress == 1.0) {
-                        *result_it = 1.0;
-                    }
-                    else if (sample_it->value(0).progress == 0.0) {
-                        // so we don't miss region entry
-                        *result_it = 0.0;
-                    }
-                    else {
-                        *result_it = sample_it->value(1).progress + dsdt * delta;
-                        *result_it = *result_it >= 0.0 ? *result_it : 1e-9;
-                        *result_it = *result_it <= 1.0 ? *result_it : 1 - 1e-9;
-                    }
-                    break;
-                default:
+                    result = progress_prev[1] + dsdt * delta;
+                    result = result >= 0.0 ? result : 1e-9;
+                    result = result <= 1.0 ? result : 1 - 1e-9;
+                }
+                break;
+            default:
 #ifdef GEOPM_DEBUG
-                    throw Exception("KprofileIOSample::align_prof() CircularBuffer has more than two values",
-                                    GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+                throw Exception("KprofileIOSample::rank_progress(): more than two samples stored",
+                                GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
 #endif
-                    break;
-            }
+                break;
         }
         return result;
     }
 
     std::vector<uint64_t> KprofileIOSample::per_cpu_region_id(void) const
     {
-        std::vector<uint64_t> result(m_cpu_rank.size(), GEOPM_REGION_ID_UNMARKED);
-        int cpu_idx = 0;
+        std::vector<uint64_t> result;
+        per_cpu_region_id(result);
+        return result;
+    }
+
+    void KprofileIOSample::per_cpu_region_id(std::vector<uint64_t> &result) const
+    {
+        result.resize(m_cpu_rank.size());
+        auto result_it = result.begin();
         for (auto rank : m_cpu_rank) {
-            result[cpu_idx] = m_region_id[rank];
-            ++cpu_idx;
+            *result_it = rank == -1 ? GEOPM_REGION_ID_UNMARKED : m_region_id[rank];
+            ++result_it;
         }
-        return result;
     }
 
-    std::vector<double> KprofileIOSample::per_cpu_runtime(uint64_t region_id) const
+    void KprofileIOSample::per_cpu_runtime(uint64_t region_id,
+                                           std::vector<double> &result) const
     {
-        std::vector<double> result(m_cpu_rank.size(), 0.0);
+        result.assign(m_cpu_rank.size(), 0.0);
         const std::vector<double> &rank_runtimes = m_epoch_regulator.region_regulator(region_id).per_rank_last_runtime();
         int cpu_idx = 0;
         for (auto rank : m_cpu_rank) {
@@ -226,10 +292,42 @@ namespace geopm
                                 GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
             }
 #endif
-            result[cpu_idx] = rank_runtimes[rank];
+            if (rank != -1) {
+                result[cpu_idx] = rank_runtimes[rank];
+            }
             ++cpu_idx;
         }
-        return result;
+    }
+
+    void KprofileIOSample::per_cpu_runtime(std::vector<double> &result) const
+    {
+        result.resize(m_cpu_rank.size());
+        // Ranks usually share a region, so only query the regulator
+        // when the region changes from one CPU to the next.
+        bool is_cached = false;
+        uint64_t cached_rid = GEOPM_REGION_ID_UNMARKED;
+        const std::vector<double> *rank_runtimes = nullptr;
+        auto result_it = result.begin();
+        for (auto rank : m_cpu_rank) {
+            *result_it = 0.0;
+            if (rank != -1) {
+                uint64_t rid = m_region_id[rank];
+                if (!is_cached || rid != cached_rid) {
+                    rank_runtimes = &m_epoch_regulator.region_regulator(rid).per_rank_last_runtime();
+                    cached_rid = rid;
+                    is_cached = true;
+                }
+#ifdef GEOPM_DEBUG
+                if (rank >= (int)rank_runtimes->size()) {
+                    throw Exception("KprofileIOSample::per_cpu_runtime: node-local rank "
+                                    "for rank " + std::to_string(rank) + " not found in map.",
+                                    GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+                }
+#endif
+                *result_it = (*rank_runtimes)[rank];
+            }
+            ++result_it;
+        }
     }
 
     double KprofileIOSample::total_app_runtime(void) const
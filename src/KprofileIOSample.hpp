@@ -34,7 +34,6 @@
 #define KPROFILEIOSAMPLE_HPP_INCLUDE
 
 #include <vector>
-#include <map>
 #include <memory>
 #include <list>
 
@@ -42,8 +41,8 @@
 
 namespace geopm
 {
-    template <typename T> class CircularBuffer;
     class IEpochRuntimeRegulator;
+    class IPlatformIO;
 
     class IKprofileIOSample
     {
@@ -59,16 +58,39 @@ namespace geopm
             ///        which is the region of the rank running on that
             ///        CPU.
             virtual std::vector<uint64_t> per_cpu_region_id(void) const = 0;
+            /// @brief Fill a caller provided vector with the region
+            ///        ID that each CPU is running.
+            /// @param [out] result Vector sized to the number of
+            ///        CPUs; it is resized if it does not match.
+            virtual void per_cpu_region_id(std::vector<uint64_t> &result) const = 0;
             /// @brief Return the current progress through the region
             ///        on each CPU.
             /// @param [in] extrapolation_time The timestamp to use to
             ///        estimate the current progress through the
             ///        region based on the previous two samples.
             virtual std::vector<double> per_cpu_progress(const struct geopm_time_s &extrapolation_time) const = 0;
-            /// @brief Return the last runtime of the given region
-            ///        for the rank running on each CPU.
+            /// @brief Fill a caller provided vector with the current
+            ///        progress through the region on each CPU.
+            /// @param [in] extrapolation_time The timestamp to use to
+            ///        estimate the current progress.
+            /// @param [out] result Vector sized to the number of
+            ///        CPUs; it is resized if it does not match.
+            virtual void per_cpu_progress(const struct geopm_time_s &extrapolation_time,
+                                          std::vector<double> &result) const = 0;
+            /// @brief Fill a caller provided vector with the last
+            ///        runtime of the given region for the rank running
+            ///        on each CPU.
             /// @param [in] region_id Region ID for the region of interest.
-            virtual std::vector<double> per_cpu_runtime(uint64_t region_id) const = 0;
+            /// @param [out] result Vector sized to the number of
+            ///        CPUs; it is resized if it does not match.
+            virtual void per_cpu_runtime(uint64_t region_id,
+                                         std::vector<double> &result) const = 0;
+            /// @brief Fill a caller provided vector with the last
+            ///        runtime of the region that each CPU is currently
+            ///        running.
+            /// @param [out] result Vector sized to the number of
+            ///        CPUs; it is resized if it does not match.
+            virtual void per_cpu_runtime(std::vector<double> &result) const = 0;
             /// @brief Return the total time from the start of the
             ///        application until now.
             virtual double total_app_runtime(void) const = 0;
@@ -80,40 +102,68 @@ namespace geopm
     {
         public:
             KprofileIOSample(const std::vector<int> &cpu_rank, IEpochRuntimeRegulator &epoch_regulator);
+            KprofileIOSample(const std::vector<int> &cpu_rank, IEpochRuntimeRegulator &epoch_regulator,
+                             IPlatformIO &platform_io);
             virtual ~KprofileIOSample();
             void finalize_unmarked_region() override;
             void update(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_begin,
                         std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_end) override;
             std::vector<uint64_t> per_cpu_region_id(void) const override;
+            void per_cpu_region_id(std::vector<uint64_t> &result) const override;
             std::vector<double> per_cpu_progress(const struct geopm_time_s &extrapolation_time) const override;
-            std::vector<double> per_cpu_runtime(uint64_t region_id) const override;
+            void per_cpu_progress(const struct geopm_time_s &extrapolation_time,
+                                  std::vector<double> &result) const override;
+            void per_cpu_runtime(uint64_t region_id,
+                                 std::vector<double> &result) const override;
+            void per_cpu_runtime(std::vector<double> &result) const override;
             double total_app_runtime(void) const override;
             std::vector<int> cpu_rank(void) const override;
         private:
-            struct m_rank_sample_s {
-                struct geopm_time_s timestamp;
-                double progress;
-            };
             enum m_interp_type_e {
                 M_INTERP_TYPE_NONE = 0,
                 M_INTERP_TYPE_NEAREST = 1,
                 M_INTERP_TYPE_LINEAR = 2,
             };
-            std::vector<double> per_rank_progress(const struct geopm_time_s &extrapolation_time) const;
+            enum {
+                /// @brief Largest ratio of MPI rank span to number of
+                ///        node local ranks for which a direct lookup
+                ///        table is used.
+                M_DENSE_SPAN_FACTOR = 4,
+            };
+            /// @brief Translate an MPI rank reported in the profile
+            ///        samples into the node local rank index.
+            int local_rank(int rank) const;
+            /// @brief Record a progress sample for a node local
+            ///        rank, keeping only the last two.
+            void insert_sample(int local_rank, const struct geopm_time_s &timestamp, double progress);
+            /// @brief Interpolated progress of a node local rank.
+            double rank_progress(int local_rank, const struct geopm_time_s &extrapolation_time) const;
 
             struct geopm_time_s m_app_start_time;
-            /// @brief A map from the MPI rank reported in the
-            ///        ProfileSampler data to the node local rank
-            ///        index.
-            std::map<int, int> m_rank_idx_map;
             IEpochRuntimeRegulator &m_epoch_regulator;
-            /// @brief The rank index of the rank running on each CPU.
+            /// @brief The rank index of the rank running on each
+            ///        CPU, or -1 if no rank is running on the CPU.
             std::vector<int> m_cpu_rank;
             /// @brief Number of ranks running on the node.
             size_t m_num_rank;
-            /// @brief Per rank record of last profile samples in
-            ///        m_region_id_prev
-            std::vector<CircularBuffer<struct m_rank_sample_s> > m_rank_sample_buffer;
+            /// @brief Smallest MPI rank running on the node.
+            int m_rank_min;
+            /// @brief Node local rank index for each MPI rank offset
+            ///        by m_rank_min, -1 for ranks not on the node.
+            ///        Used when the node's ranks are densely packed.
+            std::vector<int> m_rank_dense_idx;
+            /// @brief Sorted MPI ranks running on the node.  Used
+            ///        for lookup when m_rank_dense_idx is empty.
+            std::vector<int> m_rank_sorted;
+            /// @brief Number of valid samples (0, 1 or 2) stored
+            ///        for each rank.
+            std::vector<int> m_sample_count;
+            /// @brief Timestamps of the last two samples for each
+            ///        rank, oldest first, indexed by 2 * rank + i.
+            std::vector<struct geopm_time_s> m_sample_time;
+            /// @brief Progress of the last two samples for each
+            ///        rank, oldest first, indexed by 2 * rank + i.
+            std::vector<double> m_sample_progress;
             /// @brief The region_id of each rank derived from the
             ///        stored ProfileSampler data used for
             ///        extrapolation.
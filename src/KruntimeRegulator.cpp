@@ -42,7 +42,8 @@ namespace geopm
 
     KruntimeRegulator::KruntimeRegulator(int num_rank)
         : m_num_rank(num_rank)
-        , m_rank_log(m_num_rank, m_log_s {M_TIME_ZERO, 0.0, 0.0, 0})
+        , m_rank_log(m_num_rank, m_log_s {M_TIME_ZERO, 0.0, 0})
+        , m_last_runtime(m_num_rank, 0.0)
     {
         if (m_num_rank <= 0) {
             throw Exception("KruntimeRegulator::KruntimeRegulator(): invalid max rank count",
@@ -75,19 +76,15 @@ namespace geopm
         }
 
         double delta = geopm_time_diff(&m_rank_log[rank].enter_time, &exit_time);
-        m_rank_log[rank].last_runtime = delta;
+        m_last_runtime[rank] = delta;
         m_rank_log[rank].enter_time = M_TIME_ZERO; // record exit
         m_rank_log[rank].total_runtime += delta;
         ++m_rank_log[rank].count;
     }
 
-    std::vector<double> KruntimeRegulator::per_rank_last_runtime(void) const
+    const std::vector<double> &KruntimeRegulator::per_rank_last_runtime(void) const
     {
-        std::vector<double> result(m_num_rank);
-        for (int rr = 0; rr < m_num_rank; ++rr) {
-            result[rr] = m_rank_log[rr].last_runtime;
-        }
-        return result;
+        return m_last_runtime;
     }
 
     std::vector<double> KruntimeRegulator::per_rank_total_runtime(void) const
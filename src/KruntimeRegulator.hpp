@@ -62,8 +62,9 @@ namespace geopm
             ///        last time it entered and exited the region.  If
             ///        a rank has not entered and exited the region,
             ///        the runtime will be 0.
-            /// @return Last runtime for each rank.
-            virtual std::vector<double> per_rank_last_runtime(void) const = 0;
+            /// @return Last runtime for each rank, valid until the
+            ///         next call to record_exit().
+            virtual const std::vector<double> &per_rank_last_runtime(void) const = 0;
             /// @brief Returns the total accumulated runtime for each
             ///        rank that has entered and exited the region at
             ///        least once.
@@ -86,7 +87,7 @@ namespace geopm
             virtual ~KruntimeRegulator() = default;
             void record_entry(int rank, struct geopm_time_s entry_time) override;
             void record_exit(int rank, struct geopm_time_s exit_time) override;
-            std::vector<double> per_rank_last_runtime(void) const override;
+            const std::vector<double> &per_rank_last_runtime(void) const override;
             std::vector<double> per_rank_total_runtime(void) const override;
             std::vector<double> per_rank_count(void) const override;
         protected:
@@ -95,12 +96,12 @@ namespace geopm
             };
             struct m_log_s {
                 struct geopm_time_s enter_time;
-                double last_runtime;
                 double total_runtime;
                 size_t count;
             };
             int m_num_rank;
             std::vector<struct m_log_s> m_rank_log;
+            std::vector<double> m_last_runtime;
     };
 }
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <time.h>
+#include <algorithm>
+
+#include "LoopScheduler.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    constexpr double LoopScheduler::M_SPIN_SEC_DEFAULT;
+
+    LoopScheduler::LoopScheduler(double period, double spin_sec)
+        : m_period(period)
+        , m_spin_sec(spin_sec)
+        , m_deadline{{0, 0}}
+        , m_num_loop(0)
+        , m_num_overrun(0)
+        , m_num_wake(0)
+        , m_jitter_sum(0.0)
+        , m_jitter_max(0.0)
+    {
+        if (period <= 0.0 || spin_sec < 0.0 || spin_sec > period) {
+            throw Exception("LoopScheduler::LoopScheduler(): period must be positive and spin time must be between zero and the period",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    LoopScheduler::LoopScheduler(double period)
+        : LoopScheduler(period, std::min(period, M_SPIN_SEC_DEFAULT))
+    {
+
+    }
+
+    void LoopScheduler::time_now(struct geopm_time_s *now)
+    {
+        // clock_nanosleep() does not accept CLOCK_MONOTONIC_RAW which
+        // is what geopm_time() reads, so all deadlines are tracked
+        // against CLOCK_MONOTONIC.
+        (void) clock_gettime(CLOCK_MONOTONIC, &(now->t));
+    }
+
+    void LoopScheduler::wait(void)
+    {
+        struct geopm_time_s now;
+        time_now(&now);
+        if (!m_num_loop) {
+            // Arm on first use so that set up done between
+            // construction and the first loop is not an overrun.
+            geopm_time_add(&now, m_period, &m_deadline);
+        }
+        if (!geopm_time_comp(&now, &m_deadline)) {
+            // The loop body ran past the deadline: do not sleep and do
+            // not try to catch up on missed periods.
+            ++m_num_overrun;
+            geopm_time_add(&now, m_period, &m_deadline);
+        }
+        else {
+            double sleep_sec = geopm_time_diff(&now, &m_deadline) - m_spin_sec;
+            if (sleep_sec > 0.0) {
+                struct geopm_time_s wake;
+                geopm_time_add(&now, sleep_sec, &wake);
+                int err;
+                do {
+                    err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &(wake.t), NULL);
+                } while (err == EINTR);
+                if (err) {
+                    throw Exception("LoopScheduler::wait(): clock_nanosleep() failed",
+                                    err, __FILE__, __LINE__);
+                }
+                time_now(&now);
+            }
+            while (geopm_time_comp(&now, &m_deadline)) {
+                time_now(&now);
+            }
+            // Lateness of the return with respect to the deadline
+            double jitter = geopm_time_diff(&m_deadline, &now);
+            m_jitter_sum += jitter;
+            m_jitter_max = std::max(m_jitter_max, jitter);
+            ++m_num_wake;
+            geopm_time_add(&m_deadline, m_period, &m_deadline);
+        }
+        ++m_num_loop;
+    }
+
+    size_t LoopScheduler::num_loop(void) const
+    {
+        return m_num_loop;
+    }
+
+    size_t LoopScheduler::num_overrun(void) const
+    {
+        return m_num_overrun;
+    }
+
+    double LoopScheduler::jitter_mean(void) const
+    {
+        double result = 0.0;
+        if (m_num_wake) {
+            result = m_jitter_sum / m_num_wake;
+        }
+        return result;
+    }
+
+    double LoopScheduler::jitter_max(void) const
+    {
+        return m_jitter_max;
+    }
+}
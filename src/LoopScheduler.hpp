@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LOOPSCHEDULER_HPP_INCLUDE
+#define LOOPSCHEDULER_HPP_INCLUDE
+
+#include "geopm_time.h"
+
+namespace geopm
+{
+    /// @brief Paces a control loop to a fixed period using absolute
+    ///        deadlines rather than busy-waiting.
+    class ILoopScheduler
+    {
+        public:
+            ILoopScheduler() = default;
+            virtual ~ILoopScheduler() = default;
+            /// @brief Block until the next loop deadline.  The first
+            ///        call sets the first deadline one period later.
+            ///        If the deadline has already passed the call
+            ///        returns immediately, records an overrun and the
+            ///        schedule is re-anchored to the current time.
+            virtual void wait(void) = 0;
+            /// @brief Number of completed calls to wait().
+            virtual size_t num_loop(void) const = 0;
+            /// @brief Number of calls to wait() that were made after
+            ///        the deadline had already passed.
+            virtual size_t num_overrun(void) const = 0;
+            /// @brief Mean time in seconds between the scheduled
+            ///        deadline and the return from wait(), over the
+            ///        calls that were not overruns.
+            virtual double jitter_mean(void) const = 0;
+            /// @brief Largest time in seconds between the scheduled
+            ///        deadline and the return from wait() for a call
+            ///        that was not an overrun.
+            virtual double jitter_max(void) const = 0;
+    };
+
+    class LoopScheduler : public ILoopScheduler
+    {
+        public:
+            /// @brief Construct a scheduler whose first deadline is
+            ///        one period after the first call to wait().
+            /// @param [in] period Loop period in seconds.
+            /// @param [in] spin_sec Time in seconds before each
+            ///        deadline at which the scheduler stops sleeping
+            ///        and spins on the clock to finish the wait;
+            ///        zero disables the spin.
+            LoopScheduler(double period, double spin_sec);
+            /// @brief Construct a scheduler that spins for the last
+            ///        M_SPIN_SEC_DEFAULT seconds before each deadline.
+            LoopScheduler(double period);
+            virtual ~LoopScheduler() = default;
+            void wait(void) override;
+            size_t num_loop(void) const override;
+            size_t num_overrun(void) const override;
+            double jitter_mean(void) const override;
+            double jitter_max(void) const override;
+        private:
+            /// @brief Spin time that covers the typical wakeup
+            ///        latency of clock_nanosleep().
+            static constexpr double M_SPIN_SEC_DEFAULT = 200e-6;
+            static void time_now(struct geopm_time_s *now);
+            const double m_period;
+            const double m_spin_sec;
+            struct geopm_time_s m_deadline;
+            size_t m_num_loop;
+            size_t m_num_overrun;
+            size_t m_num_wake;
+            double m_jitter_sum;
+            double m_jitter_max;
+    };
+}
+
+#endif
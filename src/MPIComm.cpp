@@ -55,9 +55,17 @@ namespace geopm
     {
         public:
             CommWindow(MPI_Comm comm, void *base, size_t size);
+            CommWindow(MPI_Comm comm, size_t size, void **base);
             virtual ~CommWindow();
             void lock(bool is_exclusive, int rank, int assert);
             void unlock(int rank);
+            void lock_all(void);
+            void unlock_all(void);
+            void flush(int rank);
+            void flush_local(int rank);
+            void sync(void);
+            bool is_unified(void);
+            void *shared_query(int rank);
             void put(const void *send_buf, size_t send_size, int rank, off_t disp);
 #ifndef GEOPM_TEST
         private:
@@ -320,6 +328,71 @@ namespace geopm
         ((CommWindow *) window_id)->unlock(rank);
     }
 
+    bool MPIComm::is_node_local(void) const
+    {
+        bool result = false;
+        if (is_valid()) {
+            MPI_Comm shm_comm = MPI_COMM_NULL;
+            int shm_size = 0;
+            check_mpi(PMPI_Comm_split_type(m_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &shm_comm));
+            check_mpi(PMPI_Comm_size(shm_comm, &shm_size));
+            check_mpi(PMPI_Comm_free(&shm_comm));
+            // Every rank must agree, otherwise some would create a
+            // shared window and others would not.
+            result = test(shm_size == num_rank());
+        }
+        return result;
+    }
+
+    size_t MPIComm::window_create_shared(size_t size, void **base)
+    {
+        CommWindow *win_handle = new CommWindow(m_comm, size, base);
+        m_windows.insert((size_t) win_handle);
+        return (size_t) win_handle;
+    }
+
+    void *MPIComm::window_shared_query(size_t window_id, int rank) const
+    {
+        check_window(window_id);
+        return ((CommWindow *) window_id)->shared_query(rank);
+    }
+
+    void MPIComm::window_lock_all(size_t window_id) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->lock_all();
+    }
+
+    void MPIComm::window_unlock_all(size_t window_id) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->unlock_all();
+    }
+
+    void MPIComm::window_flush(size_t window_id, int rank) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->flush(rank);
+    }
+
+    void MPIComm::window_flush_local(size_t window_id, int rank) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->flush_local(rank);
+    }
+
+    void MPIComm::window_sync(size_t window_id) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->sync();
+    }
+
+    bool MPIComm::window_is_unified(size_t window_id) const
+    {
+        check_window(window_id);
+        return ((CommWindow *) window_id)->is_unified();
+    }
+
     void MPIComm::coordinate(int rank, std::vector<int> &coord) const
     {
         size_t in_size = coord.size();
@@ -362,6 +435,13 @@ namespace geopm
         }
     }
 
+    void MPIComm::reduce_sum(double *send_buf, double *recv_buf, size_t count, int root) const
+    {
+        if (is_valid()) {
+            check_mpi(PMPI_Reduce(send_buf, recv_buf, count, MPI_DOUBLE, MPI_SUM, root, m_comm));
+        }
+    }
+
     bool MPIComm::test(bool is_true) const
     {
         int is_all_true = 0;
@@ -416,6 +496,11 @@ namespace geopm
         check_mpi(PMPI_Win_create(base, (MPI_Aint) size, 1, MPI_INFO_NULL, comm, &m_window));
     }
 
+    CommWindow::CommWindow(MPI_Comm comm, size_t size, void **base)
+    {
+        check_mpi(PMPI_Win_allocate_shared((MPI_Aint) size, 1, MPI_INFO_NULL, comm, base, &m_window));
+    }
+
     CommWindow::~CommWindow()
     {
         check_mpi(PMPI_Win_free(&m_window));
@@ -431,6 +516,48 @@ namespace geopm
         check_mpi(PMPI_Win_unlock(rank, m_window));
     }
 
+    void CommWindow::lock_all(void)
+    {
+        check_mpi(PMPI_Win_lock_all(0, m_window));
+    }
+
+    void CommWindow::unlock_all(void)
+    {
+        check_mpi(PMPI_Win_unlock_all(m_window));
+    }
+
+    void CommWindow::flush(int rank)
+    {
+        check_mpi(PMPI_Win_flush(rank, m_window));
+    }
+
+    void CommWindow::flush_local(int rank)
+    {
+        check_mpi(PMPI_Win_flush_local(rank, m_window));
+    }
+
+    void CommWindow::sync(void)
+    {
+        check_mpi(PMPI_Win_sync(m_window));
+    }
+
+    bool CommWindow::is_unified(void)
+    {
+        int *model = nullptr;
+        int is_set = 0;
+        check_mpi(PMPI_Win_get_attr(m_window, MPI_WIN_MODEL, &model, &is_set));
+        return is_set && *model == MPI_WIN_UNIFIED;
+    }
+
+    void *CommWindow::shared_query(int rank)
+    {
+        MPI_Aint size = 0;
+        int disp_unit = 0;
+        void *result = nullptr;
+        check_mpi(PMPI_Win_shared_query(m_window, rank, &size, &disp_unit, &result));
+        return result;
+    }
+
     void CommWindow::put(const void *send_buf, size_t send_size, int rank, off_t disp)
     {
         check_mpi(PMPI_Put(GEOPM_MPI_CONST_CAST(void *)(send_buf), send_size, MPI_BYTE, rank, disp,
@@ -83,10 +83,20 @@ namespace geopm
             virtual std::vector<int> coordinate(int rank) const override;
             virtual void window_lock(size_t window_id, bool is_exclusive, int rank, int assert) const override;
             virtual void window_unlock(size_t window_id, int rank) const override;
+            virtual bool is_node_local(void) const override;
+            virtual size_t window_create_shared(size_t size, void **base) override;
+            virtual void *window_shared_query(size_t window_id, int rank) const override;
+            virtual void window_lock_all(size_t window_id) const override;
+            virtual void window_unlock_all(size_t window_id) const override;
+            virtual void window_flush(size_t window_id, int rank) const override;
+            virtual void window_flush_local(size_t window_id, int rank) const override;
+            virtual void window_sync(size_t window_id) const override;
+            virtual bool window_is_unified(size_t window_id) const override;
             virtual void barrier(void) const override;
             virtual void broadcast(void *buffer, size_t size, int root) const override;
             virtual bool test(bool is_true) const override;
             virtual void reduce_max(double *send_buf, double *recv_buf, size_t count, int root) const override;
+            virtual void reduce_sum(double *send_buf, double *recv_buf, size_t count, int root) const override;
             virtual void gather(const void *send_buf, size_t send_size, void *recv_buf,
                                 size_t recv_size, int root) const override;
             virtual void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
@@ -230,6 +230,7 @@ namespace geopm
         for (auto it = signal.begin(); it != signal.end(); ++it, ++idx) {
             m_signal_map.insert(std::pair<std::string, int>(it->first, idx));
             m_signal_encode[idx] = new MSREncode(it->second);
+            m_signal_field.push_back(it->second);
         }
         idx = 0;
         for (auto it = control.begin(); it != control.end(); ++it, ++idx) {
@@ -360,6 +361,15 @@ namespace geopm
         return m_signal_encode[signal_idx]->decode_function();
     }
 
+    struct IMSR::m_encode_s MSR::signal_encode(int signal_idx) const
+    {
+        if (signal_idx < 0 || signal_idx >= num_signal()) {
+            throw Exception("MSR::signal_encode(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_signal_field[signal_idx];
+    }
+
     MSRSignal::MSRSignal(const IMSR &msr_obj,
                          int domain_type,
                          int cpu_idx,
@@ -147,6 +147,11 @@ namespace geopm
             /// @brief The function used to decode the MSR value as defined
             ///        in the m_function_e enum.
             virtual int decode_function(int signal_idx) const = 0;
+            /// @brief Description of a signal bit field, used by
+            ///        callers that decode many fields in a batch.
+            /// @param [in] signal_idx Index of the signal bit field.
+            /// @return The encode struct the signal was defined with.
+            virtual struct m_encode_s signal_encode(int signal_idx) const = 0;
     };
 
     class IMSRSignal
@@ -259,6 +264,7 @@ namespace geopm
             uint64_t mask(int control_idx) const override;
             int domain_type(void) const override;
             int decode_function(int signal_idx) const override;
+            struct m_encode_s signal_encode(int signal_idx) const override;
         private:
             void init(const std::vector<std::pair<std::string, struct IMSR::m_encode_s> > &signal,
                       const std::vector<std::pair<std::string, struct IMSR::m_encode_s> > &control);
@@ -266,6 +272,7 @@ namespace geopm
             uint64_t m_offset;
             std::vector<MSREncode *> m_signal_encode;
             std::vector<MSREncode *> m_control_encode;
+            std::vector<struct IMSR::m_encode_s> m_signal_field;
             std::map<std::string, int> m_signal_map;
             std::map<std::string, int> m_control_map;
             int m_domain_type;
@@ -35,13 +35,18 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <sched.h>
 #include <string.h>
 #include <sstream>
 #include <map>
+#include <algorithm>
 
+#include "geopm_error.h"
 #include "Exception.hpp"
 #include "MSRIO.hpp"
 #include "geopm_sched.h"
+#include "geopm_env.h"
 #include "config.h"
 
 #define GEOPM_IOC_MSR_BATCH _IOWR('c', 0xA2, struct geopm::MSRIO::m_msr_batch_array_s)
@@ -54,7 +59,25 @@ namespace geopm
 
     }
 
+    /// Thread safe description of a system error number; the fallback
+    /// read path reports errors from worker threads.
+    static std::string system_error(int err)
+    {
+        char msg[NAME_MAX];
+        geopm_error_message(err, msg, sizeof(msg));
+        return msg;
+    }
+
+    // Below this many reads the worker hand off costs more than it saves
+    static const uint32_t M_MIN_PARALLEL_OP = 64;
+
     MSRIO::MSRIO(int num_cpu)
+        : MSRIO(num_cpu, geopm_env_msr_num_worker())
+    {
+
+    }
+
+    MSRIO::MSRIO(int num_cpu, int num_worker)
         : m_num_cpu(num_cpu)
         , m_file_desc(m_num_cpu + 1, -1) // Last file descriptor is for the batch file
         , m_is_batch_enabled(true)
@@ -62,12 +85,37 @@ namespace geopm
         , m_write_batch({0, NULL})
         , m_read_batch_op(0)
         , m_write_batch_op(0)
+        , m_num_worker(num_worker)
+        , m_worker_generation(0)
+        , m_worker_num_busy(0)
+        , m_is_worker_stop(false)
+        , m_is_worker_init(false)
+        , m_read_group_next(0)
+        , m_read_output(NULL)
     {
-
+        if (m_num_worker < 0) {
+            throw Exception("MSRIO: num_worker must not be negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int err = pthread_mutex_init(&m_worker_mutex, NULL);
+        if (!err) {
+            err = pthread_cond_init(&m_worker_cond, NULL);
+        }
+        if (!err) {
+            err = pthread_cond_init(&m_worker_done_cond, NULL);
+        }
+        if (err) {
+            throw Exception("MSRIO: failed to initialize pthread synchronization",
+                            err, __FILE__, __LINE__);
+        }
     }
 
     MSRIO::~MSRIO()
     {
+        worker_stop();
+        (void)pthread_cond_destroy(&m_worker_done_cond);
+        (void)pthread_cond_destroy(&m_worker_cond);
+        (void)pthread_mutex_destroy(&m_worker_mutex);
         for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
             close_msr(cpu_idx);
         }
@@ -82,7 +130,7 @@ namespace geopm
         if (num_read != sizeof(result)) {
             std::ostringstream err_str;
             err_str << "MSRIO::read_msr(): pread() failed at offset 0x" << std::hex << offset
-                    << " system error: " << strerror(errno);
+                    << " system error: " << system_error(errno);
             throw Exception(err_str.str(), GEOPM_ERROR_MSR_WRITE, __FILE__, __LINE__);
         }
         return result;
@@ -100,14 +148,21 @@ namespace geopm
                     << " write_mask=0x" << write_mask;
             throw Exception(err_str.str(), GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        // The MSR may be one write_batch() also writes
+        std::fill(m_is_write_last_valid.begin(), m_is_write_last_valid.end(), false);
         uint64_t write_value = read_msr(cpu_idx, offset);
         write_value &= ~write_mask;
         write_value |= raw_value;
-        size_t num_write = pwrite(msr_desc(cpu_idx), &write_value, sizeof(write_value), offset);
-        if (num_write != sizeof(write_value)) {
+        msr_pwrite(cpu_idx, offset, write_value);
+    }
+
+    void MSRIO::msr_pwrite(int cpu_idx, uint64_t offset, uint64_t value)
+    {
+        size_t num_write = pwrite(msr_desc(cpu_idx), &value, sizeof(value), offset);
+        if (num_write != sizeof(value)) {
             std::ostringstream err_str;
-            err_str << "MSRIO::write_msr(): pwrite() failed at offset 0x" << std::hex << offset
-                    << " system error: " << strerror(errno);
+            err_str << "MSRIO::msr_pwrite(): pwrite() failed at offset 0x" << std::hex << offset
+                    << " system error: " << system_error(errno);
             throw Exception(err_str.str(), GEOPM_ERROR_MSR_WRITE, __FILE__, __LINE__);
         }
     }
@@ -142,6 +197,16 @@ namespace geopm
         m_read_batch.numops = m_read_batch_op.size();
         m_read_batch.ops = m_read_batch_op.data();
 
+        m_read_cpu_group.clear();
+        std::map<int, size_t> cpu_group_idx;
+        for (uint32_t batch_idx = 0; batch_idx != m_read_batch.numops; ++batch_idx) {
+            auto ins_ret = cpu_group_idx.emplace(read_cpu_idx[batch_idx], m_read_cpu_group.size());
+            if (ins_ret.second) {
+                m_read_cpu_group.emplace_back();
+            }
+            m_read_cpu_group[ins_ret.first->second].push_back(batch_idx);
+        }
+
         m_write_batch_op.resize(write_cpu_idx.size());
         {
             auto cpu_it = write_cpu_idx.begin();
@@ -160,24 +225,105 @@ namespace geopm
         }
         m_write_batch.numops = m_write_batch_op.size();
         m_write_batch.ops = m_write_batch_op.data();
+        m_write_last_value.assign(m_write_batch.numops, 0);
+        m_is_write_last_valid.assign(m_write_batch.numops, false);
     }
 
-    void MSRIO::msr_ioctl(bool is_read)
+    void MSRIO::msr_ioctl(struct m_msr_batch_array_s &batch)
     {
-        struct m_msr_batch_array_s *batch_ptr = is_read ? &m_read_batch : &m_write_batch;
-        int err = ioctl(msr_batch_desc(), GEOPM_IOC_MSR_BATCH, batch_ptr);
+        int err = ioctl(msr_batch_desc(), GEOPM_IOC_MSR_BATCH, &batch);
         if (err) {
             throw Exception("MSRIO::msr_ioctl(): call to ioctl() for /dev/cpu/msr_batch failed: " +
-                            std::string(" system error: ") + strerror(errno),
+                            std::string(" system error: ") + system_error(errno),
                             GEOPM_ERROR_MSR_READ, __FILE__, __LINE__);
         }
-        for (uint32_t batch_idx = 0; batch_idx != m_write_batch.numops; ++batch_idx) {
-            if (m_write_batch.ops[batch_idx].err) {
+        for (uint32_t batch_idx = 0; batch_idx != batch.numops; ++batch_idx) {
+            if (batch.ops[batch_idx].err) {
                 std::ostringstream err_str;
                 err_str << "MSRIO::msr_ioctl(): operation failed at offset 0x"
-                        << std::hex << m_write_batch.ops[batch_idx].msr
-                        << " system error: " << strerror(m_write_batch.ops[batch_idx].err);
-                throw Exception(err_str.str(), GEOPM_ERROR_MSR_WRITE, __FILE__, __LINE__);
+                        << std::hex << batch.ops[batch_idx].msr
+                        << " system error: " << system_error(batch.ops[batch_idx].err);
+                throw Exception(err_str.str(),
+                                batch.ops[batch_idx].isrdmsr ? GEOPM_ERROR_MSR_READ : GEOPM_ERROR_MSR_WRITE,
+                                __FILE__, __LINE__);
+            }
+        }
+    }
+
+    void MSRIO::read_msr_batch(const std::vector<int> &cpu_idx,
+                               const std::vector<uint64_t> &offset,
+                               std::vector<uint64_t> &raw_value)
+    {
+        if (cpu_idx.size() != offset.size()) {
+            throw Exception("MSRIO::read_msr_batch(): Input vector length mismatch",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t num_op = cpu_idx.size();
+        raw_value.resize(num_op);
+        open_msr_batch();
+        if (m_is_batch_enabled && num_op) {
+            std::vector<struct m_msr_batch_op_s> batch_op(num_op);
+            for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+                batch_op[op_idx] = {(uint16_t)cpu_idx[op_idx], 1, 0,
+                                    (uint32_t)offset[op_idx], 0, 0};
+            }
+            struct m_msr_batch_array_s batch {(uint32_t)num_op, batch_op.data()};
+            msr_ioctl(batch);
+            for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+                raw_value[op_idx] = batch_op[op_idx].msrdata;
+            }
+        }
+        else {
+            for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+                raw_value[op_idx] = read_msr(cpu_idx[op_idx], offset[op_idx]);
+            }
+        }
+    }
+
+    void MSRIO::write_msr_batch(const std::vector<int> &cpu_idx,
+                                const std::vector<uint64_t> &offset,
+                                const std::vector<uint64_t> &raw_value,
+                                const std::vector<uint64_t> &write_mask)
+    {
+        if (cpu_idx.size() != offset.size() ||
+            offset.size() != raw_value.size() ||
+            raw_value.size() != write_mask.size()) {
+            throw Exception("MSRIO::write_msr_batch(): Input vector length mismatch",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t num_op = cpu_idx.size();
+        for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+            if ((raw_value[op_idx] & write_mask[op_idx]) != raw_value[op_idx]) {
+                std::ostringstream err_str;
+                err_str << "MSRIO::write_msr_batch(): raw_value does not obey write_mask, "
+                        << "raw_value=0x" << std::hex << raw_value[op_idx]
+                        << " write_mask=0x" << write_mask[op_idx];
+                throw Exception(err_str.str(), GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        // The MSRs may be ones write_batch() also writes
+        std::fill(m_is_write_last_valid.begin(), m_is_write_last_valid.end(), false);
+        open_msr_batch();
+#ifdef GEOPM_ENABLE_MSRSAFE_IOCTL_WRITE
+        if (m_is_batch_enabled && num_op) {
+            std::vector<struct m_msr_batch_op_s> batch_op(num_op);
+            for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+                batch_op[op_idx] = {(uint16_t)cpu_idx[op_idx], 0, 0, (uint32_t)offset[op_idx],
+                                    raw_value[op_idx], write_mask[op_idx]};
+            }
+            struct m_msr_batch_array_s batch {(uint32_t)num_op, batch_op.data()};
+            msr_ioctl(batch);
+        }
+        else
+#endif
+        {
+            for (size_t op_idx = 0; op_idx < num_op; ++op_idx) {
+                uint64_t old_value = read_msr(cpu_idx[op_idx], offset[op_idx]);
+                uint64_t write_value = (old_value & ~write_mask[op_idx]) | raw_value[op_idx];
+                // Leave MSRs that already hold the value untouched
+                if (write_value != old_value) {
+                    msr_pwrite(cpu_idx[op_idx], offset[op_idx], write_value);
+                }
             }
         }
     }
@@ -189,7 +335,7 @@ namespace geopm
         }
         open_msr_batch();
         if (m_is_batch_enabled) {
-            msr_ioctl(true);
+            msr_ioctl(m_read_batch);
             uint32_t batch_idx = 0;
             for (auto raw_it = raw_value.begin();
                  batch_idx != m_read_batch.numops;
@@ -197,7 +343,10 @@ namespace geopm
                 *raw_it = m_read_batch.ops[batch_idx].msrdata;
             }
         }
-        else {
+        else if (m_num_worker == 0 ||
+                 m_read_cpu_group.size() < 2 ||
+                 m_read_batch.numops < M_MIN_PARALLEL_OP ||
+                 !is_worker_ready()) {
             uint32_t batch_idx = 0;
             for (auto raw_it = raw_value.begin();
                  batch_idx != m_read_batch.numops;
@@ -206,6 +355,155 @@ namespace geopm
                                    m_read_batch_op[batch_idx].msr);
             }
         }
+        else {
+            // Open every descriptor before the workers share them
+            for (const auto &group : m_read_cpu_group) {
+                (void)msr_desc(m_read_batch_op[group[0]].cpu);
+            }
+            (void)pthread_mutex_lock(&m_worker_mutex);
+            m_read_output = raw_value.data();
+            m_read_group_next = 0;
+            m_worker_error.clear();
+            m_worker_num_busy = m_worker_thread.size();
+            ++m_worker_generation;
+            (void)pthread_cond_broadcast(&m_worker_cond);
+            (void)pthread_mutex_unlock(&m_worker_mutex);
+
+            read_cpu_group();
+
+            (void)pthread_mutex_lock(&m_worker_mutex);
+            while (m_worker_num_busy) {
+                (void)pthread_cond_wait(&m_worker_done_cond, &m_worker_mutex);
+            }
+            std::string error = m_worker_error;
+            (void)pthread_mutex_unlock(&m_worker_mutex);
+            if (!error.empty()) {
+                throw Exception(error, GEOPM_ERROR_MSR_READ, __FILE__, __LINE__);
+            }
+        }
+    }
+
+    void MSRIO::read_cpu_group(void)
+    {
+        for (size_t group_idx = __atomic_fetch_add(&m_read_group_next, 1, __ATOMIC_RELAXED);
+             group_idx < m_read_cpu_group.size();
+             group_idx = __atomic_fetch_add(&m_read_group_next, 1, __ATOMIC_RELAXED)) {
+            const std::vector<uint32_t> &group = m_read_cpu_group[group_idx];
+            int fd = m_file_desc[m_read_batch_op[group[0]].cpu];
+            for (auto batch_idx : group) {
+                uint64_t offset = m_read_batch_op[batch_idx].msr;
+                size_t num_read = pread(fd, m_read_output + batch_idx, sizeof(uint64_t), offset);
+                if (num_read != sizeof(uint64_t)) {
+                    std::ostringstream err_str;
+                    err_str << "MSRIO::read_batch(): pread() failed at offset 0x" << std::hex << offset
+                            << " system error: " << system_error(errno);
+                    (void)pthread_mutex_lock(&m_worker_mutex);
+                    if (m_worker_error.empty()) {
+                        m_worker_error = err_str.str();
+                    }
+                    (void)pthread_mutex_unlock(&m_worker_mutex);
+                }
+            }
+        }
+    }
+
+    void *MSRIO::worker_main(void *msrio)
+    {
+        static_cast<MSRIO *>(msrio)->worker_run();
+        return NULL;
+    }
+
+    bool MSRIO::is_worker_ready(void)
+    {
+        if (!m_is_worker_init) {
+            worker_start();
+        }
+        // The caller may have migrated onto a worker's CPU since the
+        // workers were started; read serially rather than compete.
+        return !m_worker_thread.empty() &&
+               std::find(m_worker_cpu.begin(), m_worker_cpu.end(),
+                         geopm_sched_get_cpu()) == m_worker_cpu.end();
+    }
+
+    void MSRIO::worker_cpu(int max_num_cpu, std::vector<int> &cpu)
+    {
+        cpu.resize(max_num_cpu);
+        int num_cpu = 0;
+        if (geopm_sched_spare_cpu(max_num_cpu, cpu.data(), &num_cpu)) {
+            num_cpu = 0;
+        }
+        cpu.resize(num_cpu);
+    }
+
+    void MSRIO::worker_start(void)
+    {
+        m_is_worker_init = true;
+        // If the caller has no spare CPU, e.g. a controller pinned to
+        // a single core, no workers are started and reads stay serial.
+        worker_cpu(m_num_worker, m_worker_cpu);
+        m_worker_thread.resize(m_worker_cpu.size());
+        for (size_t worker_idx = 0; worker_idx < m_worker_cpu.size(); ++worker_idx) {
+            pthread_attr_t attr;
+            int err = pthread_attr_init(&attr);
+            if (!err) {
+#ifdef __linux__
+                if (m_worker_cpu[worker_idx] >= 0) {
+                    cpu_set_t cpu_set;
+                    CPU_ZERO(&cpu_set);
+                    CPU_SET(m_worker_cpu[worker_idx], &cpu_set);
+                    err = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set);
+                }
+#endif
+                if (!err) {
+                    err = pthread_create(&m_worker_thread[worker_idx], &attr, worker_main, (void *)this);
+                }
+                (void)pthread_attr_destroy(&attr);
+            }
+            if (err) {
+                m_worker_thread.resize(worker_idx);
+                worker_stop();
+                throw Exception("MSRIO::worker_start(): pthread_create() failed",
+                                err, __FILE__, __LINE__);
+            }
+        }
+    }
+
+    void MSRIO::worker_stop(void)
+    {
+        if (!m_worker_thread.empty()) {
+            (void)pthread_mutex_lock(&m_worker_mutex);
+            m_is_worker_stop = true;
+            (void)pthread_cond_broadcast(&m_worker_cond);
+            (void)pthread_mutex_unlock(&m_worker_mutex);
+            for (auto &thread : m_worker_thread) {
+                (void)pthread_join(thread, NULL);
+            }
+            m_worker_thread.clear();
+            m_is_worker_stop = false;
+        }
+    }
+
+    void MSRIO::worker_run(void)
+    {
+        uint64_t generation = 0;
+        (void)pthread_mutex_lock(&m_worker_mutex);
+        while (true) {
+            while (!m_is_worker_stop && generation == m_worker_generation) {
+                (void)pthread_cond_wait(&m_worker_cond, &m_worker_mutex);
+            }
+            if (m_is_worker_stop) {
+                break;
+            }
+            generation = m_worker_generation;
+            (void)pthread_mutex_unlock(&m_worker_mutex);
+            read_cpu_group();
+            (void)pthread_mutex_lock(&m_worker_mutex);
+            --m_worker_num_busy;
+            if (!m_worker_num_busy) {
+                (void)pthread_cond_signal(&m_worker_done_cond);
+            }
+        }
+        (void)pthread_mutex_unlock(&m_worker_mutex);
     }
 
     void MSRIO::write_batch(const std::vector<uint64_t> &raw_value)
@@ -223,26 +521,42 @@ namespace geopm
                  ++raw_it, ++batch_idx) {
                 m_write_batch.ops[batch_idx].msrdata = *raw_it;
             }
-            msr_ioctl(false);
+            msr_ioctl(m_write_batch);
         }
         else
 #endif
         {
+            // The value last written is remembered so that the MSR
+            // does not need to be read before each write, and is not
+            // written at all if the value would not change.
             uint32_t batch_idx = 0;
             for (auto raw_it = raw_value.begin();
                  batch_idx != m_write_batch.numops;
                  ++raw_it, ++batch_idx) {
-                write_msr(m_write_batch_op[batch_idx].cpu,
-                          m_write_batch_op[batch_idx].msr,
-                          *raw_it,
-                          m_write_batch_op[batch_idx].wmask);
+                const struct m_msr_batch_op_s &op = m_write_batch_op[batch_idx];
+                if ((*raw_it & op.wmask) != *raw_it) {
+                    std::ostringstream err_str;
+                    err_str << "MSRIO::write_batch(): raw_value does not obey write_mask, "
+                            << "raw_value=0x" << std::hex << *raw_it
+                            << " write_mask=0x" << op.wmask;
+                    throw Exception(err_str.str(), GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                uint64_t old_value = m_is_write_last_valid[batch_idx] ?
+                                     m_write_last_value[batch_idx] :
+                                     read_msr(op.cpu, op.msr);
+                uint64_t write_value = (old_value & ~op.wmask) | *raw_it;
+                if (!m_is_write_last_valid[batch_idx] || write_value != old_value) {
+                    msr_pwrite(op.cpu, op.msr, write_value);
+                }
+                m_write_last_value[batch_idx] = write_value;
+                m_is_write_last_valid[batch_idx] = true;
             }
         }
     }
 
     int MSRIO::msr_desc(int cpu_idx)
     {
-        if (cpu_idx < 0 || cpu_idx > m_num_cpu) {
+        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
             throw Exception("MSRIO::msr_desc(): cpu_idx=" + std::to_string(cpu_idx) +
                             " out of range, num_cpu=" + std::to_string(m_num_cpu),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -288,16 +602,19 @@ namespace geopm
                 m_file_desc[cpu_idx] = open(path.c_str(), O_RDWR);
                 if (m_file_desc[cpu_idx] == -1) {
                     throw Exception("MSRIO::open_msr(): Failed to open \"" + path + "\": " +
-                                    "system error: " + strerror(errno),
+                                    "system error: " + system_error(errno),
                                     GEOPM_ERROR_MSR_OPEN, __FILE__, __LINE__);
                 }
             }
-        }
-        struct stat stat_buffer;
-        int err = fstat(m_file_desc[cpu_idx], &stat_buffer);
-        if (err) {
-            throw Exception("MSRIO::open_msr(): file descriptor invalid",
-                            GEOPM_ERROR_MSR_OPEN, __FILE__, __LINE__);
+            // Validated once when opened; the descriptor is cached
+            // until the object is destroyed.
+            struct stat stat_buffer;
+            int err = fstat(m_file_desc[cpu_idx], &stat_buffer);
+            if (err) {
+                close_msr(cpu_idx);
+                throw Exception("MSRIO::open_msr(): file descriptor invalid",
+                                GEOPM_ERROR_MSR_OPEN, __FILE__, __LINE__);
+            }
         }
     }
 
@@ -310,13 +627,14 @@ namespace geopm
             if (m_file_desc[m_num_cpu] == -1) {
                 m_is_batch_enabled = false;
             }
-        }
-        if (m_is_batch_enabled) {
-            struct stat stat_buffer;
-            int err = fstat(m_file_desc[m_num_cpu], &stat_buffer);
-            if (err) {
-                throw Exception("MSRIO::open_msr_batch(): file descriptor invalid",
-                                GEOPM_ERROR_MSR_OPEN, __FILE__, __LINE__);
+            else {
+                struct stat stat_buffer;
+                int err = fstat(m_file_desc[m_num_cpu], &stat_buffer);
+                if (err) {
+                    close_msr_batch();
+                    throw Exception("MSRIO::open_msr_batch(): file descriptor invalid",
+                                    GEOPM_ERROR_MSR_OPEN, __FILE__, __LINE__);
+                }
             }
         }
     }
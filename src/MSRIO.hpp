@@ -34,6 +34,7 @@
 #define MSRIO_HPP_INCLUDE
 
 #include <stdint.h>
+#include <pthread.h>
 #include <string>
 #include <vector>
 
@@ -65,6 +66,31 @@ namespace geopm
                                    uint64_t offset,
                                    uint64_t raw_value,
                                    uint64_t write_mask) = 0;
+            /// @brief Read a list of MSRs in one operation without
+            ///        changing the batch set up by config_batch().
+            /// @param [in] cpu_idx Logical Linux CPU index of each
+            ///        MSR to read.
+            /// @param [in] offset Offset of each MSR to read.
+            /// @param [out] raw_value The raw encoded MSR values
+            ///        read.
+            virtual void read_msr_batch(const std::vector<int> &cpu_idx,
+                                        const std::vector<uint64_t> &offset,
+                                        std::vector<uint64_t> &raw_value) = 0;
+            /// @brief Write a list of MSRs in one operation without
+            ///        changing the batch set up by config_batch().
+            ///        Only the bits set in the write mask of each MSR
+            ///        are modified.  Implementations may skip MSRs
+            ///        whose value would not change.
+            /// @param [in] cpu_idx Logical Linux CPU index of each
+            ///        MSR to write.
+            /// @param [in] offset Offset of each MSR to write.
+            /// @param [in] raw_value The raw encoded value to write
+            ///        to each MSR.
+            /// @param [in] write_mask The bits of each MSR to modify.
+            virtual void write_msr_batch(const std::vector<int> &cpu_idx,
+                                         const std::vector<uint64_t> &offset,
+                                         const std::vector<uint64_t> &raw_value,
+                                         const std::vector<uint64_t> &write_mask) = 0;
             /// @brief initialize internal data structures to batch
             ///        read/write from MSRs.
             /// @param [in] read_cpu_idx A vector of logical Linux CPU
@@ -95,6 +121,9 @@ namespace geopm
             virtual void read_batch(std::vector<uint64_t> &raw_value) = 0;
             /// @brief Batch write a set of MSRs configured by a
             ///        previous call to the batch_config() method.
+            ///        Implementations may skip MSRs whose value
+            ///        would not change since the previous
+            ///        write_batch().
             /// @param [in] raw_value The raw encoded MSR values to be
             ///        written.
             virtual void write_batch(const std::vector<uint64_t> &raw_value) = 0;
@@ -105,6 +134,20 @@ namespace geopm
         public:
             MSRIO();
             MSRIO(int num_cpu);
+            /// @brief Constructor that sets the number of threads
+            ///        that help the caller of read_batch() when the
+            ///        msr-safe batch device is not available.
+            /// @param [in] num_cpu Number of Linux logical CPUs.
+            /// @param [in] num_worker Largest number of helper
+            ///        threads.  Each is pinned to a CPU in the
+            ///        caller's affinity mask other than the one the
+            ///        caller runs on, so fewer are started if fewer
+            ///        CPUs are available.  If zero, or if no CPU is
+            ///        available, every MSR is read serially by the
+            ///        caller.  The other constructors use the
+            ///        GEOPM_MSR_NUM_WORKER environment variable,
+            ///        which defaults to zero.
+            MSRIO(int num_cpu, int num_worker);
             virtual ~MSRIO();
             uint64_t read_msr(int cpu_idx,
                               uint64_t offset) override;
@@ -112,6 +155,13 @@ namespace geopm
                            uint64_t offset,
                            uint64_t raw_value,
                            uint64_t write_mask) override;
+            void read_msr_batch(const std::vector<int> &cpu_idx,
+                                const std::vector<uint64_t> &offset,
+                                std::vector<uint64_t> &raw_value) override;
+            void write_msr_batch(const std::vector<int> &cpu_idx,
+                                 const std::vector<uint64_t> &offset,
+                                 const std::vector<uint64_t> &raw_value,
+                                 const std::vector<uint64_t> &write_mask) override;
             void config_batch(const std::vector<int> &read_cpu_idx,
                               const std::vector<uint64_t> &read_offset,
                               const std::vector<int> &write_cpu_idx,
@@ -140,7 +190,27 @@ namespace geopm
             void close_msr_batch(void);
             int msr_desc(int cpu_idx);
             int msr_batch_desc(void);
-            void msr_ioctl(bool is_read);
+            void msr_ioctl(struct m_msr_batch_array_s &batch);
+            /// @brief Write the full 64 bit value of an MSR.
+            void msr_pwrite(int cpu_idx, uint64_t offset, uint64_t value);
+            /// @brief Read the MSRs of every CPU group in the read
+            ///        batch not yet claimed by another thread.
+            void read_cpu_group(void);
+            /// @brief Start the workers on first use and check that
+            ///        the caller is not running on a worker's CPU.
+            /// @return True if read_batch() should hand off to the
+            ///         workers.
+            bool is_worker_ready(void);
+            /// @brief Choose the CPU each worker is pinned to.
+            /// @param [in] max_num_cpu Largest number of CPUs to
+            ///        return.
+            /// @param [out] cpu One CPU per worker to start; a
+            ///        negative value leaves that worker unpinned.
+            virtual void worker_cpu(int max_num_cpu, std::vector<int> &cpu);
+            void worker_start(void);
+            void worker_stop(void);
+            void worker_run(void);
+            static void *worker_main(void *msrio);
             virtual void msr_path(int cpu_idx,
                                   bool is_fallback,
                                   std::string &path);
@@ -153,6 +223,28 @@ namespace geopm
             struct m_msr_batch_array_s m_write_batch;
             std::vector<struct m_msr_batch_op_s> m_read_batch_op;
             std::vector<struct m_msr_batch_op_s> m_write_batch_op;
+            // Last value written by write_batch() for each write
+            // operation; invalidated by write_msr() and config_batch()
+            std::vector<uint64_t> m_write_last_value;
+            std::vector<bool> m_is_write_last_valid;
+            // Indices into m_read_batch_op grouped by CPU
+            std::vector<std::vector<uint32_t> > m_read_cpu_group;
+            // Fallback read worker pool
+            const int m_num_worker;
+            std::vector<pthread_t> m_worker_thread;
+            std::vector<int> m_worker_cpu;
+            pthread_mutex_t m_worker_mutex;
+            pthread_cond_t m_worker_cond;
+            pthread_cond_t m_worker_done_cond;
+            uint64_t m_worker_generation;
+            int m_worker_num_busy;
+            bool m_is_worker_stop;
+            // True once worker_start() has run, even if it started
+            // no workers because there was no spare CPU
+            bool m_is_worker_init;
+            size_t m_read_group_next;
+            uint64_t *m_read_output;
+            std::string m_worker_error;
     };
 }
 
@@ -31,6 +31,7 @@
  */
 
 #include <cpuid.h>
+#include <time.h>
 #include <cmath>
 #include <sstream>
 #include <algorithm>
@@ -41,6 +42,7 @@
 
 #include "geopm_sched.h"
 #include "geopm_hash.h"
+#include "geopm_env.h"
 #include "Exception.hpp"
 #include "MSR.hpp"
 #include "MSRIOGroup.hpp"
@@ -59,13 +61,53 @@ namespace geopm
     const MSR *msr_skx(size_t &num_msr);
     static const MSR *init_msr_arr(int cpu_id, size_t &arr_size);
 
+    namespace {
+        /// @brief Holds a pthread mutex for the lifetime of the object.
+        class MutexLock
+        {
+            public:
+                MutexLock(pthread_mutex_t &mutex)
+                    : m_mutex(mutex)
+                {
+                    int err = pthread_mutex_lock(&m_mutex);
+                    if (err) {
+                        throw Exception("MutexLock: pthread_mutex_lock() failed",
+                                        err, __FILE__, __LINE__);
+                    }
+                }
+                virtual ~MutexLock()
+                {
+                    (void)pthread_mutex_unlock(&m_mutex);
+                }
+            private:
+                pthread_mutex_t &m_mutex;
+        };
+    }
+
+    const std::string MSRIOGroup::M_BATCH_AGE_NAME = GEOPM_MSR_IO_GROUP_PLUGIN_NAME "::BATCH_AGE";
+
     MSRIOGroup::MSRIOGroup()
-        : MSRIOGroup(platform_topo(), std::unique_ptr<IMSRIO>(new MSRIO), cpuid(), geopm_sched_num_cpu())
+        : MSRIOGroup(platform_topo(), std::unique_ptr<IMSRIO>(new MSRIO), cpuid(), geopm_sched_num_cpu(),
+                     geopm_env_msr_async_period() * 1E-6, geopm_env_do_msr_save_scoped())
     {
 
     }
 
     MSRIOGroup::MSRIOGroup(IPlatformTopo &topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu)
+        : MSRIOGroup(topo, std::move(msrio), cpuid, num_cpu, 0.0)
+    {
+
+    }
+
+    MSRIOGroup::MSRIOGroup(IPlatformTopo &topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu,
+                           double async_period)
+        : MSRIOGroup(topo, std::move(msrio), cpuid, num_cpu, async_period, false)
+    {
+
+    }
+
+    MSRIOGroup::MSRIOGroup(IPlatformTopo &topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu,
+                           double async_period, bool is_save_scoped)
         : m_platform_topo(topo)
         , m_num_cpu(num_cpu)
         , m_is_active(false)
@@ -74,8 +116,43 @@ namespace geopm
         , m_cpuid(cpuid)
         , m_name_prefix(plugin_name() + "::")
         , m_per_cpu_restore(m_num_cpu)
+        , m_is_save_scoped(is_save_scoped)
+        , m_is_saved(false)
         , m_is_fixed_enabled(false)
+        , m_batch_age_idx(-1)
+        , m_read_time({{0, 0}})
+        , m_async_period(async_period)
+        , m_is_async_running(false)
+        , m_async_thread()
+        , m_async_time({{0, 0}})
+        , m_is_async_ready(false)
+        , m_is_async_stop(false)
+        , m_async_error_code(0)
     {
+        if (m_async_period < 0.0) {
+            throw Exception("MSRIOGroup: async_period must not be negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        pthread_condattr_t cond_attr;
+        int err = pthread_mutex_init(&m_msrio_mutex, NULL);
+        if (!err) {
+            err = pthread_mutex_init(&m_async_mutex, NULL);
+        }
+        if (!err) {
+            err = pthread_condattr_init(&cond_attr);
+        }
+        if (!err) {
+            // Reader thread deadlines are computed from CLOCK_MONOTONIC
+            err = pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+        }
+        if (!err) {
+            err = pthread_cond_init(&m_async_cond, &cond_attr);
+            (void)pthread_condattr_destroy(&cond_attr);
+        }
+        if (err) {
+            throw Exception("MSRIOGroup: failed to initialize pthread synchronization",
+                            err, __FILE__, __LINE__);
+        }
         size_t num_msr = 0;
         const MSR *msr_arr = init_msr_arr(cpuid, num_msr);
         for (const MSR *msr_ptr = msr_arr;
@@ -107,38 +184,35 @@ namespace geopm
 
     void MSRIOGroup::register_raw_msr_signal(const std::string &msr_name, const IMSR &msr_ptr)
     {
-        // Insert the signal name with an empty vector into the map
-        auto ins_ret = m_name_cpu_signal_map.insert(std::pair<std::string, std::vector<MSRSignal *> >(m_name_prefix + msr_name + "#", {}));
-        // Get reference to the per-cpu signal vector
-        std::vector <MSRSignal *> &cpu_signal = (*(ins_ret.first)).second;
-        // Check to see if the signal name has already been registered
-        if (!ins_ret.second) {
-            throw Exception("MSRIOGroup::register_raw_msr_signal(): msr_name " + msr_name +
-                            " was previously registered.",
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
         auto name_msr_it = m_name_msr_map.find(msr_name);
         if (name_msr_it == m_name_msr_map.end()) {
             throw Exception("MSRIOGroup::register_raw_msr_signal(): msr_name could not be found: " + msr_name,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        const IMSR &msr_obj = name_msr_it->second;
-        cpu_signal.resize(m_num_cpu, nullptr);
-        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
-            cpu_signal[cpu_idx] = new MSRSignal(msr_obj, msr_obj.domain_type(),
-                                                cpu_idx);
+        // Per-CPU signals are created on first use by cpu_signal()
+        auto ins_ret = m_name_cpu_signal_map.emplace(m_name_prefix + msr_name + "#",
+                                                     m_signal_s {&(name_msr_it->second), -1, {}});
+        // Check to see if the signal name has already been registered
+        if (!ins_ret.second) {
+            throw Exception("MSRIOGroup::register_raw_msr_signal(): msr_name " + msr_name +
+                            " was previously registered.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
     }
 
     MSRIOGroup::~MSRIOGroup()
     {
+        async_stop();
+        (void)pthread_cond_destroy(&m_async_cond);
+        (void)pthread_mutex_destroy(&m_async_mutex);
+        (void)pthread_mutex_destroy(&m_msrio_mutex);
         for (auto &ncsm : m_name_cpu_signal_map) {
-            for (auto &sig_ptr : ncsm.second) {
+            for (auto &sig_ptr : ncsm.second.cpu_signal) {
                 delete sig_ptr;
             }
         }
         for (auto &nccm : m_name_cpu_control_map) {
-            for (auto &ctl_ptr : nccm.second) {
+            for (auto &ctl_ptr : nccm.second.cpu_control) {
                 delete ctl_ptr;
             }
         }
@@ -150,6 +224,7 @@ namespace geopm
         for (const auto &sv : m_name_cpu_signal_map) {
             result.insert(sv.first);
         }
+        result.insert(M_BATCH_AGE_NAME);
         return result;
     }
 
@@ -164,7 +239,8 @@ namespace geopm
 
     bool MSRIOGroup::is_valid_signal(const std::string &signal_name) const
     {
-        return m_name_cpu_signal_map.find(signal_name) != m_name_cpu_signal_map.end();
+        return signal_name == M_BATCH_AGE_NAME ||
+               m_name_cpu_signal_map.find(signal_name) != m_name_cpu_signal_map.end();
     }
 
     bool MSRIOGroup::is_valid_control(const std::string &control_name) const
@@ -177,7 +253,10 @@ namespace geopm
         int result = IPlatformTopo::M_DOMAIN_INVALID;
         auto it = m_name_cpu_signal_map.find(signal_name);
         if (it != m_name_cpu_signal_map.end()) {
-            result = it->second[0]->domain_type();
+            result = it->second.msr->domain_type();
+        }
+        else if (signal_name == M_BATCH_AGE_NAME) {
+            result = IPlatformTopo::M_DOMAIN_BOARD;
         }
         return result;
     }
@@ -187,7 +266,7 @@ namespace geopm
         int result = IPlatformTopo::M_DOMAIN_INVALID;
         auto it = m_name_cpu_control_map.find(control_name);
         if (it != m_name_cpu_control_map.end()) {
-            result = it->second[0]->domain_type();
+            result = it->second.msr->domain_type();
         }
         return result;
     }
@@ -198,6 +277,22 @@ namespace geopm
             throw Exception("MSRIOGroup::push_signal(): cannot push a signal after read_batch() or adjust() has been called.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        if (signal_name == M_BATCH_AGE_NAME) {
+            if (domain_type != IPlatformTopo::M_DOMAIN_BOARD) {
+                throw Exception("MSRIOGroup::push_signal(): domain_type does not match the domain of the signal.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (domain_idx != 0) {
+                throw Exception("MSRIOGroup::push_signal(): domain_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (m_batch_age_idx == -1) {
+                // Not backed by an MSR, so no read is added to the batch
+                m_batch_age_idx = m_active_signal.size();
+                m_active_signal.push_back(nullptr);
+            }
+            return m_batch_age_idx;
+        }
         if (!m_is_fixed_enabled) {
             enable_fixed_counters();
         }
@@ -218,10 +313,14 @@ namespace geopm
         std::set<int> cpu_idx;
         m_platform_topo.domain_cpus(domain_type, domain_idx, cpu_idx);
 
+        MSRSignal *registered_signal = cpu_signal(ncsm_it->second, *(cpu_idx.begin()));
         int result = -1;
         bool is_found = false;
         // Check if signal was already pushed
         for (size_t ii = 0; !is_found && ii < m_active_signal.size(); ++ii) {
+            if ((int)ii == m_batch_age_idx) {
+                continue;
+            }
 #ifdef GEOPM_DEBUG
             if (!m_active_signal[ii]) {
                 throw Exception("MSRIOGroup::push_signal(): NULL MSRSignal pointer was saved in active signals",
@@ -229,7 +328,7 @@ namespace geopm
             }
 #endif
             // signal_name may be alias, so use active signal MSR name
-            std::string registered_name = ncsm_it->second[*(cpu_idx.begin())]->name();
+            std::string registered_name = registered_signal->name();
             if (m_active_signal[ii]->name() == registered_name &&
                 m_active_signal[ii]->cpu_idx() == *(cpu_idx.begin())) {
                 result = ii;
@@ -239,7 +338,7 @@ namespace geopm
 
         if (!is_found) {
             result = m_active_signal.size();
-            m_active_signal.push_back(ncsm_it->second[*(cpu_idx.begin())]);
+            m_active_signal.push_back(registered_signal);
             MSRSignal *msr_sig = m_active_signal[result];
 #ifdef GEOPM_DEBUG
             if (!msr_sig) {
@@ -250,6 +349,7 @@ namespace geopm
             uint64_t offset = msr_sig->offset();
             m_read_cpu_idx.push_back(*(cpu_idx.begin()));
             m_read_offset.push_back(offset);
+            push_decode(ncsm_it->second);
         }
         return result;
     }
@@ -282,6 +382,7 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
+        MSRControl *registered_control = cpu_control(nccm_it->second, *(cpu_idx.begin()));
         int result = -1;
         bool is_found = false;
         // Check if control was already pushed
@@ -293,7 +394,7 @@ namespace geopm
             }
 #endif
             // control_name may be alias, so use active control MSR name
-            std::string registered_name = nccm_it->second[*(cpu_idx.begin())]->name();
+            std::string registered_name = registered_control->name();
             if (m_active_control[ii][0]->name() == registered_name &&
                 m_active_control[ii][0]->cpu_idx() == *(cpu_idx.begin())) {
                 result = ii;
@@ -309,8 +410,14 @@ namespace geopm
                 // for power only set the first cpu in the package; others are lowered
                 cpu_idx = {*cpu_idx.begin()};
             }
+            if (m_is_save_scoped && m_is_saved) {
+                const IMSR &msr_obj = *(nccm_it->second.msr);
+                save_msr(std::vector<int>(cpu_idx.begin(), cpu_idx.end()),
+                         std::vector<uint64_t>(cpu_idx.size(), msr_obj.offset()),
+                         std::vector<uint64_t>(cpu_idx.size(), msr_obj.mask(nccm_it->second.field_idx)));
+            }
             for (auto cpu : cpu_idx) {
-                MSRControl *msr_ctl = nccm_it->second[cpu];
+                MSRControl *msr_ctl = cpu_control(nccm_it->second, cpu);
                 m_active_control[result].push_back(msr_ctl);
 #ifdef GEOPM_DEBUG
                 if (!msr_ctl) {
@@ -334,9 +441,27 @@ namespace geopm
         if (!m_is_active) {
             activate();
         }
-        if (m_read_field.size()) {
-            m_msrio->read_batch(m_read_field);
+        if (m_is_async_running) {
+            MutexLock lock(m_async_mutex);
+            // Only the first call can wait; after that the most
+            // recent snapshot is consumed even if it was seen before.
+            while (!m_is_async_ready && m_async_error.empty()) {
+                (void)pthread_cond_wait(&m_async_cond, &m_async_mutex);
+            }
+            if (!m_async_error.empty()) {
+                throw Exception("MSRIOGroup::read_batch(): reader thread failed: " + m_async_error,
+                                m_async_error_code, __FILE__, __LINE__);
+            }
+            std::copy(m_async_field.begin(), m_async_field.end(), m_read_field.begin());
+            m_read_time = m_async_time;
+        }
+        else {
+            geopm_time(&m_read_time);
+            if (m_read_field.size()) {
+                m_msrio->read_batch(m_read_field);
+            }
         }
+        decode();
         m_is_read = true;
     }
 
@@ -347,7 +472,15 @@ namespace geopm
                 throw Exception("MSRIOGroup::write_batch() called before all controls were adjusted",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            m_msrio->write_batch(m_write_field);
+            // Combine the fields of all controls that share an MSR
+            std::fill(m_write_op_field.begin(), m_write_op_field.end(), 0);
+            for (size_t ctl_idx = 0; ctl_idx < m_write_field.size(); ++ctl_idx) {
+                uint64_t &op_field = m_write_op_field[m_write_op_idx[ctl_idx]];
+                op_field &= ~m_write_mask[ctl_idx];
+                op_field |= m_write_field[ctl_idx] & m_write_mask[ctl_idx];
+            }
+            MutexLock lock(m_msrio_mutex);
+            m_msrio->write_batch(m_write_op_field);
         }
     }
 
@@ -363,7 +496,14 @@ namespace geopm
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
 
-        return m_active_signal[signal_idx]->sample();
+        if (signal_idx == m_batch_age_idx) {
+            return geopm_time_since(&m_read_time);
+        }
+        // The batch age signal has no decode table entry
+        if (m_batch_age_idx != -1 && signal_idx > m_batch_age_idx) {
+            --signal_idx;
+        }
+        return m_decode_value[signal_idx];
     }
 
     void MSRIOGroup::adjust(int control_idx, double setting)
@@ -383,6 +523,22 @@ namespace geopm
 
     double MSRIOGroup::read_signal(const std::string &signal_name, int domain_type, int domain_idx)
     {
+        if (signal_name == M_BATCH_AGE_NAME) {
+            if (domain_type != IPlatformTopo::M_DOMAIN_BOARD) {
+                throw Exception("MSRIOGroup::read_signal(): domain_type requested does not match the domain of the signal.",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (domain_idx != 0) {
+                throw Exception("MSRIOGroup::read_signal(): domain_idx out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (!m_is_read) {
+                throw Exception("MSRIOGroup::read_signal(): " + M_BATCH_AGE_NAME +
+                                " is not available before read_batch() is called.",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            return geopm_time_since(&m_read_time);
+        }
         if (!m_is_fixed_enabled) {
             enable_fixed_counters();
         }
@@ -404,11 +560,14 @@ namespace geopm
         m_platform_topo.domain_cpus(domain_type, domain_idx, cpu_idx);
 
         // Copy of existing signal but map own memory
-        MSRSignal signal {*(ncsm_it->second[*(cpu_idx.begin())])};
+        MSRSignal signal {*cpu_signal(ncsm_it->second, *(cpu_idx.begin()))};
         uint64_t offset = signal.offset();
         uint64_t field = 0;
         signal.map_field(&field);
-        field = m_msrio->read_msr(*(cpu_idx.begin()), offset);
+        {
+            MutexLock lock(m_msrio_mutex);
+            field = m_msrio->read_msr(*(cpu_idx.begin()), offset);
+        }
         // @todo last value can only get updated with read batch. This means that
         // multiple calls to read_signal for a 64-bit counter will return 0
         // unless read_batch is called for those counters.
@@ -435,61 +594,124 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
+        std::set<int> cpu_idx;
+        m_platform_topo.domain_cpus(domain_type, domain_idx, cpu_idx);
         if (control_name == "POWER_PACKAGE") {
             write_control("MSR::PKG_POWER_LIMIT:PL1_LIMIT_ENABLE", domain_type, domain_idx, 1.0);
+            // as in push_control() only the first cpu in the package
+            // is saved and written
+            cpu_idx = {*cpu_idx.begin()};
+        }
+        if (m_is_save_scoped && m_is_saved) {
+            const IMSR &msr_obj = *(nccm_it->second.msr);
+            save_msr(std::vector<int>(cpu_idx.begin(), cpu_idx.end()),
+                     std::vector<uint64_t>(cpu_idx.size(), msr_obj.offset()),
+                     std::vector<uint64_t>(cpu_idx.size(), msr_obj.mask(nccm_it->second.field_idx)));
         }
-
-        std::set<int> cpu_idx;
-        m_platform_topo.domain_cpus(domain_type, domain_idx, cpu_idx);
         for (auto cpu : cpu_idx) {
-            MSRControl control = *(nccm_it->second[cpu]);
+            // Controls hold no state between writes, so a temporary
+            // is used rather than creating the per-CPU object
+            const IMSR &msr_obj = *(nccm_it->second.msr);
+            MSRControl control(msr_obj, msr_obj.domain_type(), cpu, nccm_it->second.field_idx);
             uint64_t offset = control.offset();
             uint64_t field = 0;
             uint64_t mask = 0;
             control.map_field(&field, &mask);
             control.adjust(setting);
+            MutexLock lock(m_msrio_mutex);
             m_msrio->write_msr(cpu, offset, field, mask);
         }
     }
 
     void MSRIOGroup::save_control(void)
     {
-        for (const auto &pair_it : m_name_cpu_control_map) {
-            for (MSRControl *ctl_ptr : pair_it.second) {
-                auto it = m_per_cpu_restore[ctl_ptr->cpu_idx()].find(ctl_ptr->offset());
-                if (it == m_per_cpu_restore[ctl_ptr->cpu_idx()].end()) {
-                    struct m_restore_s restore {.value = m_msrio->read_msr(ctl_ptr->cpu_idx(),
-                                                                           ctl_ptr->offset()),
-                                                .mask = ctl_ptr->mask()};
-                    m_per_cpu_restore[ctl_ptr->cpu_idx()].emplace(ctl_ptr->offset(), restore);
-                }
-                else {
-                    it->second.mask |= ctl_ptr->mask();
+        m_is_saved = true;
+        std::vector<int> save_cpu_idx;
+        std::vector<uint64_t> save_offset;
+        std::vector<uint64_t> save_mask;
+        if (m_is_save_scoped) {
+            // Controls pushed before this call; later pushes and
+            // writes are saved as they happen
+            save_cpu_idx = m_write_cpu_idx;
+            save_offset = m_write_offset;
+            save_mask = m_write_mask;
+        }
+        else {
+            // Use the registered descriptors directly so that saving
+            // does not create a control object for every CPU
+            for (const auto &pair_it : m_name_cpu_control_map) {
+                const IMSR &msr_obj = *(pair_it.second.msr);
+                uint64_t offset = msr_obj.offset();
+                uint64_t mask = msr_obj.mask(pair_it.second.field_idx);
+                for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+                    save_cpu_idx.push_back(cpu_idx);
+                    save_offset.push_back(offset);
+                    save_mask.push_back(mask);
                 }
             }
         }
-        for (auto &map_it : m_per_cpu_restore) {
-            for (auto &pair_it : map_it) {
-                pair_it.second.value &= pair_it.second.mask;
+        save_msr(save_cpu_idx, save_offset, save_mask);
+    }
+
+    void MSRIOGroup::save_msr(const std::vector<int> &cpu_idx,
+                              const std::vector<uint64_t> &offset,
+                              const std::vector<uint64_t> &mask)
+    {
+        std::vector<int> read_cpu_idx;
+        std::vector<uint64_t> read_offset;
+        for (size_t idx = 0; idx < cpu_idx.size(); ++idx) {
+            auto ins_ret = m_per_cpu_restore[cpu_idx[idx]].emplace(offset[idx], m_restore_s {0, 0});
+            if (ins_ret.second) {
+                read_cpu_idx.push_back(cpu_idx[idx]);
+                read_offset.push_back(offset[idx]);
+            }
+            ins_ret.first->second.mask |= mask[idx];
+        }
+        if (read_cpu_idx.size()) {
+            std::vector<uint64_t> raw_value;
+            {
+                MutexLock lock(m_msrio_mutex);
+                m_msrio->read_msr_batch(read_cpu_idx, read_offset, raw_value);
+            }
+            for (size_t idx = 0; idx < read_cpu_idx.size(); ++idx) {
+                m_per_cpu_restore[read_cpu_idx[idx]].at(read_offset[idx]).value = raw_value[idx];
             }
         }
     }
 
     void MSRIOGroup::restore_control(void)
     {
+        std::vector<int> restore_cpu_idx;
+        std::vector<uint64_t> restore_offset;
+        std::vector<uint64_t> restore_value;
+        std::vector<uint64_t> restore_mask;
         int cpu_idx = 0;
         for (const auto &map_it : m_per_cpu_restore) {
             for (const auto &pair_it : map_it) {
+                restore_cpu_idx.push_back(cpu_idx);
+                restore_offset.push_back(pair_it.first);
+                restore_value.push_back(pair_it.second.value & pair_it.second.mask);
+                restore_mask.push_back(pair_it.second.mask);
+            }
+            ++cpu_idx;
+        }
+        MutexLock lock(m_msrio_mutex);
+        try {
+            m_msrio->write_msr_batch(restore_cpu_idx, restore_offset,
+                                     restore_value, restore_mask);
+        }
+        catch (const Exception &e) {
+            std::cerr << e.what() << std::endl;
+            // Restore as many of the MSRs as possible
+            for (size_t idx = 0; idx < restore_cpu_idx.size(); ++idx) {
                 try {
-                    m_msrio->write_msr(cpu_idx, pair_it.first,
-                                       pair_it.second.value,
-                                       pair_it.second.mask);
+                    m_msrio->write_msr(restore_cpu_idx[idx], restore_offset[idx],
+                                       restore_value[idx], restore_mask[idx]);
                 }
                 catch (const Exception &e) {
                     std::cerr << e.what() << std::endl;
                 }
             }
-            ++cpu_idx;
         }
     }
 
@@ -563,17 +785,37 @@ namespace geopm
 
     void MSRIOGroup::activate(void)
     {
+        // Controls that share an MSR on the same CPU are written
+        // with a single masked operation.
+        std::vector<int> write_op_cpu_idx;
+        std::vector<uint64_t> write_op_offset;
+        std::vector<uint64_t> write_op_mask;
+        std::map<std::pair<int, uint64_t>, size_t> cpu_offset_op_idx;
+        m_write_op_idx.resize(m_write_cpu_idx.size());
+        for (size_t ctl_idx = 0; ctl_idx < m_write_cpu_idx.size(); ++ctl_idx) {
+            auto ins_ret = cpu_offset_op_idx.emplace(std::make_pair(m_write_cpu_idx[ctl_idx],
+                                                                    m_write_offset[ctl_idx]),
+                                                     write_op_cpu_idx.size());
+            if (ins_ret.second) {
+                write_op_cpu_idx.push_back(m_write_cpu_idx[ctl_idx]);
+                write_op_offset.push_back(m_write_offset[ctl_idx]);
+                write_op_mask.push_back(m_write_mask[ctl_idx]);
+            }
+            else {
+                write_op_mask[ins_ret.first->second] |= m_write_mask[ctl_idx];
+            }
+            m_write_op_idx[ctl_idx] = ins_ret.first->second;
+        }
+        m_write_op_field.resize(write_op_cpu_idx.size());
         m_msrio->config_batch(m_read_cpu_idx, m_read_offset,
-                              m_write_cpu_idx, m_write_offset, m_write_mask);
+                              write_op_cpu_idx, write_op_offset, write_op_mask);
         m_read_field.resize(m_read_cpu_idx.size());
         m_write_field.resize(m_write_cpu_idx.size());
+        m_decode_field.resize(m_read_field.size());
+        m_decode_last.assign(m_read_field.size(), 0);
+        m_decode_num_overflow.assign(m_read_field.size(), 0);
+        m_decode_value.assign(m_read_field.size(), NAN);
         size_t msr_idx = 0;
-        for (auto &msr_sig : m_active_signal) {
-            const uint64_t *field_ptr = &(m_read_field[msr_idx]);
-            msr_sig->map_field(field_ptr);
-            ++msr_idx;
-        }
-        msr_idx = 0;
         for (auto control : m_active_control) {
             for (auto &msr_ctl : control) {
                 uint64_t *field_ptr = &(m_write_field[msr_idx]);
@@ -583,6 +825,193 @@ namespace geopm
             }
         }
         m_is_active = true;
+        if (m_async_period != 0.0 && m_read_field.size()) {
+            async_start();
+        }
+    }
+
+    void MSRIOGroup::push_decode(const m_signal_s &signal)
+    {
+        if (signal.field_idx == -1) {
+            m_decode_function.push_back(M_DECODE_RAW);
+            m_decode_shift.push_back(0);
+            m_decode_mask.push_back(~0ULL);
+            m_decode_scalar.push_back(1.0);
+            m_decode_range.push_back(0.0);
+        }
+        else {
+            struct IMSR::m_encode_s encode = signal.msr->signal_encode(signal.field_idx);
+            int num_bit = encode.end_bit - encode.begin_bit;
+            m_decode_function.push_back(encode.function);
+            m_decode_shift.push_back(encode.begin_bit);
+            m_decode_mask.push_back((1ULL << num_bit) - 1);
+            m_decode_scalar.push_back(encode.scalar);
+            m_decode_range.push_back((double)(1ULL << num_bit));
+        }
+    }
+
+    void MSRIOGroup::decode(void)
+    {
+        size_t num_field = m_read_field.size();
+        // Extract the bit fields in a branch free loop that the
+        // compiler can vectorize
+        const uint64_t *read_field = m_read_field.data();
+        const uint64_t *shift = m_decode_shift.data();
+        const uint64_t *mask = m_decode_mask.data();
+        uint64_t *field = m_decode_field.data();
+        for (size_t idx = 0; idx < num_field; ++idx) {
+            field[idx] = (read_field[idx] >> shift[idx]) & mask[idx];
+        }
+        // Apply the decode function; the same function is seen in the
+        // same position every batch so the branches predict well
+        for (size_t idx = 0; idx < num_field; ++idx) {
+            uint64_t subfield = field[idx];
+            double result = NAN;
+            switch (m_decode_function[idx]) {
+                case IMSR::M_FUNCTION_SCALE:
+                    result = subfield * m_decode_scalar[idx];
+                    break;
+                case IMSR::M_FUNCTION_OVERFLOW:
+                    if (m_decode_last[idx] > subfield) {
+                        ++m_decode_num_overflow[idx];
+                    }
+                    result = (subfield + m_decode_range[idx] * m_decode_num_overflow[idx]) *
+                             m_decode_scalar[idx];
+                    break;
+                case IMSR::M_FUNCTION_LOG_HALF:
+                    // F = S * 2.0 ^ -X
+                    result = 1.0 / (1ULL << subfield) * m_decode_scalar[idx];
+                    break;
+                case IMSR::M_FUNCTION_7_BIT_FLOAT:
+                    // F = S * 2 ^ Y * (1.0 + Z / 4.0)
+                    // Y in bits [0:5) and Z in bits [5:7)
+                    result = (1ULL << (subfield & 0x1F)) * (1.0 + (subfield >> 5) / 4.0) *
+                             m_decode_scalar[idx];
+                    break;
+                case M_DECODE_RAW:
+                    result = geopm_field_to_signal(subfield);
+                    break;
+                default:
+                    break;
+            }
+            m_decode_last[idx] = subfield;
+            m_decode_value[idx] = result;
+        }
+    }
+
+    void *MSRIOGroup::async_main(void *msrio_group)
+    {
+        static_cast<MSRIOGroup *>(msrio_group)->async_run();
+        return NULL;
+    }
+
+    bool MSRIOGroup::async_cpu(int &cpu)
+    {
+        int num_cpu = 0;
+        int err = geopm_sched_spare_cpu(1, &cpu, &num_cpu);
+        return !err && num_cpu == 1;
+    }
+
+    void MSRIOGroup::async_start(void)
+    {
+        // Share the CPU selection of the MSRIO read workers: the
+        // reader never runs on the caller's CPU, and if the caller
+        // has no spare CPU the MSRs are read synchronously.
+        int cpu = -1;
+        if (!async_cpu(cpu)) {
+            return;
+        }
+        m_async_field.resize(m_read_field.size());
+        pthread_attr_t attr;
+        int err = pthread_attr_init(&attr);
+        if (err) {
+            throw Exception("MSRIOGroup::async_start(): pthread_attr_init() failed",
+                            err, __FILE__, __LINE__);
+        }
+#ifdef __linux__
+        if (cpu >= 0) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            CPU_SET(cpu, &cpu_set);
+            (void)pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set);
+        }
+#endif
+        err = pthread_create(&m_async_thread, &attr, async_main, (void *)this);
+        (void)pthread_attr_destroy(&attr);
+        if (err) {
+            throw Exception("MSRIOGroup::async_start(): pthread_create() failed",
+                            err, __FILE__, __LINE__);
+        }
+        m_is_async_running = true;
+    }
+
+    void MSRIOGroup::async_stop(void)
+    {
+        if (m_is_async_running) {
+            (void)pthread_mutex_lock(&m_async_mutex);
+            m_is_async_stop = true;
+            (void)pthread_cond_broadcast(&m_async_cond);
+            (void)pthread_mutex_unlock(&m_async_mutex);
+            (void)pthread_join(m_async_thread, NULL);
+            m_is_async_running = false;
+        }
+    }
+
+    void MSRIOGroup::async_run(void)
+    {
+        std::vector<uint64_t> field(m_async_field.size());
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        bool is_stop = false;
+        while (!is_stop) {
+            struct geopm_time_s read_time;
+            std::string error;
+            int error_code = 0;
+            geopm_time(&read_time);
+            try {
+                MutexLock lock(m_msrio_mutex);
+                m_msrio->read_batch(field);
+            }
+            catch (const Exception &ex) {
+                error = ex.what();
+                error_code = ex.err_value();
+            }
+            catch (const std::exception &ex) {
+                error = ex.what();
+                error_code = GEOPM_ERROR_RUNTIME;
+            }
+            // Advance the deadline by one period, but never schedule
+            // a burst of reads to catch up after falling behind.
+            struct timespec curr_time;
+            clock_gettime(CLOCK_MONOTONIC, &curr_time);
+            long long period_ns = (long long)(m_async_period * 1E9);
+            long long next_ns = (long long)deadline.tv_sec * 1000000000LL + deadline.tv_nsec + period_ns;
+            long long curr_ns = (long long)curr_time.tv_sec * 1000000000LL + curr_time.tv_nsec;
+            if (next_ns < curr_ns) {
+                next_ns = curr_ns;
+            }
+            deadline.tv_sec = next_ns / 1000000000LL;
+            deadline.tv_nsec = next_ns % 1000000000LL;
+
+            (void)pthread_mutex_lock(&m_async_mutex);
+            if (error.empty()) {
+                m_async_field.swap(field);
+                m_async_time = read_time;
+                m_is_async_ready = true;
+            }
+            else {
+                m_async_error = error;
+                m_async_error_code = error_code;
+                is_stop = true;
+            }
+            (void)pthread_cond_broadcast(&m_async_cond);
+            int err = 0;
+            while (!is_stop && !m_is_async_stop && !err) {
+                err = pthread_cond_timedwait(&m_async_cond, &m_async_mutex, &deadline);
+            }
+            is_stop = is_stop || m_is_async_stop;
+            (void)pthread_mutex_unlock(&m_async_mutex);
+        }
     }
 
     void MSRIOGroup::register_msr_signal(const std::string &msr_name)
@@ -605,18 +1034,6 @@ namespace geopm
         std::string msr_name(name_field.substr(0, colon_pos));
         std::string field_name(name_field.substr(colon_pos + 1));
 
-        // Insert the signal name with an empty vector into the map
-        auto ins_ret = m_name_cpu_signal_map.insert(std::pair<std::string, std::vector<MSRSignal *> >(signal_name, {}));
-        // Get reference to the per-cpu signal vector
-        std::vector <MSRSignal *> &cpu_signal = (*(ins_ret.first)).second;
-        // Check to see if the signal name has already been registered
-        if (!ins_ret.second) {
-            throw Exception("MSRIOGroup::register_msr_signal(): signal_name " + signal_name +
-                            " was previously registered.",
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-        cpu_signal.resize(m_num_cpu, nullptr);
-
         auto name_msr_it = m_name_msr_map.find(msr_name);
         if (name_msr_it == m_name_msr_map.end()) {
             throw Exception("MSRIOGroup::register_msr_signal(): msr_name could not be found: " + msr_name,
@@ -628,10 +1045,13 @@ namespace geopm
             throw Exception("MSRIOGroup::register_msr_signal(): field_name: " + field_name + " could not be found",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-
-        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
-            cpu_signal[cpu_idx] = new MSRSignal(msr_obj, msr_obj.domain_type(),
-                                                cpu_idx, signal_idx);
+        // Per-CPU signals are created on first use by cpu_signal()
+        auto ins_ret = m_name_cpu_signal_map.emplace(signal_name, m_signal_s {&msr_obj, signal_idx, {}});
+        // Check to see if the signal name has already been registered
+        if (!ins_ret.second) {
+            throw Exception("MSRIOGroup::register_msr_signal(): signal_name " + signal_name +
+                            " was previously registered.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
     }
 
@@ -655,19 +1075,6 @@ namespace geopm
         std::string msr_name(name_field.substr(0, colon_pos));
         std::string field_name(name_field.substr(colon_pos + 1));
 
-        // Insert the control name with an empty vector into the map
-        auto ins_ret = m_name_cpu_control_map.insert(std::pair<std::string, std::vector<MSRControl *> >(control_name, {}));
-        // Get reference to the per-cpu control vector
-        std::vector <MSRControl *> &cpu_control = (*(ins_ret.first)).second;
-        // Check to see if the control name has already been registered
-        if (!ins_ret.second) {
-            throw Exception("MSRIOGroup::register_msr_control(): control_name " + control_name +
-                            " was previously registered.",
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-
-        }
-        cpu_control.resize(m_num_cpu, NULL);
-
         auto name_msr_it = m_name_msr_map.find(msr_name);
         if (name_msr_it == m_name_msr_map.end()) {
             throw Exception("MSRIOGroup::register_msr_control(): msr_name could not be found",
@@ -679,12 +1086,48 @@ namespace geopm
             throw Exception("MSRIOGroup::register_msr_control(): field_name: " + field_name + " could not be found",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        // Per-CPU controls are created on first use by cpu_control()
+        auto ins_ret = m_name_cpu_control_map.emplace(control_name, m_control_s {&msr_obj, control_idx, {}});
+        // Check to see if the control name has already been registered
+        if (!ins_ret.second) {
+            throw Exception("MSRIOGroup::register_msr_control(): control_name " + control_name +
+                            " was previously registered.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
 
-        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
-            cpu_control[cpu_idx] = new MSRControl(msr_obj, msr_obj.domain_type(), cpu_idx, control_idx);
         }
     }
 
+    MSRSignal *MSRIOGroup::cpu_signal(m_signal_s &signal, int cpu_idx)
+    {
+        if (signal.cpu_signal.empty()) {
+            signal.cpu_signal.resize(m_num_cpu, nullptr);
+        }
+        MSRSignal *&result = signal.cpu_signal[cpu_idx];
+        if (!result) {
+            const IMSR &msr_obj = *(signal.msr);
+            if (signal.field_idx == -1) {
+                result = new MSRSignal(msr_obj, msr_obj.domain_type(), cpu_idx);
+            }
+            else {
+                result = new MSRSignal(msr_obj, msr_obj.domain_type(), cpu_idx, signal.field_idx);
+            }
+        }
+        return result;
+    }
+
+    MSRControl *MSRIOGroup::cpu_control(m_control_s &control, int cpu_idx)
+    {
+        if (control.cpu_control.empty()) {
+            control.cpu_control.resize(m_num_cpu, nullptr);
+        }
+        MSRControl *&result = control.cpu_control[cpu_idx];
+        if (!result) {
+            const IMSR &msr_obj = *(control.msr);
+            result = new MSRControl(msr_obj, msr_obj.domain_type(), cpu_idx, control.field_idx);
+        }
+        return result;
+    }
+
     std::string MSRIOGroup::plugin_name(void)
     {
         return GEOPM_MSR_IO_GROUP_PLUGIN_NAME;
@@ -36,7 +36,9 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <pthread.h>
 
+#include "geopm_time.h"
 #include "IOGroup.hpp"
 
 namespace geopm
@@ -63,6 +65,29 @@ namespace geopm
 
             MSRIOGroup();
             MSRIOGroup(IPlatformTopo &platform_topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu);
+            /// @brief Constructor that optionally offloads the batch
+            ///        read of the pushed MSRs to a dedicated thread.
+            /// @param [in] async_period Period in seconds at which
+            ///        the reader thread issues the batch read.  If
+            ///        zero, read_batch() reads the MSRs
+            ///        synchronously; otherwise read_batch() consumes
+            ///        the most recent snapshot taken by the thread.
+            ///        The thread is pinned to a CPU in the caller's
+            ///        affinity mask other than the one the caller
+            ///        runs on; if there is none the MSRs are read
+            ///        synchronously.
+            MSRIOGroup(IPlatformTopo &platform_topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu,
+                       double async_period);
+            /// @brief Constructor that optionally limits
+            ///        save_control() and restore_control() to the
+            ///        MSRs of controls that are pushed or written.
+            /// @param [in] is_save_scoped If true, the value of each
+            ///        control MSR is saved the first time it is
+            ///        pushed or written after save_control() is
+            ///        called; otherwise save_control() saves every
+            ///        control MSR on every CPU.
+            MSRIOGroup(IPlatformTopo &platform_topo, std::unique_ptr<IMSRIO> msrio, int cpuid, int num_cpu,
+                       double async_period, bool is_save_scoped);
             virtual ~MSRIOGroup();
             std::set<std::string> signal_names(void) const override;
             std::set<std::string> control_names(void) const override;
@@ -125,13 +150,66 @@ namespace geopm
                 uint64_t value;
                 uint64_t mask;
             };
+            /// @brief Registered MSR field for a signal name.  The
+            ///        per-CPU objects are only created when the
+            ///        signal is first used on that CPU.
+            struct m_signal_s {
+                const IMSR *msr;
+                // Signal field index, or -1 for the raw MSR value
+                int field_idx;
+                std::vector<MSRSignal *> cpu_signal;
+            };
+            enum m_decode_function_e {
+                // Extends IMSR::m_function_e for the raw MSR value
+                M_DECODE_RAW = -1,
+            };
+            /// @brief Registered MSR field for a control name.
+            struct m_control_s {
+                const IMSR *msr;
+                int field_idx;
+                std::vector<MSRControl *> cpu_control;
+            };
             void register_msr_signal(const std::string &signal_name, const std::string &msr_field_name);
             void register_msr_control(const std::string &control_name, const std::string &msr_field_name);
             void register_raw_msr_signal(const std::string &msr_name, const IMSR &msr_ptr);
             void enable_fixed_counters(void);
+            /// @brief Read and record the original value of the
+            ///        MSRs not yet saved, in one batch, and add the
+            ///        masks to the bits that will be restored.
+            void save_msr(const std::vector<int> &cpu_idx,
+                          const std::vector<uint64_t> &offset,
+                          const std::vector<uint64_t> &mask);
+            /// @brief Append the decode table entry for a newly
+            ///        pushed signal.
+            void push_decode(const m_signal_s &signal);
+            /// @brief Decode all pushed signals from m_read_field
+            ///        into m_decode_value.
+            void decode(void);
+            /// @brief Get the signal object for a CPU, creating it on
+            ///        first use.
+            MSRSignal *cpu_signal(m_signal_s &signal, int cpu_idx);
+            /// @brief Get the control object for a CPU, creating it
+            ///        on first use.
+            MSRControl *cpu_control(m_control_s &control, int cpu_idx);
 
             /// @brief Configure memory for all pushed signals and controls.
             void activate(void);
+            /// @brief Choose the CPU the reader thread is pinned to.
+            /// @param [out] cpu CPU for the reader thread; a negative
+            ///        value leaves the thread unpinned.
+            /// @return False if the caller has no spare CPU.
+            virtual bool async_cpu(int &cpu);
+            /// @brief Start the thread that reads the pushed MSRs
+            ///        every m_async_period seconds, unless there is
+            ///        no CPU for it other than the caller's.
+            void async_start(void);
+            /// @brief Signal the reader thread to exit and join it.
+            void async_stop(void);
+            /// @brief Body of the reader thread.
+            void async_run(void);
+            /// @brief Entry point passed to pthread_create().
+            static void *async_main(void *msrio_group);
+            static const std::string M_BATCH_AGE_NAME;
             IPlatformTopo &m_platform_topo;
             int m_num_cpu;
             bool m_is_active;
@@ -141,8 +219,8 @@ namespace geopm
             std::vector<bool> m_is_adjusted;
             // Mappings from names to all valid signals and controls
             std::map<std::string, const IMSR &> m_name_msr_map;
-            std::map<std::string, std::vector<MSRSignal *> > m_name_cpu_signal_map;
-            std::map<std::string, std::vector<MSRControl *> > m_name_cpu_control_map;
+            std::map<std::string, m_signal_s> m_name_cpu_signal_map;
+            std::map<std::string, m_control_s> m_name_cpu_control_map;
             // Pushed signals and controls only
             std::vector<MSRSignal *> m_active_signal;
             std::vector<std::vector<MSRControl *> > m_active_control;
@@ -150,14 +228,53 @@ namespace geopm
             std::vector<uint64_t> m_read_field;
             std::vector<int> m_read_cpu_idx;
             std::vector<uint64_t> m_read_offset;
+            // Decode tables over MSRs for all active signals.  These
+            // are evaluated in one pass by read_batch() so sample()
+            // is a lookup.
+            std::vector<int> m_decode_function;
+            std::vector<uint64_t> m_decode_shift;
+            std::vector<uint64_t> m_decode_mask;
+            std::vector<double> m_decode_scalar;
+            std::vector<double> m_decode_range;
+            std::vector<uint64_t> m_decode_field;
+            std::vector<uint64_t> m_decode_last;
+            std::vector<uint64_t> m_decode_num_overflow;
+            std::vector<double> m_decode_value;
             // Vectors are over MSRs for all active controls
             std::vector<uint64_t> m_write_field;
             std::vector<int> m_write_cpu_idx;
             std::vector<uint64_t> m_write_offset;
             std::vector<uint64_t> m_write_mask;
+            // Index of the combined MSR write for each active control
+            std::vector<size_t> m_write_op_idx;
+            // Vector is over unique CPU and MSR pairs written
+            std::vector<uint64_t> m_write_op_field;
             const std::string m_name_prefix;
             std::vector<std::map<uint64_t, m_restore_s> > m_per_cpu_restore;
+            const bool m_is_save_scoped;
+            // True once save_control() has been called
+            bool m_is_saved;
             bool m_is_fixed_enabled;
+            // Pushed index of the batch age signal or -1
+            int m_batch_age_idx;
+            // Time that the values in m_read_field were read
+            struct geopm_time_s m_read_time;
+            // State shared with the reader thread, only used if
+            // m_async_period is non-zero
+            const double m_async_period;
+            bool m_is_async_running;
+            pthread_t m_async_thread;
+            // Serializes all calls into m_msrio
+            pthread_mutex_t m_msrio_mutex;
+            // Protects the snapshot and the fields below it
+            pthread_mutex_t m_async_mutex;
+            pthread_cond_t m_async_cond;
+            std::vector<uint64_t> m_async_field;
+            struct geopm_time_s m_async_time;
+            bool m_is_async_ready;
+            bool m_is_async_stop;
+            std::string m_async_error;
+            int m_async_error_code;
     };
 }
 
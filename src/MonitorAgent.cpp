@@ -35,6 +35,7 @@
 #include "PlatformTopo.hpp"
 #include "Helper.hpp"
 #include "Exception.hpp"
+#include "LoopScheduler.hpp"
 #include "config.h"
 
 namespace geopm
@@ -48,13 +49,11 @@ namespace geopm
     MonitorAgent::MonitorAgent(IPlatformIO &plat_io, IPlatformTopo &topo)
         : m_platform_io(plat_io)
         , m_platform_topo(topo)
-        , m_last_wait{{0, 0}}
         , m_num_ascend(0)
         , M_SEND_PERIOD(10)
         , M_WAIT_SEC(0.005)
+        , m_loop_scheduler(geopm::make_unique<LoopScheduler>(M_WAIT_SEC))
     {
-        geopm_time(&m_last_wait);
-
         for (auto name : sample_names()) {
             m_sample_idx.push_back(m_platform_io.push_signal(name,
                                                              IPlatformTopo::M_DOMAIN_BOARD,
@@ -64,6 +63,8 @@ namespace geopm
         m_num_sample = m_sample_idx.size();
     }
 
+    MonitorAgent::~MonitorAgent() = default;
+
     std::string MonitorAgent::plugin_name(void)
     {
         return "monitor";
@@ -88,6 +89,18 @@ namespace geopm
     bool MonitorAgent::ascend(const std::vector<std::vector<double> > &in_sample,
                               std::vector<double> &out_sample)
     {
+        return ascend(ChildMatrix(in_sample), out_sample);
+    }
+
+    bool MonitorAgent::descend(const std::vector<double> &in_policy,
+                               ChildMatrix &out_policy)
+    {
+        return false;
+    }
+
+    bool MonitorAgent::ascend(const ChildMatrix &in_sample,
+                              std::vector<double> &out_sample)
+    {
 #ifdef GEOPM_DEBUG
         if (out_sample.size() != m_num_sample) {
             throw Exception("MonitorAgent::ascend(): out_sample vector not correctly sized.",
@@ -128,12 +141,12 @@ namespace geopm
 
     void MonitorAgent::wait(void)
     {
-        geopm_time_s current_time;
-        do {
-            geopm_time(&current_time);
-        }
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC);
-        geopm_time(&m_last_wait);
+        m_loop_scheduler->wait();
+    }
+
+    const ILoopScheduler *MonitorAgent::loop_scheduler(void) const
+    {
+        return m_loop_scheduler.get();
     }
 
     std::vector<std::string> MonitorAgent::policy_names(void)
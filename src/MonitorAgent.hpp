@@ -46,6 +46,7 @@ namespace geopm
 {
     class IPlatformIO;
     class IPlatformTopo;
+    class ILoopScheduler;
 
     /// @brief Agent used to do sampling only; no policy will be enforced.
     class MonitorAgent : public Agent
@@ -53,15 +54,20 @@ namespace geopm
         public:
             MonitorAgent();
             MonitorAgent(IPlatformIO &plat_io, IPlatformTopo &topo);
-            virtual ~MonitorAgent() = default;
+            virtual ~MonitorAgent();
             void init(int level, const std::vector<int> &fan_in, bool is_level_root) override;
             bool descend(const std::vector<double> &in_policy,
                          std::vector<std::vector<double> >&out_policy) override;
             bool ascend(const std::vector<std::vector<double> > &in_sample,
                         std::vector<double> &out_sample) override;
+            bool descend(const std::vector<double> &in_policy,
+                         ChildMatrix &out_policy) override;
+            bool ascend(const ChildMatrix &in_sample,
+                        std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
             void wait(void) override;
+            const ILoopScheduler *loop_scheduler(void) const override;
             std::vector<std::pair<std::string, std::string> > report_header(void) const override;
             std::vector<std::pair<std::string, std::string> > report_node(void) const override;
             std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > report_region(void) const override;
@@ -77,7 +83,6 @@ namespace geopm
 
             IPlatformIO &m_platform_io;
             IPlatformTopo &m_platform_topo;
-            geopm_time_s m_last_wait;
             std::vector<int> m_sample_idx;
             std::vector<std::function<double(const std::vector<double>&)> > m_agg_func;
             size_t m_num_sample;
@@ -85,6 +90,7 @@ namespace geopm
             size_t m_num_ascend;
             const size_t M_SEND_PERIOD;
             const double M_WAIT_SEC;
+            std::unique_ptr<ILoopScheduler> m_loop_scheduler;
     };
 }
 
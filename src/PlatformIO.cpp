@@ -289,7 +289,22 @@ namespace geopm
 
     void PlatformIO::push_region_signal_total(int signal_idx, int domain_type, int domain_idx)
     {
-        m_region_id_idx[signal_idx] = push_signal("REGION_ID#", domain_type, domain_idx);
+        if (signal_idx < 0 || signal_idx >= num_signal()) {
+            throw Exception("PlatformIO::push_region_signal_total(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int region_id_idx = push_signal("REGION_ID#", domain_type, domain_idx);
+        if ((size_t)signal_idx >= m_region_total_idx.size()) {
+            m_region_total_idx.resize(signal_idx + 1, -1);
+        }
+        int total_idx = m_region_total_idx[signal_idx];
+        if (total_idx == -1) {
+            total_idx = m_region_total.size();
+            m_region_total_idx[signal_idx] = total_idx;
+            m_region_total.push_back({signal_idx, region_id_idx, GEOPM_REGION_ID_UNDEFINED, -1,
+                                      std::vector<m_region_data_s>(m_region_id_index.size())});
+        }
+        m_region_total[total_idx].region_id_idx = region_id_idx;
     }
 
     int PlatformIO::push_control(const std::string &control_name,
@@ -345,31 +360,29 @@ namespace geopm
             throw Exception("PlatformIO::sample(): signal_idx out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        if (!m_is_active) {
+        if (!m_is_active || m_signal_value.empty()) {
             throw Exception("PlatformIO::sample(): read_batch() not called prior to call to sample()",
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
-        auto &group_idx_pair = m_active_signal[signal_idx];
-        if (group_idx_pair.first) {
-            result = group_idx_pair.first->sample(group_idx_pair.second);
-        }
-        else {
-            result = sample_combined(group_idx_pair.second);
-        }
+        result = m_signal_value[signal_idx];
         return result;
     }
 
     double PlatformIO::sample_region_total(int signal_idx, uint64_t region_id)
     {
+        if (signal_idx < 0 || (size_t)signal_idx >= m_region_total_idx.size() ||
+            m_region_total_idx[signal_idx] == -1) {
+            throw Exception("PlatformIO::sample_region_total(): signal_idx was not pushed with push_region_signal_total()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         double current_value = 0.0;
-        uint64_t curr_rid = geopm_signal_to_field(sample(m_region_id_idx.at(signal_idx)));
-        curr_rid = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, curr_rid);
-        auto idx = std::make_pair(signal_idx, region_id);
-        if (m_region_sample_data.find(idx) != m_region_sample_data.end()) {
-            const auto &data =  m_region_sample_data.at(idx);
+        const m_region_total_s &region_total = m_region_total[m_region_total_idx[signal_idx]];
+        auto region_it = m_region_id_index.find(region_id);
+        if (region_it != m_region_id_index.end()) {
+            const auto &data = region_total.region_data[region_it->second];
             current_value += data.total;
             // if currently in this region, add current value to total
-            if (region_id == curr_rid &&
+            if (region_it->second == region_total.last_region_idx &&
                 !std::isnan(data.last_entry_value)) {
                 current_value += sample(signal_idx) - data.last_entry_value;
             }
@@ -377,18 +390,89 @@ namespace geopm
         return current_value;
     }
 
-    double PlatformIO::sample_combined(int signal_idx)
+    int PlatformIO::region_index(uint64_t region_id)
     {
-        double result = NAN;
-        auto &op_func_pair = m_combined_signal.at(signal_idx);
-        std::vector<int> &operand_idx = op_func_pair.first;
-        auto &signal = op_func_pair.second;
-        std::vector<double> operands(operand_idx.size());
-        for (size_t ii = 0; ii < operands.size(); ++ii) {
-            operands[ii] = sample(operand_idx[ii]);
-        }
-        result = signal->sample(operands);
-        return result;
+        auto result = m_region_id_index.emplace(region_id, m_region_id_index.size());
+        if (result.second) {
+            for (auto &region_total : m_region_total) {
+                region_total.region_data.emplace_back();
+            }
+        }
+        return result.first->second;
+    }
+
+    void PlatformIO::update_region_total(void)
+    {
+        const double *value = m_signal_value.data();
+        for (auto &region_total : m_region_total) {
+            double signal = value[region_total.signal_idx];
+            uint64_t region_id = geopm_signal_to_field(value[region_total.region_id_idx]);
+            region_id = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, region_id);
+            // region boundary, or first time sampling this signal
+            if (region_id != region_total.last_region_id ||
+                region_total.last_region_idx == -1) {
+                int region_idx = region_index(region_id);
+                if (region_total.last_region_idx != -1) {
+                    // update total for previous region
+                    auto &last_data = region_total.region_data[region_total.last_region_idx];
+                    last_data.total += signal - last_data.last_entry_value;
+                }
+                // set start value for the region being entered
+                region_total.region_data[region_idx].last_entry_value = signal;
+                region_total.last_region_id = region_id;
+                region_total.last_region_idx = region_idx;
+            }
+        }
+    }
+
+    void PlatformIO::activate_signal(void)
+    {
+        // Operands are always pushed before the combined signal that
+        // depends on them, so signal index order is a valid
+        // evaluation order.
+        m_signal_op.clear();
+        m_signal_operand_idx.clear();
+        m_signal_op.reserve(m_active_signal.size());
+        for (size_t signal_idx = 0; signal_idx < m_active_signal.size(); ++signal_idx) {
+            const auto &group_idx_pair = m_active_signal[signal_idx];
+            m_signal_op_s op {group_idx_pair.first, group_idx_pair.second,
+                              nullptr, m_signal_operand_idx.size(), {}};
+            if (!op.group) {
+                auto &op_func_pair = m_combined_signal.at(group_idx_pair.second);
+                for (int operand_idx : op_func_pair.first) {
+                    if (operand_idx < 0 || (size_t)operand_idx >= signal_idx) {
+                        throw Exception("PlatformIO::activate_signal(): combined signal operand was not pushed before the combined signal",
+                                        GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+                    }
+                    m_signal_operand_idx.push_back(operand_idx);
+                }
+                op.combined = op_func_pair.second.get();
+                op.operand.resize(op_func_pair.first.size(), NAN);
+            }
+            m_signal_op.push_back(std::move(op));
+        }
+        m_signal_value.assign(m_active_signal.size(), NAN);
+    }
+
+    void PlatformIO::update_signal(void)
+    {
+        double *value = m_signal_value.data();
+        const int *operand_idx = m_signal_operand_idx.data();
+        size_t num_op = m_signal_op.size();
+        for (size_t signal_idx = 0; signal_idx < num_op; ++signal_idx) {
+            m_signal_op_s &op = m_signal_op[signal_idx];
+            if (op.group) {
+                value[signal_idx] = op.group->sample(op.group_idx);
+            }
+            else {
+                size_t num_operand = op.operand.size();
+                const int *op_operand_idx = operand_idx + op.operand_begin;
+                for (size_t ii = 0; ii < num_operand; ++ii) {
+                    op.operand[ii] = value[op_operand_idx[ii]];
+                }
+                value[signal_idx] = op.combined->sample(op.operand);
+            }
+        }
     }
 
     void PlatformIO::adjust(int control_idx,
@@ -412,32 +496,12 @@ namespace geopm
         for (auto &it : m_iogroup_list) {
             it->read_batch();
         }
-        m_is_active = true;
-
-        // aggregate region totals
-        for (const auto &it : m_region_id_idx) {
-            double value = sample(it.first);
-            uint64_t region_id = geopm_signal_to_field(sample(it.second));
-            region_id = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, region_id);
-            // first time sampling this signal
-            if (m_last_region_id.find(it.first) == m_last_region_id.end()) {
-                m_last_region_id[it.first] = region_id;
-                // set start value for first region to be recording this signal
-                m_region_sample_data[std::make_pair(it.first, region_id)].last_entry_value = value;
-            }
-            else {
-                uint64_t last_rid = m_last_region_id[it.first];
-                // region boundary
-                if (region_id != last_rid) {
-                    // add entry to new region
-                    m_region_sample_data[std::make_pair(it.first, region_id)].last_entry_value = value;
-                    // update total for previous region
-                    m_region_sample_data[std::make_pair(it.first, last_rid)].total +=
-                        value - m_region_sample_data.at(std::make_pair(it.first, last_rid)).last_entry_value;
-                    m_last_region_id[it.first] = region_id;
-                }
-            }
+        if (m_signal_value.size() != m_active_signal.size()) {
+            activate_signal();
         }
+        m_is_active = true;
+        update_signal();
+        update_region_total();
     }
 
     void PlatformIO::write_batch(void)
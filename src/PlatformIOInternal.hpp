@@ -37,6 +37,7 @@
 #include <list>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <functional>
 #include <tuple>
 
@@ -111,8 +112,28 @@ namespace geopm
             int push_signal_convert_domain(const std::string &signal_name,
                                            int domain_type,
                                            int domain_idx);
-            /// @brief Sample a combined signal using the saved function and operands.
-            double sample_combined(int signal_idx);
+            /// @brief Compile the pushed signals into a flat table of
+            ///        operations in evaluation order.  Called on the
+            ///        first read_batch().
+            void activate_signal(void);
+            /// @brief Evaluate every pushed signal once after the
+            ///        IOGroups have been read and store the results
+            ///        for sample().
+            void update_signal(void);
+            /// @brief Evaluation record for one pushed signal.
+            ///
+            /// Signals provided by an IOGroup have a non-null group;
+            /// combined signals refer to a range of operand indices
+            /// in m_signal_operand_idx and own a preallocated vector
+            /// that is filled with the operand values before the
+            /// combining function is called.
+            struct m_signal_op_s {
+                IOGroup *group;
+                int group_idx;
+                CombinedSignal *combined;
+                size_t operand_begin;
+                std::vector<double> operand;
+            };
             bool m_is_active;
             IPlatformTopo &m_platform_topo;
             std::list<std::shared_ptr<IOGroup> > m_iogroup_list;
@@ -122,17 +143,38 @@ namespace geopm
             std::map<std::tuple<std::string, int, int>, int> m_existing_control;
             std::map<int, std::pair<std::vector<int>,
                                     std::unique_ptr<CombinedSignal> > > m_combined_signal;
-            std::map<int, int> m_region_id_idx;
+            /// @brief Update the per-region totals from the signal
+            ///        values of the current read_batch().
+            void update_region_total(void);
+            /// @brief Return the dense index for a region ID, adding
+            ///        a new column to every region total table the
+            ///        first time an ID is seen.
+            int region_index(uint64_t region_id);
             struct m_region_data_s
             {
                 double total = 0.0;
                 double last_entry_value = NAN;
             };
-            std::map<std::pair<int, uint64_t>, m_region_data_s> m_region_sample_data;
-            // map for last region id seen in each signal's domain
-            // only used for comparison, so can leave as a double
-            std::map<int, uint64_t> m_last_region_id;
+            /// @brief State for one signal pushed with
+            ///        push_region_signal_total().
+            struct m_region_total_s
+            {
+                int signal_idx;
+                int region_id_idx;
+                uint64_t last_region_id;
+                int last_region_idx;
+                // indexed by the dense region index
+                std::vector<m_region_data_s> region_data;
+            };
+            std::vector<m_region_total_s> m_region_total;
+            // maps pushed signal index to index in m_region_total, or -1
+            std::vector<int> m_region_total_idx;
+            // interned region IDs, value is the dense region index
+            std::unordered_map<uint64_t, int> m_region_id_index;
             bool m_do_restore;
+            std::vector<m_signal_op_s> m_signal_op;
+            std::vector<int> m_signal_operand_idx;
+            std::vector<double> m_signal_value;
     };
 }
 
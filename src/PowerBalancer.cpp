@@ -34,7 +34,7 @@
 #include <cmath>
 
 #include "PowerBalancer.hpp"
-#include "CircularBuffer.hpp"
+#include "WindowStatistics.hpp"
 #include "PlatformIO.hpp"
 #include "Helper.hpp"
 #include "config.h"
@@ -61,11 +61,13 @@ namespace geopm
         , m_trial_delta(8.0)
         , m_runtime_sample(NAN)
         , m_is_target_met(false)
-        , m_runtime_buffer(make_unique<CircularBuffer<double> >(0))
+        , m_runtime_buffer(make_unique<WindowStatistics>(0))
     {
 
     }
 
+    PowerBalancer::~PowerBalancer() = default;
+
     void PowerBalancer::power_cap(double cap)
     {
         m_power_limit = cap;
@@ -132,7 +134,7 @@ namespace geopm
     double PowerBalancer::runtime_sample(void)
     {
         if (m_runtime_buffer->size() != 0) {
-            m_runtime_sample = IPlatformIO::agg_median(m_runtime_buffer->make_vector());
+            m_runtime_sample = m_runtime_buffer->median();
         }
         else {
             m_runtime_sample = IPlatformIO::agg_median(m_runtime_vec);
@@ -138,7 +138,7 @@ namespace geopm
             virtual double power_slack(void) = 0;
     };
 
-    template <typename T> class ICircularBuffer;
+    class WindowStatistics;
 
     class PowerBalancer : public IPowerBalancer
     {
@@ -148,7 +148,7 @@ namespace geopm
             /// @brief Construct a PowerBalancer object.
             PowerBalancer(double ctl_latency);
             /// @brief Destroy a PowerBalancer object.
-            virtual ~PowerBalancer() = default;
+            virtual ~PowerBalancer();
             void power_cap(double cap) override;
             double power_cap(void) const override;
             double power_limit(void) const override;
@@ -179,7 +179,7 @@ namespace geopm
             double m_trial_delta;
             double m_runtime_sample;
             bool m_is_target_met;
-            std::unique_ptr<ICircularBuffer<double> > m_runtime_buffer;
+            std::unique_ptr<WindowStatistics> m_runtime_buffer;
             std::vector<double> m_runtime_vec;
     };
 }
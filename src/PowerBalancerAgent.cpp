@@ -41,6 +41,7 @@
 #include "PlatformIO.hpp"
 #include "PlatformTopo.hpp"
 #include "Exception.hpp"
+#include "LoopScheduler.hpp"
 #include "CircularBuffer.hpp"
 
 #include "Helper.hpp"
@@ -72,8 +73,8 @@ namespace geopm
         , m_power_headroom(0.0)
         , M_POWER_MAX(m_platform_topo.num_domain(IPlatformTopo::M_DOMAIN_PACKAGE) *
                       m_platform_io.read_signal("POWER_PACKAGE_TDP", IPlatformTopo::M_DOMAIN_PACKAGE, 0))
-        , m_last_wait{{0,0}}
         , M_WAIT_SEC(0.005)
+        , m_loop_scheduler(geopm::make_unique<LoopScheduler>(M_WAIT_SEC))
         , m_policy(M_NUM_POLICY, NAN)
         , m_num_node(0)
         , M_STABILITY_FACTOR(3.0)
@@ -84,7 +85,6 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        geopm_time(&m_last_wait);
     }
 
     PowerBalancerAgent::~PowerBalancerAgent() = default;
@@ -136,10 +136,23 @@ namespace geopm
     }
 
     bool PowerBalancerAgent::descend(const std::vector<double> &policy_in, std::vector<std::vector<double> > &policy_out)
+    {
+        ChildMatrix policy_mat(policy_out);
+        bool result = descend(policy_in, policy_mat);
+        policy_out = policy_mat.rows();
+        return result;
+    }
+
+    bool PowerBalancerAgent::ascend(const std::vector<std::vector<double> > &sample_in, std::vector<double> &sample_out)
+    {
+        return ascend(ChildMatrix(sample_in), sample_out);
+    }
+
+    bool PowerBalancerAgent::descend(const std::vector<double> &policy_in, ChildMatrix &policy_out)
     {
 #ifdef GEOPM_DEBUG
         if (policy_in.size() != M_NUM_POLICY ||
-            policy_out.size() != (size_t)m_num_children) {
+            policy_out.num_child() != (size_t)m_num_children) {
             throw Exception("PowerBalancerAgent::" + std::string(__func__) + "(): policy vectors are not correctly sized.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
@@ -165,8 +178,8 @@ namespace geopm
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
             if (result) {
-                for (auto &po : policy_out) {
-                    po = m_policy;
+                for (size_t child_idx = 0; child_idx != policy_out.num_child(); ++child_idx) {
+                    policy_out.row(child_idx, m_policy);
                 }
             }
         }
@@ -185,8 +198,8 @@ namespace geopm
             m_is_step_complete = false;
             // Copy the input policy directly into each child's
             // policy.
-            for (auto &po : policy_out) {
-                po = policy_in;
+            for (size_t child_idx = 0; child_idx != policy_out.num_child(); ++child_idx) {
+                policy_out.row(child_idx, policy_in);
             }
             m_policy = policy_in;
             result = true;
@@ -194,10 +207,10 @@ namespace geopm
         return result;
     }
 
-    bool PowerBalancerAgent::ascend(const std::vector<std::vector<double> > &sample_in, std::vector<double> &sample_out)
+    bool PowerBalancerAgent::ascend(const ChildMatrix &sample_in, std::vector<double> &sample_out)
     {
 #ifdef GEOPM_DEBUG
-        if (sample_in.size() != (size_t)m_num_children ||
+        if (sample_in.num_child() != (size_t)m_num_children ||
             sample_out.size() != M_NUM_SAMPLE) {
             throw Exception("PowerBalancerAgent::ascend(): sample vectors not correctly sized.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
@@ -345,13 +358,14 @@ namespace geopm
     }
 
 
-    void PowerBalancerAgent::wait(void)    {
-        geopm_time_s current_time;
-        do {
-            geopm_time(&current_time);
-        }
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC);
-        geopm_time(&m_last_wait);
+    void PowerBalancerAgent::wait(void)
+    {
+        m_loop_scheduler->wait();
+    }
+
+    const ILoopScheduler *PowerBalancerAgent::loop_scheduler(void) const
+    {
+        return m_loop_scheduler.get();
     }
 
     std::vector<std::pair<std::string, std::string> > PowerBalancerAgent::report_header(void) const
@@ -34,6 +34,7 @@
 #define BALANCINGAGENT_HPP_INCLUDE
 
 #include <vector>
+#include <memory>
 
 #include "geopm_time.h"
 #include "Agent.hpp"
@@ -42,6 +43,7 @@ namespace geopm
 {
     class IPlatformIO;
     class IPlatformTopo;
+    class ILoopScheduler;
     template <class type>
     class ICircularBuffer;
     class IPowerBalancer;
@@ -155,9 +157,14 @@ namespace geopm
                          std::vector<std::vector<double> >&out_policy) override;
             bool ascend(const std::vector<std::vector<double> > &in_sample,
                         std::vector<double> &out_sample) override;
+            bool descend(const std::vector<double> &in_policy,
+                         ChildMatrix &out_policy) override;
+            bool ascend(const ChildMatrix &in_sample,
+                        std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
             void wait(void) override;
+            const ILoopScheduler *loop_scheduler(void) const override;
             std::vector<std::pair<std::string, std::string> > report_header(void) const override;
             std::vector<std::pair<std::string, std::string> > report_node(void) const override;
             std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > report_region(void) const override;
@@ -190,8 +197,8 @@ namespace geopm
             double m_power_slack;
             double m_power_headroom;
             const double M_POWER_MAX;
-            struct geopm_time_s m_last_wait;
             const double M_WAIT_SEC;
+            std::unique_ptr<ILoopScheduler> m_loop_scheduler;
             std::vector<double> m_policy;
             int m_num_node;
             double M_STABILITY_FACTOR;
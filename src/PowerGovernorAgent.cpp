@@ -39,7 +39,8 @@
 #include "PlatformIO.hpp"
 #include "PlatformTopo.hpp"
 #include "Exception.hpp"
-#include "CircularBuffer.hpp"
+#include "LoopScheduler.hpp"
+#include "WindowStatistics.hpp"
 
 #include "Helper.hpp"
 #include "config.h"
@@ -65,7 +66,7 @@ namespace geopm
         , m_agg_func(M_NUM_SAMPLE)
         , m_num_children(0)
         , m_last_power_budget(NAN)
-        , m_epoch_power_buf(geopm::make_unique<CircularBuffer<double> >(16)) // Magic number...
+        , m_epoch_power_buf(geopm::make_unique<WindowStatistics>(16)) // Magic number...
         , m_sample(M_PLAT_NUM_SIGNAL)
         , m_updates_per_sample(5)
         , m_ascend_count(0)
@@ -76,11 +77,10 @@ namespace geopm
         , m_num_converged(0)
         , m_num_pkg(m_platform_topo.num_domain(m_platform_io.control_domain_type("POWER_PACKAGE")))
         , m_adjusted_power(0.0)
-        , m_last_wait{{0, 0}}
         , M_WAIT_SEC(0.005)
-
+        , m_loop_scheduler(geopm::make_unique<LoopScheduler>(M_WAIT_SEC))
     {
-        geopm_time(&m_last_wait);
+
     }
 
     PowerGovernorAgent::~PowerGovernorAgent() = default;
@@ -128,6 +128,19 @@ namespace geopm
     }
 
     bool PowerGovernorAgent::descend(const std::vector<double> &policy_in, std::vector<std::vector<double> > &policy_out)
+    {
+        ChildMatrix policy_mat(policy_out);
+        bool result = descend(policy_in, policy_mat);
+        policy_out = policy_mat.rows();
+        return result;
+    }
+
+    bool PowerGovernorAgent::ascend(const std::vector<std::vector<double> > &in_sample, std::vector<double> &out_sample)
+    {
+        return ascend(ChildMatrix(in_sample), out_sample);
+    }
+
+    bool PowerGovernorAgent::descend(const std::vector<double> &policy_in, ChildMatrix &policy_out)
     {
 #ifdef GEOPM_DEBUG
         if (policy_in.size() != M_NUM_POLICY) {
@@ -138,7 +151,7 @@ namespace geopm
             throw Exception("PowerGovernorAgent::" + std::string(__func__) + "(): level 0 agent not expected to call descend.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
-        if (policy_out.size() != (size_t)m_num_children) {
+        if (policy_out.num_child() != (size_t)m_num_children) {
             throw Exception("PowerGovernorAgent::" + std::string(__func__) + "(): policy_out vector not correctly sized.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
@@ -162,7 +175,7 @@ namespace geopm
             m_last_power_budget = power_budget_in;
             // Convert power budget vector into a vector of policy vectors
             for (int child_idx = 0; child_idx != m_num_children; ++child_idx) {
-                policy_out[child_idx][M_POLICY_POWER] = power_budget_in;
+                policy_out.row(child_idx)[M_POLICY_POWER] = power_budget_in;
             }
             m_epoch_power_buf->clear();
             m_is_converged = false;
@@ -171,7 +184,7 @@ namespace geopm
         return result;
     }
 
-    bool PowerGovernorAgent::ascend(const std::vector<std::vector<double> > &in_sample, std::vector<double> &out_sample)
+    bool PowerGovernorAgent::ascend(const ChildMatrix &in_sample, std::vector<double> &out_sample)
     {
 #ifdef GEOPM_DEBUG
         if (out_sample.size() != M_NUM_SAMPLE) {
@@ -182,17 +195,17 @@ namespace geopm
             throw Exception("PowerGovernorAgent::" + std::string(__func__) + "(): level 0 agent not expected to call ascend.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
-        if (in_sample.size() != (size_t)m_num_children) {
+        if (in_sample.num_child() != (size_t)m_num_children) {
             throw Exception("PowerGovernorAgent::" + std::string(__func__) + "(): in_sample vector not correctly sized.",
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
         bool result = false;
-        m_is_sample_stable = std::all_of(in_sample.begin(), in_sample.end(),
-            [](const std::vector<double> &val)
-            {
-                return val[M_SAMPLE_IS_CONVERGED];
-            });
+        const double *is_converged = in_sample.column(M_SAMPLE_IS_CONVERGED);
+        m_is_sample_stable = true;
+        for (size_t child_idx = 0; m_is_sample_stable && child_idx != in_sample.num_child(); ++child_idx) {
+            m_is_sample_stable = is_converged[child_idx * in_sample.stride()] != 0.0;
+        }
 
         // If all children report that they are converged for the last
         // ascend period times, then aggregate the samples and send
@@ -252,7 +265,7 @@ namespace geopm
         // If we have observed more than m_min_num_converged epoch
         // calls then send median filtered power values up the tree.
         if (m_epoch_power_buf->size() > m_min_num_converged) {
-            double median = IPlatformIO::agg_median(m_epoch_power_buf->make_vector());
+            double median = m_epoch_power_buf->median();
             out_sample[M_SAMPLE_POWER] = median;
             out_sample[M_SAMPLE_IS_CONVERGED] = (median <= m_last_power_budget); // todo might want fudge factor
             out_sample[M_SAMPLE_POWER_ENFORCED] = m_adjusted_power;
@@ -263,12 +276,12 @@ namespace geopm
 
     void PowerGovernorAgent::wait()
     {
-        geopm_time_s current_time;
-        do {
-            geopm_time(&current_time);
-        }
-        while(geopm_time_diff(&m_last_wait, &current_time) < M_WAIT_SEC);
-        geopm_time(&m_last_wait);
+        m_loop_scheduler->wait();
+    }
+
+    const ILoopScheduler *PowerGovernorAgent::loop_scheduler(void) const
+    {
+        return m_loop_scheduler.get();
     }
 
     std::vector<std::pair<std::string, std::string> > PowerGovernorAgent::report_header(void) const
@@ -34,6 +34,7 @@
 #define POWERGOVERNORAGENT_HPP_INCLUDE
 
 #include <vector>
+#include <memory>
 
 #include "Agent.hpp"
 #include "geopm_time.h"
@@ -42,8 +43,8 @@ namespace geopm
 {
     class IPlatformIO;
     class IPlatformTopo;
-    template <class type>
-    class ICircularBuffer;
+    class ILoopScheduler;
+    class WindowStatistics;
     class IPowerGovernor;
 
     class PowerGovernorAgent : public Agent
@@ -77,9 +78,14 @@ namespace geopm
                          std::vector<std::vector<double> >&out_policy) override;
             bool ascend(const std::vector<std::vector<double> > &in_sample,
                         std::vector<double> &out_sample) override;
+            bool descend(const std::vector<double> &in_policy,
+                         ChildMatrix &out_policy) override;
+            bool ascend(const ChildMatrix &in_sample,
+                        std::vector<double> &out_sample) override;
             bool adjust_platform(const std::vector<double> &in_policy) override;
             bool sample_platform(std::vector<double> &out_sample) override;
             void wait(void) override;
+            const ILoopScheduler *loop_scheduler(void) const override;
             std::vector<std::pair<std::string, std::string> > report_header(void) const override;
             std::vector<std::pair<std::string, std::string> > report_node(void) const override;
             std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > report_region(void) const override;
@@ -105,7 +111,7 @@ namespace geopm
             std::vector<std::function<double(const std::vector<double>&)> > m_agg_func;
             int m_num_children;
             double m_last_power_budget;
-            std::unique_ptr<ICircularBuffer<double> > m_epoch_power_buf;
+            std::unique_ptr<WindowStatistics> m_epoch_power_buf;
             std::vector<double> m_sample;
             int m_updates_per_sample;
             int m_ascend_count;
@@ -116,8 +122,8 @@ namespace geopm
             int m_num_converged;
             int m_num_pkg;
             double m_adjusted_power;
-            geopm_time_s m_last_wait;
             const double M_WAIT_SEC;
+            std::unique_ptr<ILoopScheduler> m_loop_scheduler;
     };
 }
 
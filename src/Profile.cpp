@@ -246,7 +246,12 @@ namespace geopm
             table_shm_key += "-" + std::to_string(m_rank);
             m_table_shmem = std::unique_ptr<ISharedMemoryUser>(new SharedMemoryUser(table_shm_key, 3.0));
             m_table_shmem->unlink();
-            m_table = std::unique_ptr<IProfileTable>(new ProfileTable(m_table_shmem->size(), m_table_shmem->pointer()));
+            if (geopm_env_do_profile_ring()) {
+                m_table = std::unique_ptr<IProfileTable>(new ProfileRingTable(m_table_shmem->size(), m_table_shmem->pointer()));
+            }
+            else {
+                m_table = std::unique_ptr<IProfileTable>(new ProfileTable(m_table_shmem->size(), m_table_shmem->pointer()));
+            }
         }
 
         m_shm_comm->barrier();
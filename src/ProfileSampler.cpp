@@ -173,6 +173,15 @@ namespace geopm
         return result;
     }
 
+    size_t ProfileSampler::num_drop(void) const
+    {
+        size_t result = 0;
+        for (auto it = m_rank_sampler.begin(); it != m_rank_sampler.end(); ++it) {
+            result += (*it)->num_drop();
+        }
+        return result;
+    }
+
     void ProfileSampler::sample(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > &content, size_t &length, std::shared_ptr<Comm> comm)
     {
         length = 0;
@@ -276,12 +285,18 @@ namespace geopm
         , m_table(nullptr)
         , m_region_entry(GEOPM_INVALID_PROF_MSG)
         , m_is_name_finished(false)
+        , m_num_drop(0)
     {
         std::string key_path("/dev/shm/" + shm_key);
         (void)unlink(key_path.c_str());
         errno = 0; // Ignore errors from the unlink call.
         m_table_shmem = geopm::make_unique<SharedMemory>(shm_key, table_size);
-        m_table = geopm::make_unique<ProfileTable>(m_table_shmem->size(), m_table_shmem->pointer());
+        if (geopm_env_do_profile_ring()) {
+            m_table = geopm::make_unique<ProfileRingTable>(m_table_shmem->size(), m_table_shmem->pointer());
+        }
+        else {
+            m_table = geopm::make_unique<ProfileTable>(m_table_shmem->size(), m_table_shmem->pointer());
+        }
     }
 
     size_t ProfileRankSampler::capacity(void) const
@@ -292,7 +307,15 @@ namespace geopm
     void ProfileRankSampler::sample(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content_begin, size_t &length)
     {
         m_table->dump(content_begin, length);
-        std::stable_sort(content_begin, content_begin + length, geopm_prof_compare);
+        if (!m_table->is_ordered()) {
+            std::stable_sort(content_begin, content_begin + length, geopm_prof_compare);
+        }
+        m_num_drop = m_table->num_drop();
+    }
+
+    size_t ProfileRankSampler::num_drop(void) const
+    {
+        return m_num_drop;
     }
 
     bool ProfileRankSampler::name_fill(std::set<std::string> &name_set)
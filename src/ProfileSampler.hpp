@@ -73,6 +73,11 @@ namespace geopm
             /// @return The maximum number of samples that can possibly
             ///         be returned.
             virtual size_t capacity(void) const = 0;
+            /// @brief Number of samples the application process
+            ///        discarded because the table was full.
+            ///
+            /// @return The number of dropped samples.
+            virtual size_t num_drop(void) const = 0;
             /// @brief Retrieve region names from the application process.
             ///
             /// Coordinates with the application process to retrieve the
@@ -98,6 +103,11 @@ namespace geopm
             /// @return The maximum number of samples that can possibly
             ///         be returned.
             virtual size_t capacity(void) const = 0;
+            /// @brief Total number of samples discarded by all of
+            ///        the per-rank tables because they were full.
+            ///
+            /// @return The number of dropped samples.
+            virtual size_t num_drop(void) const = 0;
             /// @brief Returns the samples present in all the per-rank
             ///        hash tables.
             ///
@@ -204,6 +214,7 @@ namespace geopm
             /// @param [out] length The number of samples that were inserted.
             void sample(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content_begin, size_t &length) override;
             size_t capacity(void) const override;
+            size_t num_drop(void) const override;
             bool name_fill(std::set<std::string> &name_set) override;
             void report_name(std::string &report_str) const override;
             void profile_name(std::string &prof_str) const override;
@@ -228,6 +239,11 @@ namespace geopm
             std::set<std::string> m_name_set;
             /// Holds the status of the name_fill operation.
             bool m_is_name_finished;
+            /// Number of samples dropped by the table as of the
+            /// last call to sample().  Names are passed through the
+            /// same buffer, so the table count is not valid once the
+            /// name exchange begins.
+            size_t m_num_drop;
             int rank_per_node;
     };
 
@@ -270,6 +286,7 @@ namespace geopm
             /// @return The maximum number of samples that can possibly
             ///         be returned.
             size_t capacity(void) const override;
+            size_t num_drop(void) const override;
             void sample(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > &content, size_t &length, std::shared_ptr<Comm> comm) override;
             bool do_shutdown(void) const override;
             bool do_report(void) const override;
@@ -49,6 +49,12 @@
 namespace geopm
 {
     ProfileTable::ProfileTable(size_t size, void *buffer)
+        : ProfileTable(size, buffer, true)
+    {
+
+    }
+
+    ProfileTable::ProfileTable(size_t size, void *buffer, bool is_table_init)
         : m_buffer_size(size)
         , m_table_length(table_length(m_buffer_size))
         , m_mask(m_table_length - GEOPM_NUM_REGION_ID_PRIVATE - 1)
@@ -63,6 +69,9 @@ namespace geopm
         if (M_TABLE_DEPTH_MAX < 4) {
             throw Exception("ProfileTable: Table depth must be at least 4", GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
+        if (!is_table_init) {
+            return;
+        }
         struct table_entry_s table_init;
         memset((void *)&table_init, 0, sizeof(struct table_entry_s));
         pthread_mutexattr_t lock_attr;
@@ -343,6 +352,17 @@ namespace geopm
         return result;
     }
 
+    size_t ProfileTable::num_drop(void) const
+    {
+        return 0;
+    }
+
+    bool ProfileTable::is_ordered(void) const
+    {
+        // Values are grouped by hash bucket, not by insertion time.
+        return false;
+    }
+
     bool ProfileTable::sticky(const struct geopm_prof_message_s &value)
     {
         bool result = false;
@@ -351,4 +371,92 @@ namespace geopm
         }
         return result;
     }
+
+    ProfileRingTable::ProfileRingTable(size_t size, void *buffer)
+        : ProfileTable(size, buffer, false)
+        , m_header((struct ring_header_s *)buffer)
+        , m_ring((ring_entry_t *)((char *)buffer + sizeof(struct ring_header_s)))
+        , m_ring_length(ring_length(size))
+        , m_ring_mask(m_ring_length - 1)
+    {
+        memset((void *)m_header, 0, sizeof(struct ring_header_s));
+    }
+
+    size_t ProfileRingTable::ring_length(size_t buffer_size) const
+    {
+        if (buffer_size < sizeof(struct ring_header_s) + sizeof(ring_entry_t)) {
+            throw Exception("ProfileRingTable: Buffer size too small",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t result = (buffer_size - sizeof(struct ring_header_s)) / sizeof(ring_entry_t);
+        // The largest power of two that fits in the buffer so that
+        // sequence numbers can be masked into ring indices.
+        size_t pow2 = 1;
+        while (pow2 * 2 <= result) {
+            pow2 *= 2;
+        }
+        return pow2;
+    }
+
+    void ProfileRingTable::insert(uint64_t key, const struct geopm_prof_message_s &value)
+    {
+        if (key == 0) {
+            throw Exception("ProfileRingTable::insert(): zero is not a valid key", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Only the producer writes write_seq and num_drop.
+        uint64_t write_seq = __atomic_load_n(&(m_header->write_seq), __ATOMIC_RELAXED);
+        uint64_t read_seq = __atomic_load_n(&(m_header->read_seq), __ATOMIC_ACQUIRE);
+        if (write_seq - read_seq >= m_ring_length) {
+            uint64_t num_drop = __atomic_load_n(&(m_header->num_drop), __ATOMIC_RELAXED);
+            __atomic_store_n(&(m_header->num_drop), num_drop + 1, __ATOMIC_RELAXED);
+        }
+        else {
+            ring_entry_t &entry = m_ring[write_seq & m_ring_mask];
+            entry.first = key;
+            entry.second = value;
+            // Publish the entry to the consumer.
+            __atomic_store_n(&(m_header->write_seq), write_seq + 1, __ATOMIC_RELEASE);
+        }
+    }
+
+    size_t ProfileRingTable::capacity(void) const
+    {
+        return m_ring_length;
+    }
+
+    size_t ProfileRingTable::size(void) const
+    {
+        uint64_t read_seq = __atomic_load_n(&(m_header->read_seq), __ATOMIC_ACQUIRE);
+        uint64_t write_seq = __atomic_load_n(&(m_header->write_seq), __ATOMIC_ACQUIRE);
+        return write_seq - read_seq;
+    }
+
+    void ProfileRingTable::dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length)
+    {
+        // Only the consumer writes read_seq.
+        uint64_t read_seq = __atomic_load_n(&(m_header->read_seq), __ATOMIC_RELAXED);
+        uint64_t write_seq = __atomic_load_n(&(m_header->write_seq), __ATOMIC_ACQUIRE);
+        length = write_seq - read_seq;
+        if (length) {
+            // Copy out the readable span in at most two contiguous
+            // pieces: up to the end of the ring and then from the
+            // beginning.
+            size_t begin_idx = read_seq & m_ring_mask;
+            size_t head_length = std::min(length, m_ring_length - begin_idx);
+            content = std::copy(m_ring + begin_idx, m_ring + begin_idx + head_length, content);
+            std::copy(m_ring, m_ring + length - head_length, content);
+            // Release the slots back to the producer.
+            __atomic_store_n(&(m_header->read_seq), write_seq, __ATOMIC_RELEASE);
+        }
+    }
+
+    size_t ProfileRingTable::num_drop(void) const
+    {
+        return __atomic_load_n(&(m_header->num_drop), __ATOMIC_RELAXED);
+    }
+
+    bool ProfileRingTable::is_ordered(void) const
+    {
+        return true;
+    }
 }
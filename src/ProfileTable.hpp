@@ -170,6 +170,25 @@ namespace geopm
             /// @param [out] name Set of names read from output of the
             ///        producer's call to name_fill().
             virtual bool name_set(size_t header_offset, std::set<std::string> &name) = 0;
+            /// @brief Number of values that were discarded by
+            ///        insert() because the table was full.
+            ///
+            /// Implementations that throw when they cannot store a
+            /// value always return zero.
+            ///
+            /// @return The number of values dropped since the table
+            ///         was created.
+            virtual size_t num_drop(void) const = 0;
+            /// @brief Whether dump() returns values in the order
+            ///        they were inserted.
+            ///
+            /// When true, and the producer inserts values with
+            /// non-decreasing timestamps, the output of dump() is
+            /// already sorted by time and the consumer need not sort
+            /// it.
+            ///
+            /// @return True if dump() preserves insertion order.
+            virtual bool is_ordered(void) const = 0;
     };
 
     class ProfileTable : public IProfileTable
@@ -196,6 +215,22 @@ namespace geopm
             void dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length) override;
             bool name_fill(size_t header_offset) override;
             bool name_set(size_t header_offset, std::set<std::string> &name) override;
+            size_t num_drop(void) const override;
+            bool is_ordered(void) const override;
+        protected:
+            /// @brief Constructor for derived tables that use the
+            ///        buffer for their own layout.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ///
+            /// @param is_table_init [in] If false the hash table
+            ///        entries and their locks are not initialized in
+            ///        the buffer and insert() and dump() of this class
+            ///        must not be called.
+            ProfileTable(size_t size, void *buffer, bool is_table_init);
         private:
             virtual bool sticky(const struct geopm_prof_message_s &value);
             enum {
@@ -219,5 +254,66 @@ namespace geopm
             bool m_is_pshared;
             std::map<const std::string, uint64_t>::iterator m_key_map_last;
     };
+
+    /// @brief ProfileTable backed by a lock free single producer
+    ///        single consumer ring buffer.
+    ///
+    /// Values are appended to the ring by insert() in the order they
+    /// are produced and are never merged by key, so every region
+    /// entry, exit and progress update is delivered to the consumer.
+    /// The producer and the consumer synchronize only through a pair
+    /// of sequence counters stored at the head of the buffer, the
+    /// producer never blocks.  If the consumer falls behind and the
+    /// ring is full, the value is discarded and counted rather than
+    /// throwing an exception; the count is available from
+    /// num_drop().  Only one thread may call insert() and only one
+    /// thread may call dump() at any time.  The key() and name
+    /// passing methods are inherited from the ProfileTable.  Name
+    /// passing overwrites the ring header, so num_drop() must be read
+    /// before the names are exchanged.
+    class ProfileRingTable : public ProfileTable
+    {
+        public:
+            /// @brief Constructor for the ProfileRingTable.
+            ///
+            /// @param size [in] The length of the buffer in bytes.
+            ///
+            /// @param buffer [in] Pointer to beginning of virtual
+            ///        address range used for storing the data.
+            ProfileRingTable(size_t size, void *buffer);
+            /// ProfileRingTable destructor, virtual.
+            virtual ~ProfileRingTable() = default;
+            void insert(uint64_t key, const struct geopm_prof_message_s &value) override;
+            size_t capacity(void) const override;
+            size_t size(void) const override;
+            void dump(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::iterator content, size_t &length) override;
+            size_t num_drop(void) const override;
+            bool is_ordered(void) const override;
+        private:
+            enum {
+                M_CACHE_LINE_SIZE = 64,
+            };
+            /// @brief Ring state shared by the producer and consumer.
+            ///
+            /// Each counter is written by only one side and is kept
+            /// on its own cache line to avoid false sharing.
+            struct ring_header_s {
+                /// Number of values ever inserted, written by producer.
+                uint64_t write_seq;
+                char pad0[M_CACHE_LINE_SIZE - sizeof(uint64_t)];
+                /// Number of values ever dumped, written by consumer.
+                uint64_t read_seq;
+                char pad1[M_CACHE_LINE_SIZE - sizeof(uint64_t)];
+                /// Number of values dropped, written by producer.
+                uint64_t num_drop;
+                char pad2[M_CACHE_LINE_SIZE - sizeof(uint64_t)];
+            };
+            typedef std::pair<uint64_t, struct geopm_prof_message_s> ring_entry_t;
+            size_t ring_length(size_t buffer_size) const;
+            struct ring_header_s *m_header;
+            ring_entry_t *m_ring;
+            size_t m_ring_length;
+            uint64_t m_ring_mask;
+    };
 }
 #endif
@@ -40,6 +40,7 @@
 #include <numeric>
 #include <iostream>
 #include <iomanip>
+#include <cmath>
 
 #include "Reporter.hpp"
 #include "PlatformIO.hpp"
@@ -50,6 +51,7 @@
 #include "Exception.hpp"
 #include "geopm_hash.h"
 #include "geopm_version.h"
+#include "geopm_env.h"
 #include "config.h"
 
 #ifdef GEOPM_HAS_XMMINTRIN
@@ -58,10 +60,41 @@
 
 namespace geopm
 {
+    static const std::string M_SUMMARY_REGION_NAME[] = {
+        "runtime (sec)",
+        "sync-runtime (sec)",
+        "package-energy (joules)",
+        "dram-energy (joules)",
+        "frequency (%)",
+        "frequency (Hz)",
+        "mpi-runtime (sec)",
+        "count",
+    };
+    static const int M_NUM_SUMMARY_REGION_FIELD = sizeof(M_SUMMARY_REGION_NAME) / sizeof(M_SUMMARY_REGION_NAME[0]);
+    static const std::string M_SUMMARY_TOTAL_NAME[] = {
+        "runtime (sec)",
+        "package-energy (joules)",
+        "dram-energy (joules)",
+        "mpi-runtime (sec)",
+        "ignore-time (sec)",
+        "geopmctl network BW (B/sec)",
+        "profile-drop (count)",
+    };
+
     Reporter::Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank)
+        : Reporter(report_name, platform_io, rank,
+                   geopm_env_do_report_summary(), geopm_env_do_report_node_file())
+    {
+
+    }
+
+    Reporter::Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank,
+                       bool do_summary, bool do_node_file)
         : m_report_name(report_name)
         , m_platform_io(platform_io)
         , m_rank(rank)
+        , m_do_summary(do_summary)
+        , m_do_node_file(do_node_file)
     {
 
     }
@@ -96,28 +129,35 @@ namespace geopm
                             const std::vector<std::pair<std::string, std::string> > &agent_report_header,
                             const std::vector<std::pair<std::string, std::string> > &agent_node_report,
                             const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report,
+                            const std::vector<std::pair<std::string, std::string> > &controller_report,
                             const IApplicationIO &application_io,
                             std::shared_ptr<Comm> comm,
                             const ITreeComm &tree_comm)
     {
         int rank = comm->rank();
+        std::string report_name;
+        std::ostringstream header;
         std::ofstream master_report;
+        if (!rank || m_do_node_file) {
+            report_name = application_io.report_name();
+            // make header
+            header << "##### geopm " << geopm_version() << " #####" << std::endl;
+            header << "Profile: " << application_io.profile_name() << std::endl;
+            header << "Agent: " << agent_name << std::endl;
+            for (const auto &kv : agent_report_header) {
+                header << kv.first << ": " << kv.second << std::endl;
+            }
+            header << "Policy Mode: deprecated" << std::endl;
+            header << "Tree Decider: deprecated" << std::endl;
+            header << "Leaf Decider: deprecated" << std::endl;
+            header << "Power Budget: -1" << std::endl;
+        }
         if (!rank) {
-            master_report.open(application_io.report_name());
+            master_report.open(report_name);
             if (!master_report.good()) {
                 throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            // make header
-            master_report << "##### geopm " << geopm_version() << " #####" << std::endl;
-            master_report << "Profile: " << application_io.profile_name() << std::endl;
-            master_report << "Agent: " << agent_name << std::endl;
-            for (const auto &kv : agent_report_header) {
-                master_report << kv.first << ": " << kv.second << std::endl;
-            }
-            master_report << "Policy Mode: deprecated" << std::endl;
-            master_report << "Tree Decider: deprecated" << std::endl;
-            master_report << "Leaf Decider: deprecated" << std::endl;
-            master_report << "Power Budget: -1" << std::endl;
+            master_report << header.str();
         }
         // per-node report
         std::ostringstream report;
@@ -128,16 +168,7 @@ namespace geopm
             report << kv.first << ": " << kv.second << std::endl;
         }
         // vector of region data, in descending order by runtime
-        struct region_info {
-                std::string name;
-                uint64_t id;
-                double per_rank_avg_runtime;
-                double bulk_sync_runtime;
-                double energy_pkg;
-                double energy_dram;
-                int count;
-        };
-        std::vector<region_info> region_ordered;
+        std::vector<m_region_s> region_ordered;
         auto region_name_set = application_io.region_name_set();
         for (const auto &region : region_name_set) {
             uint64_t region_id = geopm_crc32_str(0, region.c_str());
@@ -159,13 +190,13 @@ namespace geopm
                                           bulk_sync_runtime,
                                           energy_pkg,
                                           energy_dram,
-                                          count});
+                                          count, 0.0, 0.0, 0.0});
             }
         }
         // sort based on element 2 of the tuple
         std::sort(region_ordered.begin(), region_ordered.end(),
-                  [] (const region_info &a,
-                      const region_info &b) -> bool {
+                  [] (const m_region_s &a,
+                      const m_region_s &b) -> bool {
                       return a.per_rank_avg_runtime >= b.per_rank_avg_runtime;
                   });
         // add unmarked and epoch at the end
@@ -180,7 +211,7 @@ namespace geopm
                                   m_platform_io.sample_region_total(m_region_bulk_runtime_idx, GEOPM_REGION_ID_UNMARKED),
                                   energy_pkg,
                                   energy_dram,
-                                  0});
+                                  0, 0.0, 0.0, 0.0});
         /// Total epoch runtime for report includes MPI time and
         /// ignore time, but they are removed from the runtime returned
         /// by the API.
@@ -192,9 +223,9 @@ namespace geopm
                                   m_platform_io.sample_region_total(m_region_bulk_runtime_idx, GEOPM_REGION_ID_EPOCH),
                                   application_io.total_epoch_energy_pkg(),
                                   application_io.total_epoch_energy_dram(),
-                                  application_io.total_count(GEOPM_REGION_ID_EPOCH)});
+                                  application_io.total_count(GEOPM_REGION_ID_EPOCH), 0.0, 0.0, 0.0});
 
-        for (const auto &region : region_ordered) {
+        for (auto &region : region_ordered) {
             uint64_t mpi_region_id = geopm_region_id_set_mpi(region.id);
             report << "Region " << region.name << " (0x" << std::hex
                    << std::setfill('0') << std::setw(16)
@@ -209,10 +240,12 @@ namespace geopm
                            m_platform_io.sample_region_total(m_clk_core_idx, mpi_region_id);
             double denom = m_platform_io.sample_region_total(m_clk_ref_idx, region.id) +
                            m_platform_io.sample_region_total(m_clk_ref_idx, mpi_region_id);
-            double freq = denom != 0 ? 100.0 * numer / denom : 0.0;
-            report << "    frequency (%): " << freq << std::endl;
-            report << "    frequency (Hz): " << freq / 100.0 * m_platform_io.read_signal("CPUINFO::FREQ_STICKER", IPlatformTopo::M_DOMAIN_BOARD, 0) << std::endl;
-            report << "    mpi-runtime (sec): " << application_io.total_region_mpi_runtime(region.id) << std::endl;
+            region.frequency = denom != 0 ? 100.0 * numer / denom : 0.0;
+            region.frequency_hz = region.frequency / 100.0 * m_platform_io.read_signal("CPUINFO::FREQ_STICKER", IPlatformTopo::M_DOMAIN_BOARD, 0);
+            region.mpi_runtime = application_io.total_region_mpi_runtime(region.id);
+            report << "    frequency (%): " << region.frequency << std::endl;
+            report << "    frequency (Hz): " << region.frequency_hz << std::endl;
+            report << "    mpi-runtime (sec): " << region.mpi_runtime << std::endl;
             report << "    count: " << region.count << std::endl;
             if (agent_region_report.find(region.id) != agent_region_report.end()) {
                 for (const auto &kv : agent_region_report.at(region.id)) {
@@ -221,17 +254,49 @@ namespace geopm
             }
         }
 
-        double total_runtime = application_io.total_app_runtime();
+        // order matches M_SUMMARY_TOTAL_NAME
+        std::vector<double> total {application_io.total_app_runtime(),
+                                   application_io.total_app_energy_pkg(),
+                                   application_io.total_app_energy_dram(),
+                                   application_io.total_app_mpi_runtime(),
+                                   application_io.total_epoch_ignore_runtime(),
+                                   0.0,
+                                   (double)application_io.total_app_num_drop()};
+        total[5] = tree_comm.overhead_send() / total[0];
         report << "Application Totals:" << std::endl
-               << "    runtime (sec): " << total_runtime << std::endl
-               << "    package-energy (joules): " << application_io.total_app_energy_pkg() << std::endl
-               << "    dram-energy (joules): " << application_io.total_app_energy_dram() << std::endl
-               << "    mpi-runtime (sec): " << application_io.total_app_mpi_runtime() << std::endl
-               << "    ignore-time (sec): " << application_io.total_epoch_ignore_runtime() << std::endl;
+               << "    runtime (sec): " << total[0] << std::endl
+               << "    package-energy (joules): " << total[1] << std::endl
+               << "    dram-energy (joules): " << total[2] << std::endl
+               << "    mpi-runtime (sec): " << total[3] << std::endl
+               << "    ignore-time (sec): " << total[4] << std::endl;
 
         std::string max_memory = get_max_memory();
         report << "    geopmctl memory HWM: " << max_memory << std::endl;
-        report << "    geopmctl network BW (B/sec): " << tree_comm.overhead_send() / total_runtime << std::endl;
+        report << "    geopmctl network BW (B/sec): " << total[5] << std::endl;
+        report << "    profile-drop (count): " << total[6] << std::endl;
+        if (!controller_report.empty()) {
+            report << "Controller:" << std::endl;
+            for (const auto &kv : controller_report) {
+                report << "    " << kv.first << ": " << kv.second << std::endl;
+            }
+        }
+
+        if (m_do_node_file) {
+            // every node writes its own detail in parallel
+            std::string node_report_name = report_name + "-" + hostname;
+            std::ofstream node_report(node_report_name);
+            if (node_report.good()) {
+                node_report << header.str() << report.str() << std::endl;
+            }
+            else {
+                std::cerr << "Warning: unable to open report file '" << node_report_name
+                          << "' for writing: " << strerror(errno) << std::endl;
+            }
+        }
+        if (m_do_summary) {
+            generate_summary(region_ordered, total, comm, rank, master_report);
+            return;
+        }
 
         // aggregate reports from every node
         report.seekp(0, std::ios::end);
@@ -266,6 +331,184 @@ namespace geopm
         }
     }
 
+    void Reporter::generate_summary(const std::vector<m_region_s> &region,
+                                    const std::vector<double> &total,
+                                    std::shared_ptr<Comm> comm,
+                                    int rank,
+                                    std::ostream &master_report)
+    {
+        int num_rank = comm->num_rank();
+        // Agree on the union of the regions seen by every node, each
+        // entry is the hex region ID and the name separated by a space.
+        std::set<std::string> local_entry;
+        for (const auto &rr : region) {
+            std::ostringstream entry;
+            entry << std::hex << rr.id << std::dec << " " << rr.name;
+            local_entry.insert(entry.str());
+        }
+        std::vector<std::string> union_entry = region_union(local_entry, comm, rank, num_rank);
+        std::map<std::string, size_t> union_idx;
+        for (size_t idx = 0; idx < union_entry.size(); ++idx) {
+            union_idx[union_entry[idx]] = idx;
+        }
+
+        // Reduce every statistic: the sums are followed by the number
+        // of nodes that saw each region, minimums are reduced as the
+        // maximum of the negated values.
+        size_t num_region = union_entry.size();
+        size_t num_value = num_region * M_NUM_SUMMARY_REGION_FIELD + total.size();
+        std::vector<double> local_sum(num_value + num_region, 0.0);
+        std::vector<double> local_max(num_value, -INFINITY);
+        std::vector<double> local_neg_min(num_value, -INFINITY);
+        auto set_value = [&] (size_t idx, double value) {
+            local_sum[idx] = value;
+            local_max[idx] = value;
+            local_neg_min[idx] = -value;
+        };
+        for (const auto &rr : region) {
+            std::ostringstream key;
+            key << std::hex << rr.id << std::dec << " " << rr.name;
+            size_t region_idx = union_idx.at(key.str());
+            size_t base = region_idx * M_NUM_SUMMARY_REGION_FIELD;
+            std::vector<double> field {rr.per_rank_avg_runtime, rr.bulk_sync_runtime,
+                                       rr.energy_pkg, rr.energy_dram, rr.frequency,
+                                       rr.frequency_hz, rr.mpi_runtime, (double)rr.count};
+            for (size_t field_idx = 0; field_idx < field.size(); ++field_idx) {
+                set_value(base + field_idx, field[field_idx]);
+            }
+            local_sum[num_value + region_idx] = 1.0;
+        }
+        for (size_t total_idx = 0; total_idx < total.size(); ++total_idx) {
+            set_value(num_region * M_NUM_SUMMARY_REGION_FIELD + total_idx, total[total_idx]);
+        }
+        std::vector<double> sum(local_sum.size());
+        std::vector<double> max(num_value);
+        std::vector<double> neg_min(num_value);
+        comm->reduce_sum(local_sum.data(), sum.data(), local_sum.size(), 0);
+        comm->reduce_max(local_max.data(), max.data(), num_value, 0);
+        comm->reduce_max(local_neg_min.data(), neg_min.data(), num_value, 0);
+
+        if (!rank) {
+            auto print_stat = [&] (const std::string &name, size_t idx, double num_node) {
+                master_report << "    " << name << ": min=" << -neg_min[idx]
+                              << " max=" << max[idx]
+                              << " mean=" << sum[idx] / num_node
+                              << " sum=" << sum[idx] << std::endl;
+            };
+            // descending order by mean runtime with unmarked and
+            // epoch at the end
+            std::vector<uint64_t> region_id(num_region);
+            std::vector<size_t> order(num_region);
+            for (size_t region_idx = 0; region_idx < num_region; ++region_idx) {
+                region_id[region_idx] = std::stoull(union_entry[region_idx], nullptr, 16);
+                order[region_idx] = region_idx;
+            }
+            auto order_key = [&] (size_t region_idx) -> int {
+                return region_id[region_idx] == GEOPM_REGION_ID_EPOCH ? 2 :
+                       region_id[region_idx] == GEOPM_REGION_ID_UNMARKED ? 1 : 0;
+            };
+            auto mean_runtime = [&] (size_t region_idx) -> double {
+                return sum[region_idx * M_NUM_SUMMARY_REGION_FIELD] / sum[num_value + region_idx];
+            };
+            std::stable_sort(order.begin(), order.end(),
+                             [&] (size_t a, size_t b) -> bool {
+                                 return order_key(a) != order_key(b) ?
+                                        order_key(a) < order_key(b) :
+                                        mean_runtime(a) > mean_runtime(b);
+                             });
+            master_report << "\nHost count: " << num_rank << std::endl;
+            for (auto region_idx : order) {
+                const std::string &entry = union_entry[region_idx];
+                master_report << "Region " << entry.substr(entry.find(' ') + 1) << " (0x" << std::hex
+                              << std::setfill('0') << std::setw(16)
+                              << region_id[region_idx] << std::dec << "):"
+                              << std::setfill('\0') << std::setw(0)
+                              << std::endl;
+                double num_node = sum[num_value + region_idx];
+                master_report << "    host-count: " << num_node << std::endl;
+                for (int field_idx = 0; field_idx < M_NUM_SUMMARY_REGION_FIELD; ++field_idx) {
+                    print_stat(M_SUMMARY_REGION_NAME[field_idx],
+                               region_idx * M_NUM_SUMMARY_REGION_FIELD + field_idx, num_node);
+                }
+            }
+            master_report << "Application Totals:" << std::endl;
+            for (size_t total_idx = 0; total_idx < total.size(); ++total_idx) {
+                print_stat(M_SUMMARY_TOTAL_NAME[total_idx],
+                           num_region * M_NUM_SUMMARY_REGION_FIELD + total_idx, num_rank);
+            }
+            master_report << std::endl;
+        }
+    }
+
+    std::vector<std::string> Reporter::region_union(const std::set<std::string> &local_entry,
+                                                    std::shared_ptr<Comm> comm,
+                                                    int rank, int num_rank)
+    {
+        // Merge the sets up a binomial tree.  At each level the rank
+        // that is a multiple of twice the stride receives the set of
+        // the rank one stride above it, so no rank holds more than
+        // its own set and one peer's set.
+        std::set<std::string> entry_set(local_entry);
+        bool is_active = true;
+        for (int stride = 1; stride < num_rank; stride *= 2) {
+            std::shared_ptr<Comm> level_comm = comm->split(rank / (2 * stride), rank);
+            std::string send_str;
+            if (is_active && rank % (2 * stride) == stride) {
+                for (const auto &entry : entry_set) {
+                    send_str += entry;
+                    send_str.push_back('\0');
+                }
+                entry_set.clear();
+                is_active = false;
+            }
+            size_t send_size = send_str.size();
+            bool is_level_root = (level_comm->rank() == 0);
+            int level_num_rank = level_comm->num_rank();
+            std::vector<size_t> size_array(level_num_rank);
+            std::vector<off_t> displacement(level_num_rank);
+            std::vector<char> recv_entry;
+            level_comm->gather(&send_size, sizeof(size_t), size_array.data(), sizeof(size_t), 0);
+            if (is_level_root) {
+                displacement[0] = 0;
+                for (int i = 1; i < level_num_rank; ++i) {
+                    displacement[i] = displacement[i - 1] + size_array[i - 1];
+                }
+                recv_entry.resize(std::accumulate(size_array.begin(), size_array.end(), (size_t)0));
+            }
+            level_comm->gatherv(send_str.data(), send_size, recv_entry.data(), size_array, displacement, 0);
+            if (is_level_root) {
+                size_t begin = 0;
+                for (size_t idx = 0; idx < recv_entry.size(); ++idx) {
+                    if (recv_entry[idx] == '\0') {
+                        entry_set.emplace(recv_entry.data() + begin, idx - begin);
+                        begin = idx + 1;
+                    }
+                }
+            }
+        }
+        // Every node needs the same region order to reduce values
+        std::string union_str;
+        if (!rank) {
+            for (const auto &entry : entry_set) {
+                union_str += entry;
+                union_str.push_back('\0');
+            }
+        }
+        size_t union_size = union_str.size();
+        comm->broadcast(&union_size, sizeof(size_t), 0);
+        union_str.resize(union_size);
+        comm->broadcast(&union_str[0], union_size, 0);
+        std::vector<std::string> result;
+        size_t begin = 0;
+        for (size_t idx = 0; idx < union_str.size(); ++idx) {
+            if (union_str[idx] == '\0') {
+                result.push_back(union_str.substr(begin, idx - begin));
+                begin = idx + 1;
+            }
+        }
+        return result;
+    }
+
     std::string Reporter::get_max_memory()
     {
         char status_buffer[8192];
@@ -80,6 +80,10 @@ namespace geopm
             ///             region ID to lists of key-value pairs from
             ///             the agent to be added as additional
             ///             information about each region.
+            /// @param [in] controller_report Optional list of
+            ///             key-value pairs from the controller, such
+            ///             as Tracer statistics, to be added to the
+            ///             controller section of the host report.
             /// @param [in] application_io Reference to the
             ///             ApplicationIO owned by the controller.
             /// @param [in] comm Shared pointer to the Comm owned by
@@ -90,6 +94,7 @@ namespace geopm
                                   const std::vector<std::pair<std::string, std::string> > &agent_report_header,
                                   const std::vector<std::pair<std::string, std::string> > &agent_node_report,
                                   const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report,
+                                  const std::vector<std::pair<std::string, std::string> > &controller_report,
                                   const IApplicationIO &application_io,
                                   std::shared_ptr<Comm> comm,
                                   const ITreeComm &tree_comm) = 0;
@@ -99,21 +104,62 @@ namespace geopm
     {
         public:
             Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank);
+            /// @brief Reporter constructor that selects the report
+            ///        mode.
+            /// @param [in] do_summary If true, the root report holds
+            ///        the minimum, maximum, mean and sum over all
+            ///        nodes of each numeric statistic instead of the
+            ///        report from every node.
+            /// @param [in] do_node_file If true, every node also
+            ///        writes its own report to a file named by
+            ///        appending "-" and the host name to the report
+            ///        name.
+            Reporter(const std::string &report_name, IPlatformIO &platform_io, int rank,
+                     bool do_summary, bool do_node_file);
             virtual ~Reporter() = default;
             void init(void) override;
             void generate(const std::string &agent_name,
                           const std::vector<std::pair<std::string, std::string> > &agent_report_header,
                           const std::vector<std::pair<std::string, std::string> > &agent_node_report,
                           const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report,
+                          const std::vector<std::pair<std::string, std::string> > &controller_report,
                           const IApplicationIO &application_io,
                           std::shared_ptr<Comm> comm,
                           const ITreeComm &tree_comm) override;
         private:
+            struct m_region_s {
+                std::string name;
+                uint64_t id;
+                double per_rank_avg_runtime;
+                double bulk_sync_runtime;
+                double energy_pkg;
+                double energy_dram;
+                int count;
+                double frequency;
+                double frequency_hz;
+                double mpi_runtime;
+            };
             std::string get_max_memory(void);
+            /// @brief Reduce the region statistics and application
+            ///        totals of every node and write the minimum,
+            ///        maximum, mean and sum to the root report.
+            void generate_summary(const std::vector<m_region_s> &region,
+                                  const std::vector<double> &total,
+                                  std::shared_ptr<Comm> comm,
+                                  int rank,
+                                  std::ostream &master_report);
+            /// @brief Union of the region entries of every node,
+            ///        merged up a binomial tree and broadcast from
+            ///        rank zero so that every node has the same order.
+            std::vector<std::string> region_union(const std::set<std::string> &local_entry,
+                                                  std::shared_ptr<Comm> comm,
+                                                  int rank, int num_rank);
 
             std::string m_report_name;
             IPlatformIO &m_platform_io;
             int m_rank;
+            bool m_do_summary;
+            bool m_do_node_file;
             int m_region_bulk_runtime_idx;
             int m_energy_pkg_idx;
             int m_energy_dram_idx;
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "SampleFilter.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    void SampleFilter::threshold(const std::vector<m_threshold_s> &threshold)
+    {
+        m_threshold = threshold;
+        m_last_sent.clear();
+        m_num_held = 0;
+    }
+
+    bool SampleFilter::is_send(const std::vector<double> &sample)
+    {
+        bool result = m_threshold.empty() || m_last_sent.empty();
+        for (size_t idx = 0; !result && idx != m_threshold.size(); ++idx) {
+            const m_threshold_s &thresh = m_threshold[idx];
+            double last = m_last_sent[idx];
+            double curr = sample[idx];
+            double tolerance = std::max(thresh.absolute, thresh.relative * std::fabs(last));
+            if (std::isnan(last) || std::isnan(curr)) {
+                result = std::isnan(last) != std::isnan(curr);
+            }
+            else {
+                result = std::fabs(curr - last) > tolerance;
+            }
+            if (!result && thresh.max_stale > 0 && m_num_held >= thresh.max_stale) {
+                result = true;
+            }
+        }
+        if (!m_threshold.empty()) {
+            if (result) {
+                m_last_sent = sample;
+                m_num_held = 0;
+            }
+            else {
+                ++m_num_held;
+            }
+        }
+        return result;
+    }
+}
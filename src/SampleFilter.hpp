@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SAMPLEFILTER_HPP_INCLUDE
+#define SAMPLEFILTER_HPP_INCLUDE
+
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Decides if a sample must be sent up the tree given a
+    ///        change threshold for each value of the sample.
+    class SampleFilter
+    {
+        public:
+            struct m_threshold_s {
+                /// @brief Change relative to the magnitude of the
+                ///        value last sent.
+                double relative;
+                /// @brief Absolute change.
+                double absolute;
+                /// @brief Number of consecutive samples that may be
+                ///        held back before the value is sent
+                ///        regardless of change; zero or less for no
+                ///        limit.
+                int max_stale;
+            };
+            SampleFilter() = default;
+            virtual ~SampleFilter() = default;
+            /// @brief Set the threshold for each value of the
+            ///        sample.  With no thresholds every sample is
+            ///        sent.
+            void threshold(const std::vector<m_threshold_s> &threshold);
+            /// @brief Returns true if any value moved beyond its
+            ///        threshold since the last sample sent or has
+            ///        been held back for too long.  The sample is
+            ///        recorded as sent if true is returned.
+            bool is_send(const std::vector<double> &sample);
+        private:
+            std::vector<m_threshold_s> m_threshold;
+            std::vector<double> m_last_sent;
+            int m_num_held = 0;
+    };
+}
+
+#endif
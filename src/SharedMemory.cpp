@@ -36,6 +36,9 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <sched.h>
 #include <string.h>
 #include <iostream>
 #include <sstream>
@@ -154,25 +157,65 @@ namespace geopm
 
             geopm_time(&begin_time);
             curr_time = begin_time;
+            // Watch the directory backing shm_open() so that the
+            // waits below sleep until the region is created or
+            // resized rather than polling shm_open() and fstat().
+            size_t name_pos = shm_key.find_first_not_of('/');
+            std::string shm_name = name_pos == std::string::npos ? "" : shm_key.substr(name_pos);
+            int watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (watch_fd >= 0 &&
+                inotify_add_watch(watch_fd, M_SHM_DIR,
+                                  IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+                (void) close(watch_fd);
+                watch_fd = -1;
+            }
+            if (watch_fd < 0) {
+                // Each process needs its own inotify instance and the
+                // per-user limit (fs.inotify.max_user_instances) is
+                // easily exceeded by one rank per core, so poll as
+                // fast as before rather than failing.
+                static bool is_warned = false;
+                if (!is_warned) {
+                    // Format first so that messages from many ranks
+                    // do not interleave
+                    std::string warn_str = std::string("Warning: <geopm> SharedMemoryUser: inotify unavailable (") +
+                                           strerror(errno) + "), polling for shared memory.\n";
+                    std::cerr << warn_str << std::flush;
+                    is_warned = true;
+                }
+            }
+            shm_id = shm_open(shm_key.c_str(), O_RDWR, 0);
             while (shm_id < 0 && geopm_time_diff(&begin_time, &curr_time) < (double)timeout) {
                 geopm_signal_handler_check();
+                wait_event(watch_fd, shm_name, timeout - geopm_time_diff(&begin_time, &curr_time));
                 shm_id = shm_open(shm_key.c_str(), O_RDWR, 0);
                 geopm_time(&curr_time);
             }
-            if (shm_id < 0) {
-                std::ostringstream ex_str;
-                ex_str << "SharedMemoryUser: Could not open shared memory with key \"" << shm_key << "\"";
-                throw Exception(ex_str.str(), errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
+            int open_errno = errno;
 
-            while (!m_size && geopm_time_diff(&begin_time, &curr_time) < (double)timeout) {
+            if (shm_id >= 0) {
+                err = fstat(shm_id, &stat_struct);
+                if (!err) {
+                    m_size = stat_struct.st_size;
+                }
+            }
+            while (shm_id >= 0 && !m_size && geopm_time_diff(&begin_time, &curr_time) < (double)timeout) {
                 geopm_signal_handler_check();
+                wait_event(watch_fd, shm_name, timeout - geopm_time_diff(&begin_time, &curr_time));
                 err = fstat(shm_id, &stat_struct);
                 if (!err) {
                     m_size = stat_struct.st_size;
                 }
                 geopm_time(&curr_time);
             }
+            if (watch_fd >= 0) {
+                (void) close(watch_fd);
+            }
+            if (shm_id < 0) {
+                std::ostringstream ex_str;
+                ex_str << "SharedMemoryUser: Could not open shared memory with key \"" << shm_key << "\"";
+                throw Exception(ex_str.str(), open_errno ? open_errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
             if (!m_size) {
                 (void) close(shm_id);
                 throw Exception("SharedMemoryUser: Opened shared memory region, but it is zero length", errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -192,6 +235,52 @@ namespace geopm
         m_is_linked = true;
     }
 
+    const char *SharedMemoryUser::M_SHM_DIR = "/dev/shm";
+
+    void SharedMemoryUser::wait_event(int watch_fd, const std::string &shm_name, double timeout)
+    {
+        // Longest time spent asleep before checking for signals
+        static const double M_SLEEP_SEC = 0.01;
+
+        if (timeout > M_SLEEP_SEC) {
+            timeout = M_SLEEP_SEC;
+        }
+        if (timeout <= 0.0) {
+            return;
+        }
+        if (watch_fd < 0) {
+            // Without inotify the caller polls shm_open() and fstat()
+            // as before, yielding so that ranks sharing a CPU with
+            // the creator do not delay it
+            (void) sched_yield();
+            return;
+        }
+        struct geopm_time_s begin_time;
+        geopm_time(&begin_time);
+        double remain = timeout;
+        bool is_match = false;
+        while (!is_match && remain > 0.0) {
+            struct pollfd watch_poll = {watch_fd, POLLIN, 0};
+            int num_ready = poll(&watch_poll, 1, (int)(remain * 1E3) + 1);
+            if (num_ready <= 0) {
+                break;
+            }
+            alignas(struct inotify_event) char event_buf[4096];
+            ssize_t num_read = 0;
+            while ((num_read = read(watch_fd, event_buf, sizeof(event_buf))) > 0) {
+                for (char *event_ptr = event_buf; event_ptr < event_buf + num_read;) {
+                    struct inotify_event *event = (struct inotify_event *)event_ptr;
+                    if ((event->mask & IN_Q_OVERFLOW) ||
+                        (event->len && shm_name == event->name)) {
+                        is_match = true;
+                    }
+                    event_ptr += sizeof(struct inotify_event) + event->len;
+                }
+            }
+            remain = timeout - geopm_time_since(&begin_time);
+        }
+    }
+
     SharedMemoryUser::~SharedMemoryUser()
     {
         if (munmap(m_ptr, m_size)) {
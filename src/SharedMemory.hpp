@@ -116,6 +116,13 @@ namespace geopm
             size_t size(void) const override;
             void unlink(void) override;
         private:
+            /// Sleep until an inotify event for shm_name arrives on
+            /// watch_fd or until timeout seconds, limited to a short
+            /// interval so that signals are checked by the caller.
+            /// If watch_fd is negative only yields the CPU.
+            static void wait_event(int watch_fd, const std::string &shm_name, double timeout);
+            /// Directory backing regions created with shm_open().
+            static const char *M_SHM_DIR;
             /// Shared memory key for the region.
             std::string m_shm_key;
             /// Size of the region.
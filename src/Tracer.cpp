@@ -30,10 +30,14 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <limits.h>
 #include <string.h>
 #include <cctype>
+#include <cstddef>
 #include <iomanip>
 #include <sstream>
 #include <iostream>
@@ -53,6 +57,22 @@ using geopm::IPlatformTopo;
 
 namespace geopm
 {
+    static const char M_BINARY_MAGIC[8] = {'G', 'E', 'O', 'P', 'M', 'T', 'R', 'C'};
+    static const uint32_t M_BINARY_VERSION = 1;
+    static const size_t M_BINARY_MAP_MIN = 1048576; // 1 MiB
+    static const size_t M_BINARY_READ_SIZE = 1048576; // 1 MiB
+    static const int M_NUM_CHUNK = 4;
+
+    /// @brief Region ID as shown in the trace: hints and the MPI bit
+    ///        are removed.
+    static double trace_region_id(double region_id)
+    {
+        uint64_t value = geopm_signal_to_field(region_id);
+        value = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, value);
+        value = geopm_region_id_unset_mpi(value);
+        return geopm_field_to_signal(value);
+    }
+
     Tracer::Tracer(std::string header)
         : m_header(header)
         , m_is_trace_enabled(false)
@@ -61,6 +81,20 @@ namespace geopm
         , m_time_zero({{0, 0}})
         , m_policy({0, 0, 0, 0.0})
         , m_platform_io(platform_io())
+        , m_is_binary(false)
+        , m_binary_fd(-1)
+        , m_binary_map(nullptr)
+        , m_binary_map_size(0)
+        , m_binary_size(0)
+        , m_binary_num_record(0)
+        , m_is_writer_running(false)
+        , m_is_writer_stop(false)
+        , m_chunk_write_begin(0)
+        , m_chunk_write_size(0)
+        , m_chunk_limit(0)
+        , m_is_writer_stall(false)
+        , m_num_stall(0)
+        , m_num_byte_drop(0)
     {
         geopm_time(&m_time_zero);
         if (geopm_env_do_trace()) {
@@ -97,7 +131,7 @@ namespace geopm
     Tracer::Tracer()
         : Tracer(geopm_env_trace(), hostname(), geopm_env_agent(),
                  geopm_env_profile(), geopm_env_do_trace(), platform_io(),
-                 {}, 16)
+                 {}, 16, geopm_env_do_trace_binary())
     {
 
     }
@@ -110,6 +144,21 @@ namespace geopm
                    IPlatformIO &platform_io,
                    const std::vector<std::string> &env_column,
                    int precision)
+        : Tracer(file_path, hostname, agent, profile_name, do_trace,
+                 platform_io, env_column, precision, false)
+    {
+
+    }
+
+    Tracer::Tracer(const std::string &file_path,
+                   const std::string &hostname,
+                   const std::string &agent,
+                   const std::string &profile_name,
+                   bool do_trace,
+                   IPlatformIO &platform_io,
+                   const std::vector<std::string> &env_column,
+                   int precision,
+                   bool do_binary)
         : m_file_path(file_path)
         , m_hostname(hostname)
         , m_is_trace_enabled(do_trace)
@@ -120,6 +169,20 @@ namespace geopm
         , m_platform_io(platform_io)
         , m_env_column(env_column)
         , m_precision(precision)
+        , m_is_binary(do_binary)
+        , m_binary_fd(-1)
+        , m_binary_map(nullptr)
+        , m_binary_map_size(0)
+        , m_binary_size(0)
+        , m_binary_num_record(0)
+        , m_is_writer_running(false)
+        , m_is_writer_stop(false)
+        , m_chunk_write_begin(0)
+        , m_chunk_write_size(0)
+        , m_chunk_limit(1048576) // 1 MiB
+        , m_is_writer_stall(false)
+        , m_num_stall(0)
+        , m_num_byte_drop(0)
     {
         if (m_env_column.empty()) {
             auto num_extra_cols = geopm_env_num_trace_signal();
@@ -131,12 +194,23 @@ namespace geopm
         if (m_is_trace_enabled) {
             std::ostringstream output_path;
             output_path << m_file_path << "-" << m_hostname;
-            m_stream.open(output_path.str());
-            if (!m_stream.good()) {
+            bool is_open = false;
+            if (m_is_binary) {
+                binary_open(output_path.str());
+                is_open = m_binary_fd != -1;
+            }
+            else {
+                m_stream.open(output_path.str());
+                is_open = m_stream.good();
+            }
+            if (!is_open) {
                 std::cerr << "Warning: unable to open trace file '" << output_path.str()
                           << "': " << strerror(errno) << std::endl;
                 m_is_trace_enabled = false;
             }
+            else if (!m_is_binary) {
+                writer_start();
+            }
 
             // Header
             m_buffer << "# \"geopm_version\" : \"" << geopm_version() << "\",\n"
@@ -151,7 +225,11 @@ namespace geopm
 
     Tracer::~Tracer()
     {
-        if (m_stream.good() && m_is_trace_enabled) {
+        writer_stop();
+        if (m_is_binary) {
+            binary_close();
+        }
+        else if (m_stream.good() && m_is_trace_enabled) {
             m_stream << m_buffer.str();
             m_stream.close();
         }
@@ -232,61 +310,116 @@ namespace geopm
             }
 
             // set up columns to be sampled by Tracer
+            std::vector<std::string> column_name;
             for (const auto &col : base_columns) {
                 m_column_idx.push_back(m_platform_io.push_signal(col.name,
                                                                  col.domain_type,
                                                                  col.domain_idx));
                 if (col.name.find("#") != std::string::npos) {
-                    m_hex_column.insert(m_column_idx.back());
+                    m_column_format.push_back(M_FORMAT_HEX);
                 }
-                if (first) {
-                    m_buffer << pretty_name(col);
-                    first = false;
+                else if ((int)m_column_format.size() == m_region_progress_idx) {
+                    m_column_format.push_back(M_FORMAT_PROGRESS);
                 }
                 else {
-                    m_buffer << "|" << pretty_name(col);
+                    m_column_format.push_back(M_FORMAT_DEFAULT);
                 }
+                column_name.push_back(pretty_name(col));
             }
 
             // columns from agent; will be sampled by agent
             for (const auto &name : agent_cols) {
-                m_buffer << "|" << name;
+                base_columns.push_back({name, IPlatformTopo::M_DOMAIN_BOARD, 0});
+                m_column_format.push_back(M_FORMAT_DEFAULT);
+                column_name.push_back(name);
+            }
+
+            if (m_is_binary) {
+                // Header comments written so far become the metadata
+                std::string metadata = m_buffer.str();
+                m_buffer.str("");
+                size_t header_size = sizeof(m_binary_header_s) + metadata.size() +
+                                     column_name.size() * sizeof(m_binary_column_s);
+                for (const auto &name : column_name) {
+                    header_size += name.size();
+                }
+                // Records are aligned for direct access to the doubles
+                size_t record_offset = (header_size + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+                m_binary_header_s header;
+                std::copy(M_BINARY_MAGIC, M_BINARY_MAGIC + sizeof(header.magic), header.magic);
+                header.version = M_BINARY_VERSION;
+                header.precision = m_precision;
+                header.num_column = column_name.size();
+                header.metadata_size = metadata.size();
+                header.record_offset = record_offset;
+                header.num_record = 0;
+                binary_append(&header, sizeof(header));
+                binary_append(metadata.data(), metadata.size());
+                for (size_t col_idx = 0; col_idx < column_name.size(); ++col_idx) {
+                    m_binary_column_s column {(uint32_t)m_column_format[col_idx],
+                                              base_columns[col_idx].domain_type,
+                                              base_columns[col_idx].domain_idx,
+                                              (uint32_t)column_name[col_idx].size()};
+                    binary_append(&column, sizeof(column));
+                    binary_append(column_name[col_idx].data(), column_name[col_idx].size());
+                }
+                std::vector<char> pad(record_offset - header_size, '\0');
+                binary_append(pad.data(), pad.size());
+            }
+            else {
+                for (const auto &name : column_name) {
+                    if (first) {
+                        m_buffer << name;
+                        first = false;
+                    }
+                    else {
+                        m_buffer << "|" << name;
+                    }
+                }
+                m_buffer << "\n";
             }
-            m_buffer << "\n";
 
-            m_last_telemetry.resize(base_columns.size() + agent_cols.size());
+            m_last_telemetry.resize(column_name.size());
+        }
+    }
+
+    void Tracer::format_value(std::ostream &stream, double value,
+                              int format, int precision)
+    {
+        if (format == M_FORMAT_HEX) {
+            stream << "0x" << std::hex << std::setfill('0') << std::setw(16);
+            stream << geopm_signal_to_field(value);
+            stream << std::setfill('\0') << std::setw(0);
+        }
+        else if (format == M_FORMAT_PROGRESS) {
+            stream << std::setprecision(1) << std::fixed
+                   << value
+                   << std::setprecision(precision) << std::scientific;
+        }
+        else {
+            stream << value;
         }
     }
 
     void Tracer::write_line(void)
     {
-        m_buffer << std::setprecision(m_precision) << std::scientific;
-        for (size_t idx = 0; idx < m_last_telemetry.size(); ++idx) {
-            if (idx != 0) {
-                m_buffer << "|";
-            }
-            if (m_hex_column.find(m_column_idx[idx]) != m_hex_column.end()) {
-                m_buffer << "0x" << std::hex << std::setfill('0') << std::setw(16);
-                uint64_t value = geopm_signal_to_field(m_last_telemetry[idx]);
-                if ((int)idx == m_region_id_idx) {
-                    // Remove hints from trace
-                    value = geopm_region_id_unset_hint(GEOPM_MASK_REGION_HINT, value);
-                    // Remove MPI bit in trace
-                    value = geopm_region_id_unset_mpi(value);
+        double region_id = m_last_telemetry[m_region_id_idx];
+        m_last_telemetry[m_region_id_idx] = trace_region_id(region_id);
+        if (m_is_binary) {
+            binary_append(m_last_telemetry.data(), m_last_telemetry.size() * sizeof(double));
+            ++m_binary_num_record;
+        }
+        else {
+            m_buffer << std::setprecision(m_precision) << std::scientific;
+            for (size_t idx = 0; idx < m_last_telemetry.size(); ++idx) {
+                if (idx != 0) {
+                    m_buffer << "|";
                 }
-                m_buffer << value;
-                m_buffer << std::setfill('\0') << std::setw(0);
-            }
-            else if ((int)idx == m_region_progress_idx) {
-                m_buffer << std::setprecision(1) << std::fixed
-                         << m_last_telemetry[idx]
-                         << std::setprecision(m_precision) << std::scientific;
-            }
-            else {
-                m_buffer << m_last_telemetry[idx];
+                format_value(m_buffer, m_last_telemetry[idx], m_column_format[idx], m_precision);
             }
+            m_buffer << "\n";
         }
-        m_buffer << "\n";
+        m_last_telemetry[m_region_id_idx] = region_id;
     }
 
     void Tracer::update(const std::vector<double> &agent_values,
@@ -338,23 +471,305 @@ namespace geopm
             m_last_telemetry[m_region_progress_idx] = region_progress;
             m_last_telemetry[m_region_runtime_idx] = region_runtime;
             write_line();
+            if (m_is_binary) {
+                binary_flush();
+            }
         }
 
-        // if buffer is full, flush to file
-        if (m_buffer.tellp() > m_buffer_limit) {
-            m_stream << m_buffer.str();
-            m_buffer.str("");
+        // if buffer is full, pass it to the writer thread
+        if (m_is_writer_running && m_buffer.tellp() > m_chunk_limit) {
+            writer_push();
         }
     }
 
     void Tracer::flush(void)
     {
-        m_stream << m_buffer.str();
-        m_buffer.str("");
-        m_stream.close();
+        if (m_is_binary) {
+            binary_close();
+        }
+        else {
+            writer_stop();
+            m_stream << m_buffer.str();
+            m_buffer.str("");
+            m_stream.close();
+        }
         m_is_trace_enabled = false;
     }
 
+    size_t Tracer::num_stall(void) const
+    {
+        return m_num_stall;
+    }
+
+    size_t Tracer::num_byte_drop(void) const
+    {
+        return m_num_byte_drop;
+    }
+
+    void Tracer::writer_start(void)
+    {
+        int err = pthread_mutex_init(&m_writer_mutex, NULL);
+        if (!err) {
+            err = pthread_cond_init(&m_writer_cond, NULL);
+            if (err) {
+                (void)pthread_mutex_destroy(&m_writer_mutex);
+            }
+        }
+        if (err) {
+            throw Exception("Tracer::writer_start(): failed to initialize pthread synchronization",
+                            err, __FILE__, __LINE__);
+        }
+        m_chunk.resize(M_NUM_CHUNK);
+        m_chunk_free.reserve(M_NUM_CHUNK);
+        for (int chunk_idx = 0; chunk_idx < M_NUM_CHUNK; ++chunk_idx) {
+            m_chunk_free.push_back(chunk_idx);
+        }
+        m_chunk_write.resize(M_NUM_CHUNK, -1);
+        m_chunk_write_begin = 0;
+        m_chunk_write_size = 0;
+        m_is_writer_stop = false;
+        err = pthread_create(&m_writer_thread, NULL, writer_main, (void *)this);
+        if (err) {
+            (void)pthread_cond_destroy(&m_writer_cond);
+            (void)pthread_mutex_destroy(&m_writer_mutex);
+            throw Exception("Tracer::writer_start(): pthread_create() failed",
+                            err, __FILE__, __LINE__);
+        }
+        m_is_writer_running = true;
+    }
+
+    void Tracer::writer_stop(void)
+    {
+        if (m_is_writer_running) {
+            (void)pthread_mutex_lock(&m_writer_mutex);
+            m_is_writer_stop = true;
+            (void)pthread_cond_signal(&m_writer_cond);
+            (void)pthread_mutex_unlock(&m_writer_mutex);
+            (void)pthread_join(m_writer_thread, NULL);
+            (void)pthread_cond_destroy(&m_writer_cond);
+            (void)pthread_mutex_destroy(&m_writer_mutex);
+            m_is_writer_running = false;
+        }
+    }
+
+    void Tracer::writer_push(void)
+    {
+        off_t size = m_buffer.tellp();
+        bool is_pushed = false;
+        (void)pthread_mutex_lock(&m_writer_mutex);
+        if (!m_chunk_free.empty()) {
+            int chunk_idx = m_chunk_free.back();
+            m_chunk_free.pop_back();
+            m_buffer.swap(m_chunk[chunk_idx]);
+            m_chunk_write[(m_chunk_write_begin + m_chunk_write_size) % m_chunk_write.size()] = chunk_idx;
+            ++m_chunk_write_size;
+            is_pushed = true;
+            (void)pthread_cond_signal(&m_writer_cond);
+        }
+        (void)pthread_mutex_unlock(&m_writer_mutex);
+        if (is_pushed) {
+            m_is_writer_stall = false;
+        }
+        else {
+            // Keep buffering while the writer catches up; only
+            // discard once as much is held as the synchronous path
+            // holds before it blocks on a write.
+            if (!m_is_writer_stall) {
+                ++m_num_stall;
+                m_is_writer_stall = true;
+            }
+            if (size > m_buffer_limit) {
+                m_num_byte_drop += size;
+                m_buffer.str("");
+            }
+        }
+    }
+
+    void *Tracer::writer_main(void *tracer)
+    {
+        static_cast<Tracer *>(tracer)->writer_run();
+        return NULL;
+    }
+
+    void Tracer::writer_run(void)
+    {
+        (void)pthread_mutex_lock(&m_writer_mutex);
+        while (true) {
+            while (!m_chunk_write_size && !m_is_writer_stop) {
+                (void)pthread_cond_wait(&m_writer_cond, &m_writer_mutex);
+            }
+            if (!m_chunk_write_size) {
+                break;
+            }
+            int chunk_idx = m_chunk_write[m_chunk_write_begin];
+            (void)pthread_mutex_unlock(&m_writer_mutex);
+            // file I/O is done without holding the lock
+            std::ostringstream &chunk = m_chunk[chunk_idx];
+            m_stream << chunk.str();
+            chunk.str("");
+            (void)pthread_mutex_lock(&m_writer_mutex);
+            m_chunk_write_begin = (m_chunk_write_begin + 1) % m_chunk_write.size();
+            --m_chunk_write_size;
+            m_chunk_free.push_back(chunk_idx);
+        }
+        (void)pthread_mutex_unlock(&m_writer_mutex);
+    }
+
+    void Tracer::binary_open(const std::string &path)
+    {
+        m_binary_fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        m_binary_map = nullptr;
+        m_binary_map_size = 0;
+        m_binary_size = 0;
+        m_binary_num_record = 0;
+    }
+
+    void Tracer::binary_append(const void *data, size_t size)
+    {
+        if (m_binary_fd == -1) {
+            return;
+        }
+        if (m_binary_size + size > m_binary_map_size) {
+            size_t map_size = std::max(m_binary_map_size, M_BINARY_MAP_MIN);
+            while (m_binary_size + size > map_size) {
+                map_size *= 2;
+            }
+            if (m_binary_map) {
+                (void)munmap(m_binary_map, m_binary_map_size);
+                m_binary_map = nullptr;
+                m_binary_map_size = 0;
+            }
+            void *map = MAP_FAILED;
+            if (!ftruncate(m_binary_fd, map_size)) {
+                map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_binary_fd, 0);
+            }
+            if (map == MAP_FAILED) {
+                // Losing the trace must not stop the controller; the
+                // records counted so far remain readable.
+                std::cerr << "Warning: <geopm> Tracer: unable to extend binary trace file, "
+                          << "tracing stopped: " << strerror(errno) << std::endl;
+                binary_close();
+                m_is_trace_enabled = false;
+                return;
+            }
+            m_binary_map = (char *)map;
+            m_binary_map_size = map_size;
+        }
+        memcpy(m_binary_map + m_binary_size, data, size);
+        m_binary_size += size;
+    }
+
+    void Tracer::binary_flush(void)
+    {
+        if (m_binary_map) {
+            memcpy(m_binary_map + offsetof(m_binary_header_s, num_record),
+                   &m_binary_num_record, sizeof(m_binary_num_record));
+        }
+    }
+
+    void Tracer::binary_close(void)
+    {
+        if (m_binary_fd != -1) {
+            if (m_binary_map) {
+                binary_flush();
+                (void)munmap(m_binary_map, m_binary_map_size);
+                m_binary_map = nullptr;
+                m_binary_map_size = 0;
+            }
+            // Remove the unused space at the end of the last mapping
+            (void)ftruncate(m_binary_fd, m_binary_size);
+            (void)close(m_binary_fd);
+            m_binary_fd = -1;
+        }
+    }
+
+    void Tracer::binary_to_text(const std::string &binary_path, std::ostream &text)
+    {
+        std::ifstream binary(binary_path, std::ios::binary | std::ios::ate);
+        if (!binary.good()) {
+            throw Exception("Tracer::binary_to_text(): unable to open " + binary_path,
+                            errno ? errno : GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        }
+        size_t file_size = binary.tellg();
+        binary.seekg(0);
+        Exception ex_parse("Tracer::binary_to_text(): " + binary_path + " is not a valid binary trace",
+                           GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        m_binary_header_s header;
+        if (file_size < sizeof(header) ||
+            !binary.read((char *)&header, sizeof(header))) {
+            throw ex_parse;
+        }
+        if (!std::equal(M_BINARY_MAGIC, M_BINARY_MAGIC + sizeof(header.magic), header.magic) ||
+            header.version != M_BINARY_VERSION ||
+            header.record_offset < sizeof(header) ||
+            header.record_offset > file_size) {
+            throw ex_parse;
+        }
+        // Only the metadata and column names are held in memory, the
+        // records are converted a block at a time
+        std::vector<char> buffer(header.record_offset - sizeof(header));
+        if (!binary.read(buffer.data(), buffer.size())) {
+            throw ex_parse;
+        }
+        const char *buffer_end = buffer.data() + buffer.size();
+        const char *ptr = buffer.data();
+        if (ptr + header.metadata_size > buffer_end) {
+            throw ex_parse;
+        }
+        text.write(ptr, header.metadata_size);
+        ptr += header.metadata_size;
+
+        std::vector<int> column_format;
+        for (uint32_t col_idx = 0; col_idx < header.num_column; ++col_idx) {
+            m_binary_column_s column;
+            if (ptr + sizeof(column) > buffer_end) {
+                throw ex_parse;
+            }
+            memcpy(&column, ptr, sizeof(column));
+            ptr += sizeof(column);
+            if (ptr + column.name_size > buffer_end) {
+                throw ex_parse;
+            }
+            if (col_idx != 0) {
+                text << "|";
+            }
+            text.write(ptr, column.name_size);
+            ptr += column.name_size;
+            column_format.push_back(column.format);
+        }
+        text << "\n";
+
+        size_t record_size = header.num_column * sizeof(double);
+        if (!record_size) {
+            return;
+        }
+        // Space past the last counted record is padding left by a
+        // controller that did not close the trace
+        size_t num_record = std::min((size_t)header.num_record,
+                                     (file_size - header.record_offset) / record_size);
+        size_t block_num_record = std::max(M_BINARY_READ_SIZE / record_size, (size_t)1);
+        std::vector<double> block(std::min(num_record, block_num_record) * header.num_column);
+        text << std::setprecision(header.precision) << std::scientific;
+        while (num_record) {
+            size_t read_num_record = std::min(num_record, block_num_record);
+            if (!binary.read((char *)block.data(), read_num_record * record_size)) {
+                throw ex_parse;
+            }
+            const double *record = block.data();
+            for (size_t record_idx = 0; record_idx < read_num_record; ++record_idx) {
+                for (uint32_t col_idx = 0; col_idx < header.num_column; ++col_idx) {
+                    if (col_idx != 0) {
+                        text << "|";
+                    }
+                    format_value(text, record[col_idx], column_format[col_idx], header.precision);
+                }
+                text << "\n";
+                record += header.num_column;
+            }
+            num_record -= read_num_record;
+        }
+    }
+
     std::string ITracer::pretty_name(const IPlatformIO::m_request_s &col) {
         std::ostringstream result;
         std::string name = col.name;
@@ -40,6 +40,8 @@
 #include <set>
 #include <list>
 
+#include <pthread.h>
+
 #include "PlatformIO.hpp"
 #include "geopm_message.h"
 #include "geopm_time.h"
@@ -76,6 +78,15 @@ namespace geopm
             /// @brief Write the remaining trace data to the file and
             ///        stop tracing.
             virtual void flush(void) = 0;
+            /// @brief Number of times update() found every trace
+            ///        buffer waiting to be written.  Trace data is
+            ///        then kept in memory instead of blocking on file
+            ///        I/O until the writer thread catches up.
+            virtual size_t num_stall(void) const = 0;
+            /// @brief Total number of bytes of trace data discarded
+            ///        because more than 128 MiB accumulated while the
+            ///        writer thread fell behind.
+            virtual size_t num_byte_drop(void) const = 0;
             /// @brief Returns the column header to be displayed in
             ///        the trace.  The string is based on the signal
             ///        name.  If the domain type is board, the name
@@ -104,6 +115,22 @@ namespace geopm
                    IPlatformIO &platform_io,
                    const std::vector<std::string> &env_column,
                    int precision);
+            /// @brief Tracer constructor that selects the trace
+            ///        file format.
+            /// @param [in] do_binary If true, the trace is written
+            ///        in the binary columnar format that can be
+            ///        converted to text by binary_to_text(),
+            ///        otherwise the pipe delimited text format is
+            ///        written.
+            Tracer(const std::string &file_path,
+                   const std::string &hostname,
+                   const std::string &agent,
+                   const std::string &profile_name,
+                   bool do_trace,
+                   IPlatformIO &platform_io,
+                   const std::vector<std::string> &env_column,
+                   int precision,
+                   bool do_binary);
             /// @brief Tracer destructor, virtual.
             virtual ~Tracer();
             void update(const std::vector <struct geopm_telemetry_message_s> &telemetry) override;
@@ -113,10 +140,84 @@ namespace geopm
             void update(const std::vector<double> &agent_signals,
                         std::list<geopm_region_info_s> region_entry_exit) override;
             void flush(void) override;
+            size_t num_stall(void) const override;
+            size_t num_byte_drop(void) const override;
+            /// @brief Convert a binary trace file into the pipe
+            ///        delimited text format.  The output is identical
+            ///        to what the Tracer would have written in text
+            ///        mode.
+            ///        Only the records counted in the header are
+            ///        converted, so a trace from a controller that
+            ///        did not exit cleanly is also accepted.  This is
+            ///        used by geopmtraceconvert(1).
+            /// @param [in] binary_path Path to the binary trace.
+            /// @param [out] text Stream the text trace is written
+            ///        to.
+            static void binary_to_text(const std::string &binary_path,
+                                       std::ostream &text);
         private:
+            enum m_format_e {
+                M_FORMAT_DEFAULT = 0,
+                M_FORMAT_HEX = 1,
+                M_FORMAT_PROGRESS = 2,
+            };
+            /// @brief Fixed size leading part of a binary trace.
+            ///        It is followed by metadata_size bytes of
+            ///        header comment text, then the column
+            ///        descriptions.  Records of num_column doubles
+            ///        begin at record_offset.  num_record is updated
+            ///        after every update() so that a trace left
+            ///        padded to the mapped size by a crash can still
+            ///        be read.
+            struct m_binary_header_s {
+                char magic[8];
+                uint32_t version;
+                uint32_t precision;
+                uint32_t num_column;
+                uint32_t metadata_size;
+                uint64_t record_offset;
+                uint64_t num_record;
+            };
+            /// @brief Column description in a binary trace, followed
+            ///        by name_size bytes of the column name.
+            struct m_binary_column_s {
+                uint32_t format;
+                int32_t domain_type;
+                int32_t domain_idx;
+                uint32_t name_size;
+            };
             static std::string hostname(void);
             /// @brief Format and write the values in m_last_telemetry to the trace.
             void write_line(void);
+            /// @brief Format one value of a text trace.
+            static void format_value(std::ostream &stream, double value,
+                                     int format, int precision);
+            /// @brief Open the mapped binary trace file.
+            void binary_open(const std::string &path);
+            /// @brief Copy data to the end of the mapped binary
+            ///        trace, growing the file if required.  If the
+            ///        file cannot be grown a warning is printed and
+            ///        binary tracing stops.
+            void binary_append(const void *data, size_t size);
+            /// @brief Store the number of complete records in the
+            ///        mapped header.
+            void binary_flush(void);
+            /// @brief Truncate the binary trace to the data written
+            ///        and unmap it.
+            void binary_close(void);
+            /// @brief Start the thread that writes full text buffers
+            ///        to the trace file.
+            void writer_start(void);
+            /// @brief Write all queued buffers and join the writer
+            ///        thread.
+            void writer_stop(void);
+            /// @brief Hand the filled m_buffer to the writer thread
+            ///        and continue with an empty one.  Never blocks
+            ///        on file I/O: if no empty buffer is available
+            ///        the data is dropped and counted.
+            void writer_push(void);
+            static void *writer_main(void *tracer);
+            void writer_run(void);
             std::string m_file_path;
             std::string m_header;
             std::string m_hostname;
@@ -132,8 +233,30 @@ namespace geopm
             std::vector<std::string> m_env_column; // extra columns from environment
             int m_precision;
             std::vector<int> m_column_idx; // columns sampled by Tracer
-            std::set<int> m_hex_column;
             std::vector<double> m_last_telemetry;
+            std::vector<int> m_column_format; // m_format_e for each column
+            bool m_is_binary;
+            int m_binary_fd;
+            char *m_binary_map;
+            size_t m_binary_map_size;
+            size_t m_binary_size;
+            uint64_t m_binary_num_record;
+            bool m_is_writer_running;
+            bool m_is_writer_stop;
+            pthread_t m_writer_thread;
+            pthread_mutex_t m_writer_mutex;
+            pthread_cond_t m_writer_cond;
+            /// @brief Text buffers exchanged with m_buffer; each is
+            ///        either in m_chunk_free or in m_chunk_write.
+            std::vector<std::ostringstream> m_chunk;
+            std::vector<int> m_chunk_free;
+            std::vector<int> m_chunk_write; // ring of chunks to write
+            size_t m_chunk_write_begin;
+            size_t m_chunk_write_size;
+            off_t m_chunk_limit;
+            bool m_is_writer_stall;
+            size_t m_num_stall;
+            size_t m_num_byte_drop;
             int m_region_id_idx = -1;
             int m_region_progress_idx = -1;
             int m_region_runtime_idx = -1;
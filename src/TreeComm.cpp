@@ -32,13 +32,19 @@
 
 #include <limits.h>
 #include <string.h>
+#include <unistd.h>
 #include <algorithm>
 #include <memory>
 #include <cmath>
+#include <fstream>
+#include <sstream>
+#include <map>
 
 #include "TreeComm.hpp"
 #include "TreeCommLevel.hpp"
 #include "Comm.hpp"
+#include "Exception.hpp"
+#include "geopm_env.h"
 #include "config.h"
 
 namespace geopm
@@ -47,7 +53,21 @@ namespace geopm
     TreeComm::TreeComm(std::shared_ptr<Comm> comm,
                        int num_send_down,
                        int num_send_up)
-        : TreeComm(comm, fan_out(comm), 0, num_send_down, num_send_up, {})
+        : TreeComm(comm, switch_group(comm, geopm_env_tree_topology(), hostname()),
+                   num_send_down, num_send_up)
+    {
+
+    }
+
+    TreeComm::TreeComm(std::shared_ptr<Comm> comm,
+                       const std::vector<int> &group,
+                       int num_send_down,
+                       int num_send_up)
+        // Splitting with the switch index as key keeps the original
+        // rank order within each switch.
+        : TreeComm(group.empty() ? comm : comm->split(0, group[comm->rank()]),
+                   group.empty() ? fan_out(comm) : fan_out(comm, group),
+                   0, num_send_down, num_send_up, {})
     {
 
     }
@@ -110,10 +130,14 @@ namespace geopm
         }
         for (; level < m_max_level; ++level) {
             parent_coords[root_level - 1 - level] = 0;
-            result.emplace_back(
-                new TreeCommLevel(comm_cart->split(
-                                      comm_cart->cart_rank(parent_coords), rank_cart),
-                                  m_num_send_up, m_num_send_down));
+            std::shared_ptr<Comm> comm_level(comm_cart->split(
+                comm_cart->cart_rank(parent_coords), rank_cart));
+            if (geopm_env_do_tree_sequence()) {
+                result.emplace_back(new SequenceTreeCommLevel(comm_level, m_num_send_up, m_num_send_down));
+            }
+            else {
+                result.emplace_back(new TreeCommLevel(comm_level, m_num_send_up, m_num_send_down));
+            }
         }
         for (; level < root_level; ++level) {
             comm_cart->split(Comm::M_SPLIT_COLOR_UNDEFINED, 0);
@@ -163,6 +187,15 @@ namespace geopm
         m_level_ctl[level]->send_up(sample);
     }
 
+    void TreeComm::sample_threshold(int level, const std::vector<SampleFilter::m_threshold_s> &threshold)
+    {
+        if (level < 0 || (level != 0 && level >= m_max_level)) {
+            throw Exception("TreeComm::sample_threshold()",
+                            GEOPM_ERROR_LEVEL_RANGE, __FILE__, __LINE__);
+        }
+        m_level_ctl[level]->sample_threshold(threshold);
+    }
+
     void TreeComm::send_down(int level, const std::vector<std::vector<double> > &policy)
     {
         if (level < 0 || level >= m_num_level_ctl) {
@@ -181,6 +214,24 @@ namespace geopm
         return m_level_ctl[level]->receive_up(sample);
     }
 
+    void TreeComm::send_down(int level, const ChildMatrix &policy)
+    {
+        if (level < 0 || level >= m_num_level_ctl) {
+            throw Exception("TreeComm::send_down()",
+                            GEOPM_ERROR_LEVEL_RANGE, __FILE__, __LINE__);
+        }
+        m_level_ctl[level]->send_down(policy);
+    }
+
+    bool TreeComm::receive_up(int level, ChildMatrix &sample)
+    {
+        if (level < 0 || level >= m_num_level_ctl) {
+            throw Exception("TreeComm::receive_up()",
+                            GEOPM_ERROR_LEVEL_RANGE, __FILE__, __LINE__);
+        }
+        return m_level_ctl[level]->receive_up(sample);
+    }
+
     bool TreeComm::receive_down(int level, std::vector<double> &policy)
     {
         if (level < 0 || (level != 0 && level >= m_max_level)) {
@@ -199,10 +250,28 @@ namespace geopm
         return result;
     }
 
+    void ITreeComm::send_down(int level, const ChildMatrix &policy)
+    {
+        send_down(level, policy.rows());
+    }
+
+    bool ITreeComm::receive_up(int level, ChildMatrix &sample)
+    {
+        std::vector<std::vector<double> > sample_rows = sample.rows();
+        bool is_complete = receive_up(level, sample_rows);
+        sample.rows(sample_rows);
+        return is_complete;
+    }
+
     std::vector<int> ITreeComm::fan_out(const std::shared_ptr<Comm> &comm)
+    {
+        return balanced_fan_out(comm, comm->num_rank());
+    }
+
+    std::vector<int> ITreeComm::balanced_fan_out(const std::shared_ptr<Comm> &comm,
+                                                 int num_nodes)
     {
         std::vector<int> fan_out;
-        int num_nodes = comm->num_rank();
         if (num_nodes > 1) {
             int num_fan_out = 1;
             fan_out.resize(num_fan_out);
@@ -223,4 +292,104 @@ namespace geopm
         }
         return fan_out;
     }
+
+    std::vector<int> ITreeComm::fan_out(const std::shared_ptr<Comm> &comm,
+                                        const std::vector<int> &group)
+    {
+        int num_node = group.size();
+        std::vector<int> sorted_group(group);
+        std::stable_sort(sorted_group.begin(), sorted_group.end());
+        // Among the leaf fan outs that divide the node count evenly
+        // pick the one with the fewest groups of siblings spanning
+        // more than one switch, preferring the widest on a tie.
+        int best_leaf = 0;
+        int best_num_split = INT_MAX;
+        for (int leaf = 2; leaf <= M_MAX_FAN_OUT && leaf <= num_node; ++leaf) {
+            if (num_node % leaf) {
+                continue;
+            }
+            int num_split = 0;
+            for (int first = 0; first < num_node; first += leaf) {
+                if (sorted_group[first] != sorted_group[first + leaf - 1]) {
+                    ++num_split;
+                }
+            }
+            if (num_split <= best_num_split) {
+                best_leaf = leaf;
+                best_num_split = num_split;
+            }
+        }
+        std::vector<int> result;
+        if (best_leaf == 0) {
+            result = balanced_fan_out(comm, num_node);
+        }
+        else {
+            result = balanced_fan_out(comm, num_node / best_leaf);
+            result.push_back(best_leaf);
+        }
+        return result;
+    }
+
+    std::vector<int> ITreeComm::switch_group(const std::shared_ptr<Comm> &comm,
+                                             const std::string &topology_path,
+                                             const std::string &hostname)
+    {
+        std::vector<int> result;
+        if (topology_path.empty()) {
+            return result;
+        }
+        std::ifstream topology(topology_path);
+        if (!topology.good()) {
+            throw Exception("ITreeComm::switch_group(): unable to open topology file: " + topology_path,
+                            GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+        }
+        std::map<std::string, int> switch_idx;
+        int group = -1;
+        std::string line;
+        while (std::getline(topology, line)) {
+            std::istringstream line_stream(line);
+            std::string host_name;
+            std::string switch_name;
+            if (!(line_stream >> host_name) || host_name[0] == '#') {
+                continue;
+            }
+            if (!(line_stream >> switch_name)) {
+                throw Exception("ITreeComm::switch_group(): no switch given for host " + host_name +
+                                " in topology file: " + topology_path,
+                                GEOPM_ERROR_FILE_PARSE, __FILE__, __LINE__);
+            }
+            auto it = switch_idx.emplace(switch_name, (int)switch_idx.size()).first;
+            if (host_name == hostname) {
+                group = it->second;
+            }
+        }
+        if (group == -1) {
+            group = switch_idx.size();
+        }
+        int num_rank = comm->num_rank();
+        result.resize(num_rank);
+        comm->gather(&group, sizeof(int), result.data(), sizeof(int), 0);
+        comm->broadcast(result.data(), num_rank * sizeof(int), 0);
+        // Keep rank zero at the root of the tree
+        int root_group = result[0];
+        for (auto &it : result) {
+            if (it == root_group) {
+                it = 0;
+            }
+            else if (it == 0) {
+                it = root_group;
+            }
+        }
+        return result;
+    }
+
+    std::string TreeComm::hostname(void)
+    {
+        char hostname[NAME_MAX];
+        int err = gethostname(hostname, NAME_MAX);
+        if (err) {
+            throw Exception("TreeComm::hostname() gethostname() failed", err, __FILE__, __LINE__);
+        }
+        return hostname;
+    }
 }
@@ -34,11 +34,14 @@
 #define TREECOMM_HPP_INCLUDE
 
 #include <vector>
+#include <string>
+#include <memory>
+
+#include "TreeCommLevel.hpp"
 
 namespace geopm
 {
     class Comm;
-    class ITreeCommLevel;
 
     class ITreeComm
     {
@@ -72,12 +75,49 @@ namespace geopm
             virtual bool receive_up(int level, std::vector<std::vector<double> > &sample) = 0;
             /// @brief Receive policies from the parent within a level.
             virtual bool receive_down(int level, std::vector<double> &policy) = 0;
+            /// @brief Send policies down to children within a level
+            ///        from a matrix with one row per child.
+            virtual void send_down(int level, const ChildMatrix &policy);
+            /// @brief Receive samples from children within a level
+            ///        into a matrix with one row per child.
+            virtual bool receive_up(int level, ChildMatrix &sample);
             /// @brief Returns the total number of bytes sent from the
             ///        entire tree.
             virtual size_t overhead_send(void) const = 0;
+            /// @brief Set change thresholds for the samples sent up
+            ///        to the parent within a level.
+            virtual void sample_threshold(int level, const std::vector<SampleFilter::m_threshold_s> &threshold) = 0;
             /// @brief Returns the number of children at each level.
             static std::vector<int> fan_out(const std::shared_ptr<Comm> &comm);
+            /// @brief Returns the number of children at each level
+            ///        with the leaf level sized so that siblings are
+            ///        attached to the same switch where possible.
+            ///
+            /// @param [in] group Switch index of each rank in the
+            ///        order the ranks will be placed in the tree.
+            static std::vector<int> fan_out(const std::shared_ptr<Comm> &comm,
+                                            const std::vector<int> &group);
+            /// @brief Returns the switch index of every rank in comm
+            ///        as listed in a topology file.
+            ///
+            /// Each line of the file holds a host name followed by
+            /// the name of its leaf switch.  Switches are indexed in
+            /// the order they first appear, except that the switch
+            /// of rank zero is always index zero.  Hosts that are
+            /// not listed are given an index after all switches.
+            /// This is a collective call; returns an empty vector if
+            /// topology_path is empty.
+            ///
+            /// @param [in] topology_path Path to the topology file.
+            ///
+            /// @param [in] hostname Name of the host of the calling
+            ///        rank.
+            static std::vector<int> switch_group(const std::shared_ptr<Comm> &comm,
+                                                 const std::string &topology_path,
+                                                 const std::string &hostname);
         private:
+            static std::vector<int> balanced_fan_out(const std::shared_ptr<Comm> &comm,
+                                                     int num_node);
             enum m_tree_comm_const_e {
                 M_MAX_FAN_OUT = 16,
             };
@@ -105,8 +145,18 @@ namespace geopm
             void send_up(int level, const std::vector<double> &sample) override;
             bool receive_down(int level, std::vector<double> &policy) override;
             bool receive_up(int level, std::vector<std::vector<double> > &sample) override;
+            void send_down(int level, const ChildMatrix &policy) override;
+            bool receive_up(int level, ChildMatrix &sample) override;
             size_t overhead_send(void) const override;
+            void sample_threshold(int level, const std::vector<SampleFilter::m_threshold_s> &threshold) override;
         private:
+            /// @brief Orders the ranks of comm by switch before
+            ///        building the tree if group is not empty.
+            TreeComm(std::shared_ptr<Comm> comm,
+                     const std::vector<int> &group,
+                     int num_send_down,
+                     int num_send_up);
+            static std::string hostname(void);
             int num_level_controlled(std::vector<int> coords);
             std::vector<std::unique_ptr<ITreeCommLevel> > init_level(
                 std::shared_ptr<Comm> comm_cart, int root_level);
@@ -54,7 +54,8 @@ namespace geopm
         , m_num_send_down(num_send_down)
     {
         if (!m_rank) {
-            m_policy_last.resize(m_size, std::vector<double>(num_send_down, 0.0));
+            m_policy_last = ChildMatrix(m_size, num_send_down);
+            m_policy_last.fill(0.0);
         }
         create_window();
     }
@@ -85,13 +86,18 @@ namespace geopm
             throw Exception("TreeCommLevel::send_up(): sample vector is not sized correctly.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        size_t msg_size = m_num_send_up * sizeof(double);
+        size_t slot_size = m_num_send_up * sizeof(double);
+        // Unchanged samples only set the ready flag, the parent
+        // reuses the values left in the mailbox.
+        size_t msg_size = m_sample_filter.is_send(sample) ? slot_size : 0;
         double is_ready = 1.0;
         if (m_rank) {
-            size_t base_off = m_rank * (msg_size + sizeof(double));
+            size_t base_off = m_rank * (slot_size + sizeof(double));
             m_comm->window_lock(m_sample_window, true, 0, 0);
             m_comm->window_put(&is_ready, sizeof(double), 0, base_off, m_sample_window);
-            m_comm->window_put(sample.data(), msg_size, 0, base_off + sizeof(double), m_sample_window);
+            if (msg_size) {
+                m_comm->window_put(sample.data(), msg_size, 0, base_off + sizeof(double), m_sample_window);
+            }
             m_comm->window_unlock(m_sample_window, 0);
             m_overhead_send += sizeof(double) + msg_size;
         }
@@ -102,6 +108,19 @@ namespace geopm
     }
 
     void TreeCommLevel::send_down(const std::vector<std::vector<double> > &policy)
+    {
+        size_t num_down = m_num_send_down;
+        if (m_size != (int)policy.size() ||
+            std::any_of(policy.begin(), policy.end(),
+                        [num_down](const std::vector<double> &it)
+                        {return it.size() != num_down;})) {
+            throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        send_down(ChildMatrix(policy));
+    }
+
+    void TreeCommLevel::send_down(const ChildMatrix &policy)
     {
 #ifdef GEOPM_DEBUG
         if (m_rank != 0) {
@@ -109,33 +128,51 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        size_t num_down = m_num_send_down;
-        if (m_size != (int)policy.size() ||
-            std::any_of(policy.begin(), policy.end(),
-                        [num_down](std::vector<double> it)
-                        {return it.size() != num_down;})) {
-            throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
+        if (m_size != (int)policy.num_child() ||
+            policy.num_field() != m_num_send_down) {
+            throw Exception("TreeCommLevel::send_down(): policy matrix is not sized correctly.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         size_t msg_size = sizeof(double) * m_num_send_down;
         double is_ready = 1.0;
         m_policy_mailbox[0] = is_ready;
         // Copy message to self for rank zero
-        memcpy(m_policy_mailbox + 1, policy[0].data(), msg_size);
+        memcpy(m_policy_mailbox + 1, policy.row(0), msg_size);
 
         for (int child_rank = 1; child_rank != m_size; ++child_rank) {
-            if (policy[child_rank] != m_policy_last[child_rank]) {
+            const double *child_policy = policy.row(child_rank);
+            double *last_policy = m_policy_last.row(child_rank);
+            if (!std::equal(child_policy, child_policy + m_num_send_down, last_policy)) {
                 m_comm->window_lock(m_policy_window, true, child_rank, 0);
                 m_comm->window_put(&is_ready, sizeof(double), child_rank, 0, m_policy_window);
-                m_comm->window_put(policy[child_rank].data(), msg_size, child_rank, sizeof(double), m_policy_window);
+                m_comm->window_put(child_policy, msg_size, child_rank, sizeof(double), m_policy_window);
                 m_comm->window_unlock(m_policy_window, child_rank);
                 m_overhead_send += sizeof(double) + msg_size;
-                m_policy_last[child_rank] = policy[child_rank];
+                memcpy(last_policy, child_policy, msg_size);
             }
         }
     }
 
     bool TreeCommLevel::receive_up(std::vector<std::vector<double> > &sample)
+    {
+        size_t num_up = m_num_send_up;
+        if (m_size != (int)sample.size() ||
+            std::any_of(sample.begin(), sample.end(),
+                        [num_up](const std::vector<double> &it)
+                        {return it.size() != num_up;})) {
+            throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        ChildMatrix sample_mat(sample);
+        bool is_complete = receive_up(sample_mat);
+        for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+            std::copy(sample_mat.row(child_rank), sample_mat.row(child_rank) + m_num_send_up,
+                      sample[child_rank].begin());
+        }
+        return is_complete;
+    }
+
+    bool TreeCommLevel::receive_up(ChildMatrix &sample)
     {
 #ifdef GEOPM_DEBUG
         if (m_rank != 0) {
@@ -143,12 +180,9 @@ namespace geopm
                             GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
         }
 #endif
-        size_t num_up = m_num_send_up;
-        if (m_size != (int)sample.size() ||
-            std::any_of(sample.begin(), sample.end(),
-                        [num_up](std::vector<double> it)
-                        {return it.size() != num_up;})) {
-            throw Exception("TreeCommLevel::send_down(): policy vector is not sized correctly.",
+        if (m_size != (int)sample.num_child() ||
+            sample.num_field() != m_num_send_up) {
+            throw Exception("TreeCommLevel::receive_up(): sample matrix is not sized correctly.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
@@ -163,22 +197,14 @@ namespace geopm
         if (is_complete) {
             m_comm->window_lock(m_sample_window, true, 0, 0);
             for (int child_rank = 0; child_rank != m_size; ++child_rank) {
-                memcpy(sample[child_rank].data(),
+                memcpy(sample.row(child_rank),
                        m_sample_mailbox + child_rank * (m_num_send_up + 1) + 1,
                        sizeof(double) * m_num_send_up);
                 m_sample_mailbox[child_rank * (m_num_send_up + 1)] = 0.0;
             }
             m_comm->window_unlock(m_sample_window, 0);
         }
-
-        is_complete = is_complete &&
-                      std::none_of(sample.begin(), sample.end(),
-                                   [](const std::vector<double> &vec)
-                                   {
-                                       return std::any_of(vec.begin(), vec.end(),
-                                                          [](double val){return std::isnan(val);});
-                                   });
-        return is_complete;
+        return is_complete && !sample.is_any_nan();
     }
 
     bool TreeCommLevel::receive_down(std::vector<double> &policy)
@@ -206,6 +232,15 @@ namespace geopm
         return m_overhead_send;
     }
 
+    void TreeCommLevel::sample_threshold(const std::vector<SampleFilter::m_threshold_s> &threshold)
+    {
+        if (!threshold.empty() && threshold.size() != m_num_send_up) {
+            throw Exception("TreeCommLevel::sample_threshold(): threshold vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_sample_filter.threshold(threshold);
+    }
+
     void TreeCommLevel::create_window()
     {
         // Create policy window
@@ -231,3 +266,325 @@ namespace geopm
         }
     }
 }
+
+namespace geopm
+{
+    SequenceTreeCommLevel::SequenceTreeCommLevel(std::shared_ptr<Comm> comm, int num_send_up, int num_send_down)
+        : m_comm(comm)
+        , m_size(comm->num_rank())
+        , m_rank(comm->rank())
+        , m_is_shared(false)
+        , m_num_send_up(num_send_up)
+        , m_num_send_down(num_send_down)
+        , m_sample_slot_size(slot_size(num_send_up))
+        , m_policy_slot_size(slot_size(num_send_down))
+        , m_sample_mailbox(nullptr)
+        , m_policy_mailbox(nullptr)
+        , m_sample_window(0)
+        , m_policy_window(0)
+        , m_overhead_send(0)
+        , m_sample_seq(0)
+        , m_seq_out(0)
+        , m_is_sample_sync(false)
+        , m_is_policy_sync(false)
+    {
+        if (!m_rank) {
+            m_policy_last = ChildMatrix(m_size, num_send_down);
+            m_policy_last.fill(0.0);
+            m_policy_seq.resize(m_size, 0);
+            m_sample_seen.resize(m_size, 0);
+        }
+        create_window();
+    }
+
+    SequenceTreeCommLevel::~SequenceTreeCommLevel()
+    {
+        m_comm->barrier();
+        m_comm->window_unlock_all(m_sample_window);
+        m_comm->window_unlock_all(m_policy_window);
+        m_comm->window_destroy(m_sample_window);
+        m_comm->window_destroy(m_policy_window);
+        // Shared windows own their memory
+        if (!m_is_shared) {
+            if (m_sample_mailbox) {
+                m_comm->free_mem(m_sample_mailbox);
+            }
+            if (m_policy_mailbox) {
+                m_comm->free_mem(m_policy_mailbox);
+            }
+        }
+    }
+
+    int SequenceTreeCommLevel::level_rank(void) const
+    {
+        return m_rank;
+    }
+
+    void SequenceTreeCommLevel::send_up(const std::vector<double> &sample)
+    {
+        if (sample.size() != m_num_send_up) {
+            throw Exception("SequenceTreeCommLevel::send_up(): sample vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        off_t disp = m_rank * m_sample_slot_size;
+        char *slot = nullptr;
+        if (!m_rank || m_is_shared) {
+            slot = m_sample_mailbox + disp;
+        }
+        size_t msg_size = 0;
+        if (m_sample_filter.is_send(sample)) {
+            ++m_sample_seq;
+            write_slot(m_sample_window, slot, 0, disp, m_sample_seq, sample.data(), m_num_send_up);
+            msg_size = m_num_send_up * sizeof(double);
+        }
+        else {
+            // Skipping a sequence number keeps the buffer holding
+            // the last sample sent current.
+            m_sample_seq += 2;
+            write_slot(m_sample_window, slot, 0, disp, m_sample_seq, nullptr, 0);
+        }
+        if (m_rank) {
+            m_overhead_send += sizeof(uint64_t) + msg_size;
+        }
+    }
+
+    void SequenceTreeCommLevel::send_down(const std::vector<std::vector<double> > &policy)
+    {
+        size_t num_down = m_num_send_down;
+        if (m_size != (int)policy.size() ||
+            std::any_of(policy.begin(), policy.end(),
+                        [num_down](const std::vector<double> &it)
+                        {return it.size() != num_down;})) {
+            throw Exception("SequenceTreeCommLevel::send_down(): policy vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        send_down(ChildMatrix(policy));
+    }
+
+    void SequenceTreeCommLevel::send_down(const ChildMatrix &policy)
+    {
+#ifdef GEOPM_DEBUG
+        if (m_rank != 0) {
+            throw Exception("SequenceTreeCommLevel::send_down() called from rank not at root of level",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        if (m_size != (int)policy.num_child() ||
+            policy.num_field() != m_num_send_down) {
+            throw Exception("SequenceTreeCommLevel::send_down(): policy matrix is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Copy message to self for rank zero
+        ++m_policy_seq[0];
+        write_slot(m_policy_window, m_policy_mailbox, 0, 0, m_policy_seq[0], policy.row(0), m_num_send_down);
+
+        for (int child_rank = 1; child_rank != m_size; ++child_rank) {
+            const double *child_policy = policy.row(child_rank);
+            double *last_policy = m_policy_last.row(child_rank);
+            if (!std::equal(child_policy, child_policy + m_num_send_down, last_policy)) {
+                char *slot = m_is_shared ? m_policy_peer[child_rank] : nullptr;
+                ++m_policy_seq[child_rank];
+                write_slot(m_policy_window, slot, child_rank, 0, m_policy_seq[child_rank], child_policy, m_num_send_down);
+                m_overhead_send += sizeof(uint64_t) + m_num_send_down * sizeof(double);
+                std::copy(child_policy, child_policy + m_num_send_down, last_policy);
+            }
+        }
+    }
+
+    bool SequenceTreeCommLevel::receive_up(std::vector<std::vector<double> > &sample)
+    {
+        size_t num_up = m_num_send_up;
+        if (m_size != (int)sample.size() ||
+            std::any_of(sample.begin(), sample.end(),
+                        [num_up](const std::vector<double> &it)
+                        {return it.size() != num_up;})) {
+            throw Exception("SequenceTreeCommLevel::receive_up(): sample vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        ChildMatrix sample_mat(sample);
+        bool is_complete = receive_up(sample_mat);
+        for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+            std::copy(sample_mat.row(child_rank), sample_mat.row(child_rank) + m_num_send_up,
+                      sample[child_rank].begin());
+        }
+        return is_complete;
+    }
+
+    bool SequenceTreeCommLevel::receive_up(ChildMatrix &sample)
+    {
+#ifdef GEOPM_DEBUG
+        if (m_rank != 0) {
+            throw Exception("SequenceTreeCommLevel::receive_up(): Only zero rank of the level can call receive_up()",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        if (m_size != (int)sample.num_child() ||
+            sample.num_field() != m_num_send_up) {
+            throw Exception("SequenceTreeCommLevel::receive_up(): sample matrix is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        if (m_is_sample_sync) {
+            m_comm->window_sync(m_sample_window);
+        }
+        // Complete only once every child has published a sample
+        // that has not been consumed yet.
+        bool is_complete = true;
+        for (int child_rank = 0; is_complete && child_rank < m_size; ++child_rank) {
+            const uint64_t *seq = (const uint64_t *)(m_sample_mailbox + child_rank * m_sample_slot_size);
+            if (__atomic_load_n(seq, __ATOMIC_ACQUIRE) == m_sample_seen[child_rank]) {
+                is_complete = false;
+            }
+        }
+        if (is_complete) {
+            for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+                m_sample_seen[child_rank] = read_slot(m_sample_mailbox + child_rank * m_sample_slot_size,
+                                                      m_num_send_up, sample.row(child_rank));
+            }
+        }
+        return is_complete && !sample.is_any_nan();
+    }
+
+    bool SequenceTreeCommLevel::receive_down(std::vector<double> &policy)
+    {
+        bool is_complete = false;
+        if (m_is_policy_sync) {
+            m_comm->window_sync(m_policy_window);
+        }
+        if (__atomic_load_n((const uint64_t *)m_policy_mailbox, __ATOMIC_ACQUIRE)) {
+            is_complete = true;
+            policy.resize(m_num_send_down);
+            read_slot(m_policy_mailbox, m_num_send_down, policy.data());
+        }
+        is_complete = is_complete &&
+                      std::none_of(policy.begin(), policy.end(),
+                                   [](double val){return std::isnan(val);});
+        return is_complete;
+    }
+
+    size_t SequenceTreeCommLevel::overhead_send(void) const
+    {
+        return m_overhead_send;
+    }
+
+    void SequenceTreeCommLevel::sample_threshold(const std::vector<SampleFilter::m_threshold_s> &threshold)
+    {
+        if (!threshold.empty() && threshold.size() != m_num_send_up) {
+            throw Exception("SequenceTreeCommLevel::sample_threshold(): threshold vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_sample_filter.threshold(threshold);
+    }
+
+    size_t SequenceTreeCommLevel::slot_size(size_t num_value)
+    {
+        return sizeof(uint64_t) + 2 * num_value * sizeof(double);
+    }
+
+    void SequenceTreeCommLevel::write_slot(size_t window_id, char *slot, int target_rank, off_t disp,
+                                           uint64_t seq, const double *msg, size_t num_value)
+    {
+        size_t msg_size = num_value * sizeof(double);
+        off_t payload_off = sizeof(uint64_t) + (seq % 2) * msg_size;
+        if (slot) {
+            if (msg_size) {
+                memcpy(slot + payload_off, msg, msg_size);
+            }
+            __atomic_store_n((uint64_t *)slot, seq, __ATOMIC_RELEASE);
+        }
+        else {
+            // MPI does not order puts to the same target, so each put
+            // is completed at the target before the next is issued.
+            // The first flush keeps the sequence number from landing
+            // before its payload; the second keeps the payload of the
+            // message after next from overwriting this buffer before
+            // the next sequence number has landed.
+            if (msg_size) {
+                m_comm->window_put(msg, msg_size, target_rank, disp + payload_off, window_id);
+                m_comm->window_flush(window_id, target_rank);
+            }
+            m_seq_out = seq;
+            m_comm->window_put(&m_seq_out, sizeof(uint64_t), target_rank, disp, window_id);
+            m_comm->window_flush(window_id, target_rank);
+        }
+    }
+
+    uint64_t SequenceTreeCommLevel::read_slot(const char *slot, size_t num_value, double *msg)
+    {
+        const uint64_t *seq_ptr = (const uint64_t *)slot;
+        uint64_t check = __atomic_load_n(seq_ptr, __ATOMIC_ACQUIRE);
+        uint64_t seq = 0;
+        while (check != seq) {
+            // The sender only reuses buffer seq % 2 after publishing
+            // seq + 1, so the copy is intact if seq did not move.
+            seq = check;
+            memcpy(msg, slot + sizeof(uint64_t) + (seq % 2) * num_value * sizeof(double),
+                   num_value * sizeof(double));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            check = __atomic_load_n(seq_ptr, __ATOMIC_RELAXED);
+        }
+        return seq;
+    }
+
+    void SequenceTreeCommLevel::create_window(void)
+    {
+        m_is_shared = m_comm->is_node_local();
+        size_t sample_size = m_rank ? 0 : m_size * m_sample_slot_size;
+        if (m_is_shared) {
+            void *base = nullptr;
+            m_sample_window = m_comm->window_create_shared(sample_size, &base);
+            m_sample_mailbox = (char *)m_comm->window_shared_query(m_sample_window, 0);
+            if (!m_rank) {
+                memset(m_sample_mailbox, 0, sample_size);
+            }
+            m_policy_window = m_comm->window_create_shared(m_policy_slot_size, &base);
+            m_policy_mailbox = (char *)base;
+            memset(m_policy_mailbox, 0, m_policy_slot_size);
+            if (!m_rank) {
+                m_policy_peer.resize(m_size, nullptr);
+                for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+                    m_policy_peer[child_rank] = (char *)m_comm->window_shared_query(m_policy_window, child_rank);
+                }
+            }
+            // Mailboxes must be cleared before any peer writes
+            m_comm->barrier();
+        }
+        else {
+            if (!m_rank) {
+                m_comm->alloc_mem(sample_size, (void **)(&m_sample_mailbox));
+                memset(m_sample_mailbox, 0, sample_size);
+                m_sample_window = m_comm->window_create(sample_size, (void *)(m_sample_mailbox));
+            }
+            else {
+                m_sample_window = m_comm->window_create(0, NULL);
+            }
+            m_comm->alloc_mem(m_policy_slot_size, (void **)(&m_policy_mailbox));
+            memset(m_policy_mailbox, 0, m_policy_slot_size);
+            if (m_rank) {
+                m_policy_window = m_comm->window_create(m_policy_slot_size, (void *)(m_policy_mailbox));
+            }
+            else {
+                m_policy_window = m_comm->window_create(0, NULL);
+            }
+        }
+        m_comm->window_lock_all(m_sample_window);
+        m_comm->window_lock_all(m_policy_window);
+        // Mailboxes are read with plain loads, which only observe
+        // puts without MPI_Win_sync() in the unified memory model
+        m_is_sample_sync = !m_comm->window_is_unified(m_sample_window);
+        m_is_policy_sync = !m_comm->window_is_unified(m_policy_window);
+    }
+
+    void ITreeCommLevel::send_down(const ChildMatrix &policy)
+    {
+        send_down(policy.rows());
+    }
+
+    bool ITreeCommLevel::receive_up(ChildMatrix &sample)
+    {
+        std::vector<std::vector<double> > sample_rows = sample.rows();
+        bool is_complete = receive_up(sample_rows);
+        sample.rows(sample_rows);
+        return is_complete;
+    }
+}
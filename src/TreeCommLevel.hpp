@@ -33,9 +33,14 @@
 #ifndef TREECOMMLEVEL_HPP_INCLUDE
 #define TREECOMMLEVEL_HPP_INCLUDE
 
+#include <stdint.h>
+
 #include <vector>
 #include <memory>
 
+#include "ChildMatrix.hpp"
+#include "SampleFilter.hpp"
+
 namespace geopm
 {
     class Comm;
@@ -55,9 +60,24 @@ namespace geopm
             virtual bool receive_up(std::vector<std::vector<double> > &sample) = 0;
             /// @brief Receive policies down from the parent.
             virtual bool receive_down(std::vector<double> &policy) = 0;
+            /// @brief Send policies down to children from a matrix
+            ///        with one row per child.  The default
+            ///        implementation copies through the vector of
+            ///        rows interface.
+            virtual void send_down(const ChildMatrix &policy);
+            /// @brief Receive samples up from children into a matrix
+            ///        with one row per child.  The default
+            ///        implementation copies through the vector of
+            ///        rows interface.
+            virtual bool receive_up(ChildMatrix &sample);
             /// @brief Returns the total number of bytes sent at this
             ///        level.
             virtual size_t overhead_send(void) const = 0;
+            /// @brief Set change thresholds for the samples sent up.
+            ///        Samples that do not move beyond the thresholds
+            ///        are sent without payload and the parent reuses
+            ///        the previous values.
+            virtual void sample_threshold(const std::vector<SampleFilter::m_threshold_s> &threshold) = 0;
     };
 
     class TreeCommLevel : public ITreeCommLevel
@@ -70,7 +90,10 @@ namespace geopm
             void send_down(const std::vector<std::vector<double> > &policy) override;
             bool receive_up(std::vector<std::vector<double> > &sample) override;
             bool receive_down(std::vector<double> &policy) override;
+            void send_down(const ChildMatrix &policy) override;
+            bool receive_up(ChildMatrix &sample) override;
             size_t overhead_send(void) const override;
+            void sample_threshold(const std::vector<SampleFilter::m_threshold_s> &threshold) override;
         private:
             void create_window();
             std::shared_ptr<Comm> m_comm;
@@ -81,9 +104,76 @@ namespace geopm
             size_t m_sample_window;
             size_t m_policy_window;
             size_t m_overhead_send;
-            std::vector<std::vector<double> > m_policy_last;
+            ChildMatrix m_policy_last;
             size_t m_num_send_up;
             size_t m_num_send_down;
+            SampleFilter m_sample_filter;
+    };
+
+    /// @brief Tree level that passes messages through sequence
+    ///        numbered mailboxes.
+    ///
+    /// Each mailbox holds a sequence number followed by two payload
+    /// buffers.  The sender writes message s into buffer s % 2 and
+    /// then publishes s, so the receiver always reads a complete
+    /// message without taking a window lock.  When every rank of the
+    /// level shares a node the mailboxes live in an MPI shared memory
+    /// window and are accessed with loads and stores; otherwise one
+    /// passive target epoch is held for the lifetime of the level and
+    /// each message is written with two puts, each completed at the
+    /// target by a flush before the next is issued.  Windows that do
+    /// not use the unified memory model are synchronized before the
+    /// mailboxes are read.
+    class SequenceTreeCommLevel : public ITreeCommLevel
+    {
+        public:
+            SequenceTreeCommLevel(std::shared_ptr<Comm> comm, int num_send_up, int num_send_down);
+            virtual ~SequenceTreeCommLevel();
+            int level_rank(void) const override;
+            void send_up(const std::vector<double> &sample) override;
+            void send_down(const std::vector<std::vector<double> > &policy) override;
+            bool receive_up(std::vector<std::vector<double> > &sample) override;
+            bool receive_down(std::vector<double> &policy) override;
+            void send_down(const ChildMatrix &policy) override;
+            bool receive_up(ChildMatrix &sample) override;
+            size_t overhead_send(void) const override;
+            void sample_threshold(const std::vector<SampleFilter::m_threshold_s> &threshold) override;
+        private:
+            void create_window(void);
+            /// @brief Size in bytes of a mailbox carrying messages
+            ///        of num_value doubles.
+            static size_t slot_size(size_t num_value);
+            /// @brief Write the message into the mailbox of the
+            ///        target rank of the window and publish seq.  A
+            ///        message of zero values only publishes seq.
+            void write_slot(size_t window_id, char *slot, int target_rank, off_t disp,
+                            uint64_t seq, const double *msg, size_t num_value);
+            /// @brief Copy the most recent message out of a mailbox,
+            ///        returns its sequence number or zero if nothing
+            ///        has been published.
+            static uint64_t read_slot(const char *slot, size_t num_value, double *msg);
+            std::shared_ptr<Comm> m_comm;
+            int m_size;
+            int m_rank;
+            bool m_is_shared;
+            size_t m_num_send_up;
+            size_t m_num_send_down;
+            size_t m_sample_slot_size;
+            size_t m_policy_slot_size;
+            char *m_sample_mailbox;
+            char *m_policy_mailbox;
+            std::vector<char *> m_policy_peer;
+            size_t m_sample_window;
+            size_t m_policy_window;
+            size_t m_overhead_send;
+            uint64_t m_sample_seq;
+            std::vector<uint64_t> m_policy_seq;
+            std::vector<uint64_t> m_sample_seen;
+            uint64_t m_seq_out;
+            bool m_is_sample_sync;
+            bool m_is_policy_sync;
+            ChildMatrix m_policy_last;
+            SampleFilter m_sample_filter;
     };
 }
 
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "WindowStatistics.hpp"
+#include "Exception.hpp"
+#include "config.h"
+
+namespace geopm
+{
+    WindowStatistics::WindowStatistics()
+        : WindowStatistics(0)
+    {
+
+    }
+
+    WindowStatistics::WindowStatistics(unsigned int size)
+        : m_window(size)
+        , m_sum(0.0)
+        , m_sum_squares(0.0)
+        , m_num_remove(0)
+    {
+        m_sorted.reserve(size);
+    }
+
+    void WindowStatistics::set_capacity(const unsigned int size)
+    {
+        m_window.set_capacity(size);
+        m_sorted.clear();
+        m_sorted.reserve(size);
+        for (int idx = 0; idx < m_window.size(); ++idx) {
+            double value = m_window.value(idx);
+            if (!std::isnan(value)) {
+                m_sorted.insert(std::upper_bound(m_sorted.begin(), m_sorted.end(), value), value);
+            }
+        }
+        resum();
+    }
+
+    void WindowStatistics::clear(void)
+    {
+        m_window.clear();
+        m_sorted.clear();
+        resum();
+    }
+
+    int WindowStatistics::size(void) const
+    {
+        return m_window.size();
+    }
+
+    int WindowStatistics::capacity(void) const
+    {
+        return m_window.capacity();
+    }
+
+    void WindowStatistics::insert(const double value)
+    {
+        if (m_window.capacity() < 1) {
+            throw Exception("WindowStatistics::insert(): Cannot insert into a buffer of 0 size",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        if (m_window.size() == m_window.capacity()) {
+            remove(m_window.value(0));
+        }
+        m_window.insert(value);
+        add(value);
+    }
+
+    const double& WindowStatistics::value(const unsigned int index) const
+    {
+        return m_window.value(index);
+    }
+
+    std::vector<double> WindowStatistics::make_vector(void) const
+    {
+        return m_window.make_vector();
+    }
+
+    void WindowStatistics::add(double value)
+    {
+        if (!std::isnan(value)) {
+            m_sorted.insert(std::upper_bound(m_sorted.begin(), m_sorted.end(), value), value);
+            m_sum += value;
+            m_sum_squares += value * value;
+        }
+    }
+
+    void WindowStatistics::remove(double value)
+    {
+        if (!std::isnan(value)) {
+            m_sorted.erase(std::lower_bound(m_sorted.begin(), m_sorted.end(), value));
+            ++m_num_remove;
+            if (m_num_remove >= (size_t)m_window.capacity()) {
+                // Subtracting values that left the window accumulates
+                // rounding error, so the sums are rebuilt once per
+                // window length which keeps inserts constant time on
+                // average.
+                resum();
+            }
+            else {
+                m_sum -= value;
+                m_sum_squares -= value * value;
+            }
+        }
+    }
+
+    void WindowStatistics::resum(void)
+    {
+        m_sum = 0.0;
+        m_sum_squares = 0.0;
+        for (auto value : m_sorted) {
+            m_sum += value;
+            m_sum_squares += value * value;
+        }
+        m_num_remove = 0;
+    }
+
+    double WindowStatistics::sum(void) const
+    {
+        return m_sorted.size() ? m_sum : NAN;
+    }
+
+    double WindowStatistics::mean(void) const
+    {
+        return sum() / m_sorted.size();
+    }
+
+    double WindowStatistics::variance(void) const
+    {
+        double result = NAN;
+        size_t num_value = m_sorted.size();
+        if (num_value > 1) {
+            result = (m_sum_squares - m_sum * m_sum / num_value) / (num_value - 1);
+            // Cancellation may leave a small negative number.
+            if (result < 0.0) {
+                result = 0.0;
+            }
+        }
+        else if (num_value == 1) {
+            result = 0.0;
+        }
+        return result;
+    }
+
+    double WindowStatistics::stddev(void) const
+    {
+        return std::sqrt(variance());
+    }
+
+    double WindowStatistics::median(void) const
+    {
+        double result = NAN;
+        size_t num_value = m_sorted.size();
+        if (num_value) {
+            size_t mid_idx = num_value / 2;
+            result = m_sorted[mid_idx];
+            if (num_value % 2 == 0) {
+                result += m_sorted[mid_idx - 1];
+                result /= 2.0;
+            }
+        }
+        return result;
+    }
+
+    double WindowStatistics::percentile(double percent) const
+    {
+        if (!(percent >= 0.0 && percent <= 100.0)) {
+            throw Exception("WindowStatistics::percentile(): percent must be between 0 and 100",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        double result = NAN;
+        if (m_sorted.size()) {
+            double rank = percent / 100.0 * (m_sorted.size() - 1);
+            size_t low_idx = (size_t)rank;
+            result = m_sorted[low_idx];
+            if (low_idx + 1 < m_sorted.size()) {
+                result += (rank - low_idx) * (m_sorted[low_idx + 1] - m_sorted[low_idx]);
+            }
+        }
+        return result;
+    }
+
+    double WindowStatistics::min(void) const
+    {
+        return m_sorted.size() ? m_sorted.front() : NAN;
+    }
+
+    double WindowStatistics::max(void) const
+    {
+        return m_sorted.size() ? m_sorted.back() : NAN;
+    }
+}
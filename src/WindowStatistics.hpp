@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WINDOWSTATISTICS_HPP_INCLUDE
+#define WINDOWSTATISTICS_HPP_INCLUDE
+
+#include <vector>
+
+#include "CircularBuffer.hpp"
+
+namespace geopm
+{
+    /// @brief Circular buffer of doubles that keeps statistics of
+    ///        the values in the window current as values are
+    ///        inserted.
+    ///
+    /// A running sum and sum of squares give the mean and variance
+    /// in constant time.  A sorted copy of the window is updated
+    /// with a binary search on every insert so that the median and
+    /// any percentile are read without copying or sorting the
+    /// window.
+    ///
+    /// NAN values are kept in the window, so they count towards
+    /// size() and are returned by value() and make_vector(), but
+    /// every statistic skips them: each is computed over the values
+    /// in the window that are not NAN, and is NAN only if there are
+    /// none.  This differs from IPlatformIO::agg_*(), which do not
+    /// handle NAN consistently; for a window without NAN the results
+    /// match agg_sum(), agg_average(), agg_stddev(), agg_median(),
+    /// agg_min() and agg_max().
+    class WindowStatistics : public ICircularBuffer<double>
+    {
+        public:
+            WindowStatistics();
+            /// @brief Create an empty window holding up to size
+            ///        values.
+            WindowStatistics(unsigned int size);
+            virtual ~WindowStatistics() = default;
+            void set_capacity(const unsigned int size) override;
+            void clear(void) override;
+            int size(void) const override;
+            int capacity(void) const override;
+            void insert(const double value) override;
+            const double& value(const unsigned int index) const override;
+            std::vector<double> make_vector(void) const override;
+            /// @brief Sum of the values in the window.
+            double sum(void) const;
+            /// @brief Mean of the values in the window.
+            double mean(void) const;
+            /// @brief Sample variance of the values in the window,
+            ///        zero for one value.
+            double variance(void) const;
+            /// @brief Sample standard deviation of the values in the
+            ///        window.
+            double stddev(void) const;
+            /// @brief Median of the values in the window.
+            double median(void) const;
+            /// @brief Percentile of the values in the window
+            ///        interpolated linearly between the closest
+            ///        ranks.
+            /// @param [in] percent Percentile between 0 and 100.
+            double percentile(double percent) const;
+            /// @brief Smallest value in the window.
+            double min(void) const;
+            /// @brief Largest value in the window.
+            double max(void) const;
+        private:
+            void add(double value);
+            void remove(double value);
+            /// @brief Recompute the running sums from the window to
+            ///        discard the rounding error of removals.
+            void resum(void);
+            CircularBuffer<double> m_window;
+            /// @brief Values of the window that are not NAN in
+            ///        ascending order.
+            std::vector<double> m_sorted;
+            double m_sum;
+            double m_sum_squares;
+            size_t m_num_remove;
+    };
+}
+
+#endif
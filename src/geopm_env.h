@@ -61,6 +61,15 @@ int geopm_env_do_profile(void);
 int geopm_env_profile_timeout(void);
 int geopm_env_debug_attach(void);
 int geopm_env_do_kontroller(void);
+int geopm_env_do_profile_ring(void);
+int geopm_env_msr_async_period(void);
+int geopm_env_msr_num_worker(void);
+int geopm_env_do_trace_binary(void);
+int geopm_env_do_report_summary(void);
+int geopm_env_do_report_node_file(void);
+int geopm_env_do_tree_sequence(void);
+int geopm_env_do_msr_save_scoped(void);
+const char *geopm_env_tree_topology(void);
 
 #ifdef __cplusplus
 }
@@ -324,6 +324,28 @@ int geopm_sched_woomp(int num_cpu, cpu_set_t *woomp)
     return err;
 }
 
+int geopm_sched_spare_cpu(int max_num_cpu, int *spare_cpu, int *num_spare_cpu)
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    *num_spare_cpu = 0;
+    int err = pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (!err) {
+        /* Sample the CPU now rather than caching it: the caller may
+           have migrated since the last call. */
+        int caller_cpu = sched_getcpu();
+        for (int cpu_idx = CPU_SETSIZE - 1;
+             cpu_idx >= 0 && *num_spare_cpu < max_num_cpu;
+             --cpu_idx) {
+            if (cpu_idx != caller_cpu && CPU_ISSET(cpu_idx, &cpu_set)) {
+                spare_cpu[*num_spare_cpu] = cpu_idx;
+                ++(*num_spare_cpu);
+            }
+        }
+    }
+    return err;
+}
+
 #else /* __APPLE__ */
 
 void __cpuid(uint32_t*, int);
@@ -369,4 +391,10 @@ int geopm_sched_woomp(int num_cpu, cpu_set_t *woomp)
     return 0;
 }
 
+int geopm_sched_spare_cpu(int max_num_cpu, int *spare_cpu, int *num_spare_cpu)
+{
+    *num_spare_cpu = 0;
+    return 0;
+}
+
 #endif /* __APPLE__ */
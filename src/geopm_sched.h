@@ -82,6 +82,8 @@ int geopm_sched_proc_cpuset(int num_cpu, cpu_set_t *proc_cpuset);
 
 int geopm_sched_woomp(int num_cpu, cpu_set_t *woomp);
 
+int geopm_sched_spare_cpu(int max_num_cpu, int *spare_cpu, int *num_spare_cpu);
+
 int geopm_sched_popen(const char *cmd, FILE **fid);
 
 #ifdef __cplusplus
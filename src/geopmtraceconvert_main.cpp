@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <getopt.h>
+#include <errno.h>
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+
+#include "geopm_version.h"
+#include "Exception.hpp"
+#include "Tracer.hpp"
+
+#include "config.h"
+
+int main(int argc, char **argv)
+{
+    const char *usage = "\nUsage:\n"
+                        "       geopmtraceconvert BINARY_TRACE [TEXT_TRACE]\n"
+                        "       geopmtraceconvert [--help] [--version]\n"
+                        "\n"
+                        "  BINARY_TRACE: trace written with GEOPM_TRACE_BINARY set\n"
+                        "  TEXT_TRACE:   path of the text trace to create; if not\n"
+                        "                given the text trace is printed to standard output\n"
+                        "\n"
+                        "  -h, --help                       print brief summary of the command line\n"
+                        "                                   usage information, then exit\n"
+                        "  -v, --version                    print version of GEOPM to standard output,\n"
+                        "                                   then exit\n"
+                        "\n"
+                        "Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation. All rights reserved.\n"
+                        "\n";
+
+    static struct option long_options[] = {
+        {"help", no_argument, NULL, 'h'},
+        {"version", no_argument, NULL, 'v'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int opt;
+    int err = 0;
+    while (!err && (opt = getopt_long(argc, argv, "hv", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("%s", usage);
+                return 0;
+            case 'v':
+                printf("%s\n", geopm_version());
+                printf("\n\nCopyright (c) 2015, 2016, 2017, 2018, Intel Corporation. All rights reserved.\n\n");
+                return 0;
+            case '?': // opt is ? when an option required an arg but it was missing
+                fprintf(stderr, usage, argv[0]);
+                err = EINVAL;
+                break;
+            default:
+                fprintf(stderr, "Error: getopt returned character code \"0%o\"\n", opt);
+                err = EINVAL;
+                break;
+        }
+    }
+
+    std::vector<std::string> pos_args;
+    while (optind < argc) {
+        pos_args.emplace_back(argv[optind++]);
+    }
+    if (!err && (pos_args.size() < 1 || pos_args.size() > 2)) {
+        std::cerr << "Error: expected a binary trace path and an optional output path.\n" << usage;
+        err = EINVAL;
+    }
+    if (!err) {
+        try {
+            if (pos_args.size() == 2) {
+                std::ofstream text(pos_args[1]);
+                if (!text.good()) {
+                    throw geopm::Exception("unable to open " + pos_args[1] + " for writing",
+                                           errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+                geopm::Tracer::binary_to_text(pos_args[0], text);
+            }
+            else {
+                geopm::Tracer::binary_to_text(pos_args[0], std::cout);
+            }
+        }
+        catch (const geopm::Exception &ex) {
+            std::cerr << "Error: cannot convert trace: " << ex.what() << std::endl;
+            err = EINVAL;
+        }
+    }
+    return err;
+}
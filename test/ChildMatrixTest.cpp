@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <functional>
+
+#include "gtest/gtest.h"
+#include "geopm_error.h"
+#include "ChildMatrix.hpp"
+#include "Agent.hpp"
+#include "PlatformIO.hpp"
+#include "geopm_test.hpp"
+
+using geopm::ChildMatrix;
+using geopm::Agent;
+using geopm::IPlatformIO;
+
+TEST(ChildMatrixTest, layout)
+{
+    ChildMatrix empty;
+    EXPECT_EQ(0u, empty.num_child());
+    EXPECT_EQ(0u, empty.num_field());
+
+    ChildMatrix mat(3, 2);
+    EXPECT_EQ(3u, mat.num_child());
+    EXPECT_EQ(2u, mat.num_field());
+    EXPECT_EQ(2u, mat.stride());
+    EXPECT_TRUE(mat.is_any_nan());
+    mat.rows({{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}});
+    EXPECT_FALSE(mat.is_any_nan());
+    EXPECT_EQ(4.0, mat.value(1, 1));
+    EXPECT_EQ(mat.data() + mat.stride(), mat.row(1));
+    const double *column = mat.column(1);
+    EXPECT_EQ(2.0, column[0]);
+    EXPECT_EQ(4.0, column[mat.stride()]);
+    EXPECT_EQ(6.0, column[2 * mat.stride()]);
+    mat.row(2, {7.0, 8.0});
+    std::vector<std::vector<double> > expect {{1.0, 2.0}, {3.0, 4.0}, {7.0, 8.0}};
+    EXPECT_EQ(expect, mat.rows());
+    EXPECT_EQ(expect, ChildMatrix(expect).rows());
+    mat.fill(0.0);
+    EXPECT_EQ(0.0, mat.value(0, 0));
+
+    GEOPM_EXPECT_THROW_MESSAGE(mat.rows({{1.0, 2.0}}), GEOPM_ERROR_INVALID, "number of rows");
+    GEOPM_EXPECT_THROW_MESSAGE(mat.row(0, {1.0}), GEOPM_ERROR_INVALID, "does not fit");
+    GEOPM_EXPECT_THROW_MESSAGE(ChildMatrix({{1.0, 2.0}, {3.0}}), GEOPM_ERROR_INVALID, "does not fit");
+}
+
+TEST(ChildMatrixTest, aggregate_sample)
+{
+    std::vector<std::function<double(const std::vector<double>&)> > agg_func {
+        IPlatformIO::agg_sum,
+        IPlatformIO::agg_average,
+        IPlatformIO::agg_median,
+        IPlatformIO::agg_min,
+        IPlatformIO::agg_max,
+        IPlatformIO::agg_and,
+        IPlatformIO::agg_or,
+        IPlatformIO::agg_stddev,
+        [](const std::vector<double> &operand) {return operand.back();},
+    };
+    std::vector<std::vector<double> > rows {
+        {4.0, 4.0, 4.0, 4.0, 4.0, 1.0, 0.0, 4.0, 4.0},
+        {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0},
+        {3.0, 3.0, 3.0, 3.0, 3.0, 0.0, 1.0, 3.0, 3.0},
+        {2.0, 2.0, 2.0, 2.0, 2.0, 1.0, 0.0, 2.0, 2.0},
+    };
+    std::vector<double> expect(agg_func.size());
+    Agent::aggregate_sample(rows, agg_func, expect);
+    std::vector<double> result(agg_func.size(), NAN);
+    Agent::aggregate_sample(ChildMatrix(rows), agg_func, result);
+    EXPECT_EQ(expect, result);
+    EXPECT_EQ(10.0, result[0]);
+    EXPECT_EQ(2.5, result[1]);
+    EXPECT_EQ(2.5, result[2]);
+    EXPECT_EQ(1.0, result[3]);
+    EXPECT_EQ(4.0, result[4]);
+    EXPECT_EQ(0.0, result[5]);
+    EXPECT_EQ(1.0, result[6]);
+    EXPECT_EQ(2.0, result[8]);
+
+    // odd number of children
+    rows.pop_back();
+    Agent::aggregate_sample(rows, agg_func, expect);
+    Agent::aggregate_sample(ChildMatrix(rows), agg_func, result);
+    EXPECT_EQ(expect, result);
+    EXPECT_EQ(3.0, result[2]);
+}
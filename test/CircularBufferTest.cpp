@@ -31,6 +31,7 @@
  */
 
 #include <iostream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "CircularBuffer.hpp"
@@ -89,4 +90,23 @@ TEST_F(CircularBufferTest, buffer_capacity)
     EXPECT_EQ(10, m_buffer->capacity());
     m_buffer->set_capacity(2);
     EXPECT_EQ(2, m_buffer->capacity());
+    EXPECT_EQ(2, m_buffer->size());
+    EXPECT_DOUBLE_EQ(2.0, m_buffer->value(0));
+    EXPECT_DOUBLE_EQ(3.0, m_buffer->value(1));
+}
+
+TEST_F(CircularBufferTest, buffer_capacity_wrapped)
+{
+    // Resize after the head has wrapped: the newest values are kept
+    // in insertion order
+    m_buffer->set_capacity(4);
+    for (double value : {4.0, 5.0, 6.0, 7.0}) {
+        m_buffer->insert(value);
+    }
+    EXPECT_EQ(std::vector<double>({4.0, 5.0, 6.0, 7.0}), m_buffer->make_vector());
+    m_buffer->set_capacity(6);
+    EXPECT_EQ(std::vector<double>({4.0, 5.0, 6.0, 7.0}), m_buffer->make_vector());
+    m_buffer->insert(8.0);
+    m_buffer->set_capacity(3);
+    EXPECT_EQ(std::vector<double>({6.0, 7.0, 8.0}), m_buffer->make_vector());
 }
@@ -114,3 +114,51 @@ TEST(CombinedSignalTest, sample_slope_derivative)
     }
     EXPECT_NEAR(0.238, result, 0.001);
 }
+
+TEST(CombinedSignalTest, sample_derivative_window)
+{
+    EXPECT_THROW(PerRegionDerivativeCombinedSignal(1), Exception);
+    // with two samples the fit is the slope between the last two
+    PerRegionDerivativeCombinedSignal comb_signal(2);
+    std::vector<double> sample_values = {0, 1, 3, 6, 10};
+    double result = NAN;
+    for (size_t ii = 0; ii < sample_values.size(); ++ii) {
+        result = comb_signal.sample({42, (double)ii, sample_values[ii]});
+        if (ii > 0) {
+            EXPECT_DOUBLE_EQ(sample_values[ii] - sample_values[ii - 1], result);
+        }
+    }
+    // interleaved regions keep separate history
+    EXPECT_TRUE(std::isnan(comb_signal.sample({43, 5.0, 1.0})));
+    EXPECT_DOUBLE_EQ(5.0, comb_signal.sample({42, 5.0, 15.0}));
+    EXPECT_DOUBLE_EQ(-1.0, comb_signal.sample({43, 6.0, 0.0}));
+}
+
+TEST(CombinedSignalTest, sample_derivative_long_run)
+{
+    // running sums must match a direct fit of the window after many
+    // evictions with large time and energy values
+    const int num_history = 8;
+    PerRegionDerivativeCombinedSignal comb_signal(num_history);
+    std::vector<double> time(10000);
+    std::vector<double> energy(time.size());
+    for (size_t ii = 0; ii < time.size(); ++ii) {
+        time[ii] = 1e5 + 0.005 * ii;
+        energy[ii] = 1e7 + 150.0 * time[ii] + std::sin(ii);
+        double result = comb_signal.sample({7, time[ii], energy[ii]});
+        if (ii + 1 >= num_history) {
+            double A = 0.0, B = 0.0, C = 0.0, D = 0.0;
+            size_t begin = ii + 1 - num_history;
+            for (size_t jj = begin; jj <= ii; ++jj) {
+                double tt = time[jj] - time[begin];
+                double ee = energy[jj] - energy[begin];
+                A += tt * ee;
+                B += tt;
+                C += ee;
+                D += tt * tt;
+            }
+            double expect = (A - B * C / num_history) / (D - B * B / num_history);
+            EXPECT_NEAR(expect, result, 1e-6 * std::fabs(expect));
+        }
+    }
+}
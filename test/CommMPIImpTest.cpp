@@ -48,18 +48,23 @@ typedef int MPI_Info;
 typedef int MPI_Win;
 
 #define MPI_MAX                 (MPI_Op)(0x58000001)
+#define MPI_SUM                 (MPI_Op)(0x58000003)
 #define MPI_LAND                (MPI_Op)(0x58000005)
 #define MPI_UNDEFINED           (-32766)
 #define MPI_COMM_WORLD          ((MPI_Comm)0x44000000)
 #define MPI_COMM_NULL           ((MPI_Comm)0x04000000)
 #define MPI_LOCK_EXCLUSIVE      234
 #define MPI_LOCK_SHARED         235
+#define MPI_COMM_TYPE_SHARED    1
 #define MPI_CHAR                ((MPI_Datatype)0x4c000101)
 #define MPI_BYTE                ((MPI_Datatype)0x4c00010d)
 #define MPI_INT                 ((MPI_Datatype)0x4c000405)
 #define MPI_DOUBLE              ((MPI_Datatype)0x4c00080b)
 #define MPI_INFO_NULL           ((MPI_Info)0x1c000000)
 #define MPI_WIN_NULL            ((MPI_Win)0x20000000)
+#define MPI_WIN_MODEL           9
+#define MPI_WIN_SEPARATE        1
+#define MPI_WIN_UNIFIED         2
 #define MPI_MAX_ERROR_STRING    512
 typedef int                     MPI_Fint;
 #define MPI_ERR_SIZE            51
@@ -290,6 +295,77 @@ extern "C"
 #define MPI_Win_free(p0) mock_win_free(p0)
 #define PMPI_Win_free(p0) mock_win_free(p0)
 
+    static int mock_win_allocate_shared(MPI_Aint param0, int param1, MPI_Info param2, MPI_Comm param3,
+                                        void *param4, MPI_Win *param5)
+    {
+        return 0;
+    }
+
+#define MPI_Win_allocate_shared(p0, p1, p2, p3, p4, p5) mock_win_allocate_shared(p0, p1, p2, p3, p4, p5)
+#define PMPI_Win_allocate_shared(p0, p1, p2, p3, p4, p5) mock_win_allocate_shared(p0, p1, p2, p3, p4, p5)
+
+    static int mock_win_shared_query(MPI_Win param0, int param1, MPI_Aint *param2, int *param3, void *param4)
+    {
+        return 0;
+    }
+
+#define MPI_Win_shared_query(p0, p1, p2, p3, p4) mock_win_shared_query(p0, p1, p2, p3, p4)
+#define PMPI_Win_shared_query(p0, p1, p2, p3, p4) mock_win_shared_query(p0, p1, p2, p3, p4)
+
+    static int mock_win_lock_all(int param0, MPI_Win param1)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        return 0;
+    }
+
+#define MPI_Win_lock_all(p0, p1) mock_win_lock_all(p0, p1)
+#define PMPI_Win_lock_all(p0, p1) mock_win_lock_all(p0, p1)
+
+    static int mock_win_unlock_all(MPI_Win param0)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        return 0;
+    }
+
+#define MPI_Win_unlock_all(p0) mock_win_unlock_all(p0)
+#define PMPI_Win_unlock_all(p0) mock_win_unlock_all(p0)
+
+    static int mock_win_flush(int param0, MPI_Win param1)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        return 0;
+    }
+
+#define MPI_Win_flush(p0, p1) mock_win_flush(p0, p1)
+#define PMPI_Win_flush(p0, p1) mock_win_flush(p0, p1)
+#define MPI_Win_flush_local(p0, p1) mock_win_flush(p0, p1)
+#define PMPI_Win_flush_local(p0, p1) mock_win_flush(p0, p1)
+
+    static int mock_win_sync(MPI_Win param0)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        return 0;
+    }
+
+#define MPI_Win_sync(p0) mock_win_sync(p0)
+#define PMPI_Win_sync(p0) mock_win_sync(p0)
+
+    static int g_win_model = MPI_WIN_UNIFIED;
+
+    static int mock_win_get_attr(MPI_Win param0, int param1, void *param2, int *param3)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        *(int **)param2 = &g_win_model;
+        *param3 = 1;
+        return 0;
+    }
+
+#define MPI_Win_get_attr(p0, p1, p2, p3) mock_win_get_attr(p0, p1, p2, p3)
+#define PMPI_Win_get_attr(p0, p1, p2, p3) mock_win_get_attr(p0, p1, p2, p3)
+
     static int mock_win_lock(int param0, int param1, int param2, MPI_Win param3)
     {
         memcpy(g_params[0], &param0, g_sizes[0]);
@@ -372,6 +448,14 @@ extern "C"
 #define MPI_Comm_split(p0, p1, p2, p3) mock_comm_split(p0, p1, p2, p3)
 #define PMPI_Comm_split(p0, p1, p2, p3) mock_comm_split(p0, p1, p2, p3)
 
+    static int mock_comm_split_type(MPI_Comm param0, int param1, int param2, MPI_Info param3, MPI_Comm *param4)
+    {
+        return 0;
+    }
+
+#define MPI_Comm_split_type(p0, p1, p2, p3, p4) mock_comm_split_type(p0, p1, p2, p3, p4)
+#define PMPI_Comm_split_type(p0, p1, p2, p3, p4) mock_comm_split_type(p0, p1, p2, p3, p4)
+
     static int mock_comm_size(MPI_Comm param0, int *param1)
     {
         return 0;
@@ -561,6 +645,46 @@ TEST_F(CommMPIImpTest, mpi_reduce)
     check_params();
 }
 
+TEST_F(CommMPIImpTest, mpi_reduce_sum)
+{
+    MPICommTestHelper tmp_comm;
+    void *send = NULL;
+    void *recv = NULL;
+    size_t count = 1;
+    MPI_Datatype dt = MPI_DOUBLE; // used beneath API
+    MPI_Op op = MPI_SUM; // used beneath API
+    int root = 0;
+
+    g_sizes.push_back(sizeof(size_t));
+    g_params.push_back(malloc(g_sizes[0]));
+    g_sizes.push_back(sizeof(size_t));
+    g_params.push_back(malloc(g_sizes[1]));
+    g_sizes.push_back(sizeof(int));
+    g_params.push_back(malloc(g_sizes[2]));
+    g_sizes.push_back(sizeof(MPI_Datatype));
+    g_params.push_back(malloc(g_sizes[3]));
+    g_sizes.push_back(sizeof(MPI_Op));
+    g_params.push_back(malloc(g_sizes[4]));
+    g_sizes.push_back(sizeof(int));
+    g_params.push_back(malloc(g_sizes[5]));
+    g_sizes.push_back(sizeof(MPI_Comm));
+    g_params.push_back(malloc(g_sizes[6]));
+
+    size_t tmp_send = (size_t) send;
+    m_params.push_back(&tmp_send);
+    size_t tmp_recv = (size_t) recv;
+    m_params.push_back(&tmp_recv);
+    m_params.push_back(&count);
+    m_params.push_back(&dt);
+    m_params.push_back(&op);
+    m_params.push_back(&root);
+    m_params.push_back(tmp_comm.get_comm_ref());
+
+    tmp_comm.reduce_sum((double *) send, (double *) recv, count, root);
+
+    check_params();
+}
+
 TEST_F(CommMPIImpTest, mpi_allreduce)
 {
     MPICommTestHelper tmp_comm;
@@ -970,6 +1094,95 @@ TEST_F(CommMPIImpTest, mpi_win_ops)
 
     check_params();
 }
+
+TEST_F(CommMPIImpTest, mpi_win_flush_ops)
+{
+    MPICommTestHelper tmp_comm;
+
+    // win create
+    for (size_t size : {sizeof(size_t), sizeof(MPI_Aint), sizeof(int),
+                        sizeof(MPI_Info), sizeof(MPI_Comm), sizeof(size_t)}) {
+        g_sizes.push_back(size);
+        g_params.push_back(malloc(size));
+    }
+    int input  = 0;
+    size_t win_handle = tmp_comm.window_create(sizeof(input), &input);
+    MPI_Win *win = tmp_comm.get_win_ref(win_handle);
+    reset();
+
+    // lock all
+    int assert = 0;
+    g_sizes.push_back(sizeof(int));
+    g_params.push_back(malloc(g_sizes[0]));
+    g_sizes.push_back(sizeof(MPI_Win));
+    g_params.push_back(malloc(g_sizes[1]));
+    m_params.push_back(&assert);
+    m_params.push_back(win);
+    tmp_comm.window_lock_all(win_handle);
+    check_params();
+    reset();
+    m_params.clear();
+
+    // flush and flush local
+    int rank = 3;
+    for (int is_local = 0; is_local < 2; ++is_local) {
+        g_sizes.push_back(sizeof(int));
+        g_params.push_back(malloc(g_sizes[0]));
+        g_sizes.push_back(sizeof(MPI_Win));
+        g_params.push_back(malloc(g_sizes[1]));
+        m_params.push_back(&rank);
+        m_params.push_back(win);
+        if (is_local) {
+            tmp_comm.window_flush_local(win_handle, rank);
+        }
+        else {
+            tmp_comm.window_flush(win_handle, rank);
+        }
+        check_params();
+        reset();
+        m_params.clear();
+    }
+
+    // sync
+    g_sizes.push_back(sizeof(MPI_Win));
+    g_params.push_back(malloc(g_sizes[0]));
+    m_params.push_back(win);
+    tmp_comm.window_sync(win_handle);
+    check_params();
+    reset();
+    m_params.clear();
+
+    // memory model
+    int model_key = MPI_WIN_MODEL;
+    for (int model : {MPI_WIN_UNIFIED, MPI_WIN_SEPARATE}) {
+        g_win_model = model;
+        g_sizes.push_back(sizeof(MPI_Win));
+        g_params.push_back(malloc(g_sizes[0]));
+        g_sizes.push_back(sizeof(int));
+        g_params.push_back(malloc(g_sizes[1]));
+        m_params.push_back(win);
+        m_params.push_back(&model_key);
+        EXPECT_EQ(model == MPI_WIN_UNIFIED, tmp_comm.window_is_unified(win_handle));
+        check_params();
+        reset();
+        m_params.clear();
+    }
+
+    // unlock all
+    g_sizes.push_back(sizeof(MPI_Win));
+    g_params.push_back(malloc(g_sizes[0]));
+    m_params.push_back(win);
+    tmp_comm.window_unlock_all(win_handle);
+    check_params();
+    reset();
+    m_params.clear();
+
+    EXPECT_THROW(tmp_comm.window_flush(win_handle + 1, rank), geopm::Exception);
+
+    g_sizes.push_back(sizeof(size_t));
+    g_params.push_back(malloc(g_sizes[0]));
+    tmp_comm.window_destroy(win_handle);
+}
 }
 
 void geopm_factory_register(struct geopm_factory_c *factory, const geopm::Comm *in_comm, void *dl_ptr)
@@ -30,8 +30,13 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <unistd.h>
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ControlMessage.hpp"
+#include "Exception.hpp"
+#include "geopm_test.hpp"
 
 class ControlMessageTest: public geopm::ControlMessage, public testing::Test
 {
@@ -260,3 +265,42 @@ TEST_F(ControlMessageTest, loop_begin_1)
     ASSERT_EQ(M_STATUS_SHUTDOWN, m_test_ctl_msg_buffer.app_status);
 
 }
+
+TEST_F(ControlMessageTest, wait_wake)
+{
+    // The controller sleeps on the status word until the application
+    // steps from another thread.
+    std::thread app_thread([this] ()
+    {
+        usleep(20000);
+        m_test_app_msg->step();
+    });
+    m_test_ctl_msg->wait();
+    app_thread.join();
+    ASSERT_EQ(M_STATUS_MAP_BEGIN, m_test_ctl_msg_buffer.app_status);
+
+    // Same in the other direction for the name loop handshake
+    for (int i = 1; i < M_STATUS_NAME_LOOP_BEGIN; ++i) {
+        m_test_app_msg->step();
+        m_test_ctl_msg->step();
+    }
+    std::thread ctl_thread([this] ()
+    {
+        usleep(20000);
+        m_test_ctl_msg->loop_begin();
+    });
+    m_test_app_msg->loop_begin();
+    ctl_thread.join();
+    ASSERT_EQ(M_STATUS_NAME_LOOP_BEGIN, m_test_ctl_msg_buffer.ctl_status);
+    ASSERT_EQ(M_STATUS_NAME_LOOP_BEGIN, m_test_ctl_msg_buffer.app_status);
+
+    // Abort wakes the waiting side
+    std::thread abort_thread([this] ()
+    {
+        usleep(20000);
+        m_test_app_msg->abort();
+    });
+    GEOPM_EXPECT_THROW_MESSAGE(m_test_ctl_msg->wait(), GEOPM_ERROR_RUNTIME,
+                               "Abort sent through control message");
+    abort_thread.join();
+}
@@ -44,6 +44,8 @@ using geopm::EpochRuntimeRegulator;
 using geopm::IPlatformTopo;
 using testing::Return;
 using testing::_;
+using testing::ReturnPointee;
+using testing::AtLeast;
 
 class EpochRuntimeRegulatorTest : public ::testing::Test
 {
@@ -189,3 +191,105 @@ TEST_F(EpochRuntimeRegulatorTest, epoch_runtime)
     EXPECT_DOUBLE_EQ(3.0, m_regulator.total_region_runtime(region_id));
     EXPECT_DOUBLE_EQ(2.0, m_regulator.total_region_runtime(GEOPM_REGION_ID_EPOCH));
 }
+
+TEST_F(EpochRuntimeRegulatorTest, epoch_energy_sample)
+{
+    EXPECT_CALL(m_platform_io, push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(0));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(1));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(2));
+    // TIME signal counts from the zero of the geopm_time() clock so
+    // that message time stamps are equal to signal times
+    geopm_time_s zero {{0, 0}};
+    geopm_time_s now;
+    geopm_time(&now);
+    EXPECT_CALL(m_platform_io, read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(geopm_time_diff(&zero, &now)));
+    // energy comes only from the read_batch() samples
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_PACKAGE", _, _)).Times(0);
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_DRAM", _, _)).Times(0);
+    double time = 10.0;
+    double energy_pkg = 100.0;
+    double energy_dram = 50.0;
+    EXPECT_CALL(m_platform_io, sample(0)).WillRepeatedly(ReturnPointee(&time));
+    EXPECT_CALL(m_platform_io, sample(1)).WillRepeatedly(ReturnPointee(&energy_pkg));
+    EXPECT_CALL(m_platform_io, sample(2)).WillRepeatedly(ReturnPointee(&energy_dram));
+
+    m_regulator.init_unmarked_region();
+    m_regulator.notify_read_batch();
+    m_regulator.epoch(0, {{10, 0}});
+    m_regulator.epoch(1, {{10, 0}});
+    // next read_batch()
+    time = 11.0;
+    energy_pkg = 200.0;
+    energy_dram = 70.0;
+    m_regulator.notify_read_batch();
+    // energy is estimated at the time of the epoch call
+    m_regulator.epoch(0, {{11, 500000000}});
+    m_regulator.epoch(1, {{11, 500000000}});
+    EXPECT_NEAR(150.0, m_regulator.total_epoch_energy_pkg(), 0.01);
+    EXPECT_NEAR(30.0, m_regulator.total_epoch_energy_dram(), 0.01);
+}
+
+TEST_F(EpochRuntimeRegulatorTest, epoch_energy_before_read_batch)
+{
+    EXPECT_CALL(m_platform_io, push_signal(_, IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(m_platform_io, read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(0.0));
+    EXPECT_CALL(m_platform_topo, num_domain(_)).WillRepeatedly(Return(1));
+    // the pushed signals are not sampled until read_batch() is called
+    EXPECT_CALL(m_platform_io, sample(_)).Times(0);
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_PACKAGE", _, _))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(100.0));
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_DRAM", _, _))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(50.0));
+
+    m_regulator.init_unmarked_region();
+    m_regulator.epoch(0, {{10, 0}});
+    m_regulator.epoch(1, {{10, 0}});
+}
+
+TEST_F(EpochRuntimeRegulatorTest, epoch_energy_every_batch)
+{
+    EXPECT_CALL(m_platform_io, push_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(0));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_PACKAGE", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(1));
+    EXPECT_CALL(m_platform_io, push_signal("ENERGY_DRAM", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(2));
+    geopm_time_s zero {{0, 0}};
+    geopm_time_s now;
+    geopm_time(&now);
+    EXPECT_CALL(m_platform_io, read_signal("TIME", IPlatformTopo::M_DOMAIN_BOARD, 0))
+        .WillOnce(Return(geopm_time_diff(&zero, &now)));
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_PACKAGE", _, _)).Times(0);
+    EXPECT_CALL(m_platform_io, read_signal("ENERGY_DRAM", _, _)).Times(0);
+    double time = 10.0;
+    double energy_pkg = 100.0;
+    double energy_dram = 50.0;
+    EXPECT_CALL(m_platform_io, sample(0)).WillRepeatedly(ReturnPointee(&time));
+    EXPECT_CALL(m_platform_io, sample(1)).WillRepeatedly(ReturnPointee(&energy_pkg));
+    EXPECT_CALL(m_platform_io, sample(2)).WillRepeatedly(ReturnPointee(&energy_dram));
+
+    m_regulator.init_unmarked_region();
+    // batches without any epoch are still recorded, so the first
+    // epoch is estimated from the two most recent batches
+    for (int batch = 0; batch < 3; ++batch) {
+        m_regulator.notify_read_batch();
+        time += 1.0;
+        energy_pkg += 100.0;
+        energy_dram += 20.0;
+    }
+    m_regulator.epoch(0, {{12, 500000000}});
+    m_regulator.epoch(1, {{12, 500000000}});
+    m_regulator.notify_read_batch();
+    m_regulator.epoch(0, {{13, 0}});
+    m_regulator.epoch(1, {{13, 0}});
+    EXPECT_NEAR(50.0, m_regulator.total_epoch_energy_pkg(), 0.01);
+    EXPECT_NEAR(10.0, m_regulator.total_epoch_energy_dram(), 0.01);
+}
@@ -49,6 +49,7 @@
 #include "MockTreeComm.hpp"
 #include "MockReporter.hpp"
 #include "MockTracer.hpp"
+#include "MockLoopScheduler.hpp"
 #include "Helper.hpp"
 
 using geopm::Kontroller;
@@ -61,6 +62,7 @@ using testing::_;
 using testing::Return;
 using testing::AtLeast;
 using testing::ContainerEq;
+using testing::SaveArg;
 
 class KontrollerTestMockPlatformIO : public MockPlatformIO
 {
@@ -164,6 +166,7 @@ TEST_F(KontrollerTest, single_node)
 
     // step
     EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, notify_read_batch()).Times(m_num_step);
     EXPECT_CALL(m_platform_io, write_batch()).Times(m_num_step);
     EXPECT_CALL(*m_application_io, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_application_io, region_info()).Times(m_num_step)
@@ -191,9 +194,31 @@ TEST_F(KontrollerTest, single_node)
     EXPECT_CALL(*agent, report_header()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*agent, report_node()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*agent, report_region()).WillOnce(Return(m_region_names));
-    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _));
+    MockLoopScheduler loop_scheduler;
+    EXPECT_CALL(*agent, loop_scheduler()).WillOnce(Return(&loop_scheduler));
+    EXPECT_CALL(loop_scheduler, num_overrun()).WillOnce(Return(2));
+    EXPECT_CALL(loop_scheduler, jitter_mean()).WillOnce(Return(0.25));
+    EXPECT_CALL(loop_scheduler, jitter_max()).WillOnce(Return(0.5));
+    std::vector<std::pair<std::string, std::string> > controller_report;
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _, _))
+        .WillOnce(SaveArg<4>(&controller_report));
+    EXPECT_CALL(*m_tracer, num_stall());
+    EXPECT_CALL(*m_tracer, num_byte_drop());
     EXPECT_CALL(*m_tracer, flush());
     kontroller.generate();
+    // loop statistics are reported once by the controller
+    ASSERT_EQ(9u, controller_report.size());
+    EXPECT_EQ("loop (count)", controller_report[2].first);
+    EXPECT_EQ(std::to_string(m_num_step), controller_report[2].second);
+    EXPECT_EQ("loop-period-mean (sec)", controller_report[3].first);
+    EXPECT_EQ("loop-period-max (sec)", controller_report[4].first);
+    EXPECT_EQ("loop-period-std (sec)", controller_report[5].first);
+    EXPECT_EQ("loop-overrun (count)", controller_report[6].first);
+    EXPECT_EQ("2", controller_report[6].second);
+    EXPECT_EQ("loop-wake-jitter-mean (sec)", controller_report[7].first);
+    EXPECT_EQ("0.25", controller_report[7].second);
+    EXPECT_EQ("loop-wake-jitter-max (sec)", controller_report[8].first);
+    EXPECT_EQ("0.5", controller_report[8].second);
 
     // single node Kontroller should not send anything via TreeComm
     EXPECT_EQ(0, m_tree_comm->num_send());
@@ -236,6 +261,7 @@ TEST_F(KontrollerTest, two_level_controller_1)
     EXPECT_CALL(*m_manager_io, sample()).Times(0);
 
     EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, notify_read_batch()).Times(m_num_step);
     EXPECT_CALL(m_platform_io, write_batch()).Times(m_num_step);
     EXPECT_CALL(*m_application_io, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_application_io, region_info()).Times(m_num_step)
@@ -260,7 +286,9 @@ TEST_F(KontrollerTest, two_level_controller_1)
 
     EXPECT_CALL(*agent, report_node()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*agent, report_region()).WillOnce(Return(m_region_names));
-    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _));
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _, _));
+    EXPECT_CALL(*m_tracer, num_stall());
+    EXPECT_CALL(*m_tracer, num_byte_drop());
     EXPECT_CALL(*m_tracer, flush());
     kontroller.generate();
 
@@ -322,6 +350,7 @@ TEST_F(KontrollerTest, two_level_controller_2)
     EXPECT_CALL(*m_manager_io, sample()).Times(0);
 
     EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, notify_read_batch()).Times(m_num_step);
     EXPECT_CALL(*m_application_io, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_application_io, region_info()).Times(m_num_step)
         .WillRepeatedly(Return(m_region_info));
@@ -350,7 +379,9 @@ TEST_F(KontrollerTest, two_level_controller_2)
     }
     EXPECT_CALL(*m_level_agent[0], report_node()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
-    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _));
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _, _));
+    EXPECT_CALL(*m_tracer, num_stall());
+    EXPECT_CALL(*m_tracer, num_byte_drop());
     EXPECT_CALL(*m_tracer, flush());
     kontroller.generate();
 
@@ -404,6 +435,7 @@ TEST_F(KontrollerTest, two_level_controller_0)
     kontroller.setup_trace();
 
     EXPECT_CALL(m_platform_io, read_batch()).Times(m_num_step);
+    EXPECT_CALL(*m_application_io, notify_read_batch()).Times(m_num_step);
     EXPECT_CALL(*m_application_io, update(_)).Times(m_num_step);
     EXPECT_CALL(*m_application_io, region_info()).Times(m_num_step)
         .WillRepeatedly(Return(m_region_info));
@@ -437,7 +469,9 @@ TEST_F(KontrollerTest, two_level_controller_0)
     EXPECT_CALL(*m_level_agent[root_level], report_header()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*m_level_agent[0], report_node()).WillOnce(Return(m_agent_report));
     EXPECT_CALL(*m_level_agent[0], report_region()).WillOnce(Return(m_region_names));
-    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _));
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _, _));
+    EXPECT_CALL(*m_tracer, num_stall());
+    EXPECT_CALL(*m_tracer, num_byte_drop());
     EXPECT_CALL(*m_tracer, flush());
     kontroller.generate();
 
@@ -450,3 +484,57 @@ TEST_F(KontrollerTest, two_level_controller_0)
     EXPECT_THAT(send_up_levels, ContainerEq(m_tree_comm->levels_sent_up()));
     EXPECT_THAT(recv_up_levels, ContainerEq(m_tree_comm->levels_rcvd_up()));
 }
+
+TEST_F(KontrollerTest, sample_threshold)
+{
+    int num_level_ctl = 1;
+    int root_level = 2;
+    EXPECT_CALL(*m_tree_comm, num_level_controlled())
+        .WillRepeatedly(Return(num_level_ctl));
+    EXPECT_CALL(*m_tree_comm, root_level())
+        .WillRepeatedly(Return(root_level));
+    EXPECT_CALL(*m_tree_comm, level_size(_))
+        .WillRepeatedly(Return(2));
+    for (int level = 0; level < num_level_ctl + 1; ++level) {
+        m_level_agent.push_back(new MockAgent());
+        m_agents.emplace_back(m_level_agent.back());
+    }
+    std::vector<geopm::SampleFilter::m_threshold_s> threshold = {{0.05, 1.0, 10}};
+    EXPECT_CALL(*m_level_agent[0], sample_threshold())
+        .WillOnce(Return(threshold));
+    EXPECT_CALL(*m_level_agent[1], sample_threshold())
+        .WillOnce(Return(std::vector<geopm::SampleFilter::m_threshold_s>{}));
+
+    Kontroller kontroller(m_comm, m_platform_io,
+                          m_agent_name, m_num_send_down, m_num_send_up,
+                          std::unique_ptr<MockTreeComm>(m_tree_comm),
+                          m_application_io,
+                          std::unique_ptr<MockReporter>(m_reporter),
+                          std::unique_ptr<MockTracer>(m_tracer),
+                          std::move(m_agents),
+                          std::unique_ptr<MockManagerIOSampler>(m_manager_io));
+
+    // only the agent that requests thresholds configures its level
+    std::vector<geopm::SampleFilter::m_threshold_s> actual;
+    EXPECT_CALL(*m_tree_comm, sample_threshold(0, _))
+        .WillOnce(SaveArg<1>(&actual));
+    EXPECT_CALL(*m_tree_comm, sample_threshold(1, _)).Times(0);
+
+    EXPECT_CALL(*m_application_io, do_shutdown()).WillOnce(Return(true));
+    EXPECT_CALL(*m_level_agent[0], trace_names())
+        .WillOnce(Return(std::vector<std::string>{}));
+    EXPECT_CALL(*m_tracer, columns(_));
+    EXPECT_CALL(*m_tracer, update(_, _)).Times(2);
+    EXPECT_CALL(*m_reporter, generate(_, _, _, _, _, _, _, _));
+    EXPECT_CALL(*m_tracer, num_stall());
+    EXPECT_CALL(*m_tracer, num_byte_drop());
+    EXPECT_CALL(*m_tracer, flush());
+    EXPECT_CALL(m_platform_io, restore_control())
+        .RetiresOnSaturation();
+    kontroller.run();
+
+    ASSERT_EQ(1u, actual.size());
+    EXPECT_EQ(threshold[0].relative, actual[0].relative);
+    EXPECT_EQ(threshold[0].absolute, actual[0].absolute);
+    EXPECT_EQ(threshold[0].max_stale, actual[0].max_stale);
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "geopm.h"
+#include "geopm_time.h"
+#include "KprofileIOSample.hpp"
+#include "KruntimeRegulator.hpp"
+#include "MockEpochRuntimeRegulator.hpp"
+#include "MockPlatformIO.hpp"
+
+using geopm::KprofileIOSample;
+using geopm::KruntimeRegulator;
+using testing::_;
+using testing::Return;
+using testing::ReturnRef;
+
+class KprofileIOSampleTest : public ::testing::Test
+{
+    protected:
+        void SetUp();
+        std::vector<int> m_rank;
+        MockEpochRuntimeRegulator m_epoch_regulator;
+        MockPlatformIO m_platform_io;
+        std::unique_ptr<KprofileIOSample> m_profile_sample;
+};
+
+void KprofileIOSampleTest::SetUp()
+{
+    // cpu 6 has no rank attached
+    m_rank = {1, 1, 2, 2, 3, 3, -1, 4};
+    EXPECT_CALL(m_platform_io, read_signal("TIME", _, _)).WillRepeatedly(Return(0.0));
+    m_profile_sample = std::unique_ptr<KprofileIOSample>(new KprofileIOSample(m_rank, m_epoch_regulator, m_platform_io));
+    EXPECT_CALL(m_epoch_regulator, record_entry(_, _, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(m_epoch_regulator, record_exit(_, _, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(m_epoch_regulator, is_regulated(_)).WillRepeatedly(Return(false));
+}
+
+TEST_F(KprofileIOSampleTest, cpu_rank)
+{
+    std::vector<int> expected = {0, 0, 1, 1, 2, 2, -1, 3};
+    EXPECT_EQ(expected, m_profile_sample->cpu_rank());
+
+    // ranks spread sparsely through the communicator
+    std::vector<int> sparse_rank = {1000, 1000, 7, 7, -1, 250000, 250000, -1};
+    KprofileIOSample sparse_sample(sparse_rank, m_epoch_regulator, m_platform_io);
+    expected = {1, 1, 0, 0, -1, 2, 2, -1};
+    EXPECT_EQ(expected, sparse_sample.cpu_rank());
+
+    struct geopm_time_s time_0;
+    geopm_time(&time_0);
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > prof_sample {
+        {42, {.rank=250000, .region_id=42, .timestamp=time_0, .progress=0.25}}};
+    sparse_sample.update(prof_sample.begin(), prof_sample.end());
+    std::vector<uint64_t> region_id;
+    sparse_sample.per_cpu_region_id(region_id);
+    std::vector<uint64_t> expected_rid(sparse_rank.size(), GEOPM_REGION_ID_UNMARKED);
+    expected_rid[5] = 42;
+    expected_rid[6] = 42;
+    EXPECT_EQ(expected_rid, region_id);
+}
+
+TEST_F(KprofileIOSampleTest, per_cpu_fill)
+{
+    struct geopm_time_s time_0;
+    geopm_time(&time_0);
+    std::vector<double> progress(3, 9.0);
+    std::vector<uint64_t> region_id;
+    m_profile_sample->per_cpu_progress(time_0, progress);
+    m_profile_sample->per_cpu_region_id(region_id);
+    ASSERT_EQ(m_rank.size(), progress.size());
+    ASSERT_EQ(m_rank.size(), region_id.size());
+    for (size_t cpu_idx = 0; cpu_idx != m_rank.size(); ++cpu_idx) {
+        EXPECT_EQ(0.0, progress[cpu_idx]);
+        EXPECT_EQ(GEOPM_REGION_ID_UNMARKED, region_id[cpu_idx]);
+    }
+
+    struct geopm_time_s time_1;
+    struct geopm_time_s time_2;
+    geopm_time_add(&time_0, 1.0, &time_1);
+    geopm_time_add(&time_1, 1.0, &time_2);
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > prof_sample {
+        {42, {.rank=2, .region_id=42, .timestamp=time_0, .progress=0.0}},
+        {42, {.rank=2, .region_id=42, .timestamp=time_0, .progress=0.2}},
+        {42, {.rank=2, .region_id=42, .timestamp=time_1, .progress=0.4}},
+        {43, {.rank=4, .region_id=43, .timestamp=time_1, .progress=0.5}}};
+    m_profile_sample->update(prof_sample.begin(), prof_sample.end());
+
+    const double *progress_ptr = progress.data();
+    m_profile_sample->per_cpu_progress(time_2, progress);
+    m_profile_sample->per_cpu_region_id(region_id);
+    // output buffer is reused rather than reallocated
+    EXPECT_EQ(progress_ptr, progress.data());
+    EXPECT_EQ(progress, m_profile_sample->per_cpu_progress(time_2));
+    EXPECT_EQ(region_id, m_profile_sample->per_cpu_region_id());
+    for (size_t cpu_idx = 0; cpu_idx != m_rank.size(); ++cpu_idx) {
+        if (m_rank[cpu_idx] == 2) {
+            // linear extrapolation from the last two samples
+            EXPECT_NEAR(0.6, progress[cpu_idx], 1e-9);
+            EXPECT_EQ(42ULL, region_id[cpu_idx]);
+        }
+        else if (m_rank[cpu_idx] == 4) {
+            EXPECT_EQ(0.5, progress[cpu_idx]);
+            EXPECT_EQ(43ULL, region_id[cpu_idx]);
+        }
+        else {
+            EXPECT_EQ(0.0, progress[cpu_idx]);
+            EXPECT_EQ(GEOPM_REGION_ID_UNMARKED, region_id[cpu_idx]);
+        }
+    }
+}
+
+TEST_F(KprofileIOSampleTest, per_cpu_runtime)
+{
+    struct geopm_time_s time_0;
+    struct geopm_time_s time_1;
+    geopm_time(&time_0);
+    geopm_time_add(&time_0, 2.0, &time_1);
+    KruntimeRegulator unmarked_reg(4);
+    KruntimeRegulator region_reg(4);
+    for (int rank = 0; rank < 4; ++rank) {
+        unmarked_reg.record_entry(rank, time_0);
+        unmarked_reg.record_exit(rank, time_1);
+    }
+    region_reg.record_entry(1, time_0);
+    region_reg.record_exit(1, time_0);
+    region_reg.record_entry(1, time_0);
+    geopm_time_add(&time_0, 0.5, &time_1);
+    region_reg.record_exit(1, time_1);
+    EXPECT_CALL(m_epoch_regulator, region_regulator(GEOPM_REGION_ID_UNMARKED))
+        .WillRepeatedly(ReturnRef(unmarked_reg));
+    EXPECT_CALL(m_epoch_regulator, region_regulator(42))
+        .WillRepeatedly(ReturnRef(region_reg));
+
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > prof_sample {
+        {42, {.rank=2, .region_id=42, .timestamp=time_0, .progress=0.0}}};
+    m_profile_sample->update(prof_sample.begin(), prof_sample.end());
+
+    std::vector<double> runtime;
+    m_profile_sample->per_cpu_runtime(runtime);
+    std::vector<double> expected = {2.0, 2.0, 0.5, 0.5, 2.0, 2.0, 0.0, 2.0};
+    ASSERT_EQ(expected.size(), runtime.size());
+    for (size_t cpu_idx = 0; cpu_idx != expected.size(); ++cpu_idx) {
+        EXPECT_NEAR(expected[cpu_idx], runtime[cpu_idx], 1e-9);
+    }
+
+    // last runtime of one region for every CPU
+    m_profile_sample->per_cpu_runtime(42, runtime);
+    expected = {0.0, 0.0, 0.5, 0.5, 0.0, 0.0, 0.0, 0.0};
+    ASSERT_EQ(expected.size(), runtime.size());
+    for (size_t cpu_idx = 0; cpu_idx != expected.size(); ++cpu_idx) {
+        EXPECT_NEAR(expected[cpu_idx], runtime[cpu_idx], 1e-9);
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "geopm_time.h"
+#include "geopm_error.h"
+#include "LoopScheduler.hpp"
+#include "geopm_test.hpp"
+
+using geopm::LoopScheduler;
+
+TEST(LoopSchedulerTest, invalid_construction)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(LoopScheduler(0.0, 0.0), GEOPM_ERROR_INVALID, "period must be positive");
+    GEOPM_EXPECT_THROW_MESSAGE(LoopScheduler(0.005, -1.0), GEOPM_ERROR_INVALID, "period must be positive");
+    GEOPM_EXPECT_THROW_MESSAGE(LoopScheduler(0.005, 0.01), GEOPM_ERROR_INVALID, "period must be positive");
+}
+
+TEST(LoopSchedulerTest, wait)
+{
+    const double period = 0.005;
+    const int num_loop = 20;
+    geopm_time_s start_time, end_time;
+    geopm_time(&start_time);
+    LoopScheduler scheduler(period);
+    for (int loop_idx = 0; loop_idx < num_loop; ++loop_idx) {
+        scheduler.wait();
+    }
+    geopm_time(&end_time);
+    // deadlines are absolute so the loop never finishes early; the
+    // upper bound is loose because the test process may be preempted
+    double elapsed = geopm_time_diff(&start_time, &end_time);
+    EXPECT_LE(num_loop * period, elapsed);
+    EXPECT_GT(2 * num_loop * period, elapsed);
+    EXPECT_EQ((size_t)num_loop, scheduler.num_loop());
+    // a descheduled test process may miss a few deadlines, but an
+    // idle loop body should make nearly all of them
+    EXPECT_GE((size_t)num_loop / 4, scheduler.num_overrun());
+    EXPECT_LE(0.0, scheduler.jitter_mean());
+    EXPECT_LE(scheduler.jitter_mean(), scheduler.jitter_max());
+    EXPECT_GT(period, scheduler.jitter_mean());
+}
+
+TEST(LoopSchedulerTest, overrun)
+{
+    const double period = 0.005;
+    LoopScheduler scheduler(period, 0.0);
+    scheduler.wait();
+    usleep(12000);
+    geopm_time_s start_time, end_time;
+    geopm_time(&start_time);
+    scheduler.wait();
+    geopm_time(&end_time);
+    EXPECT_GT(period, geopm_time_diff(&start_time, &end_time));
+    EXPECT_EQ(2ULL, scheduler.num_loop());
+    EXPECT_EQ(1ULL, scheduler.num_overrun());
+    // schedule is re-anchored to the overrun rather than catching up,
+    // so the next deadline is a full period after the overrun
+    scheduler.wait();
+    geopm_time(&end_time);
+    EXPECT_LE(period, geopm_time_diff(&start_time, &end_time));
+    EXPECT_GT(3 * period, geopm_time_diff(&start_time, &end_time));
+    EXPECT_EQ(3ULL, scheduler.num_loop());
+    EXPECT_LE(1ULL, scheduler.num_overrun());
+    EXPECT_GE(2ULL, scheduler.num_overrun());
+}
+
+TEST(LoopSchedulerTest, first_wait)
+{
+    // time spent between construction and the first wait() is not
+    // counted against the schedule
+    const double period = 0.005;
+    LoopScheduler scheduler(period, 0.0);
+    usleep(12000);
+    geopm_time_s start_time, end_time;
+    geopm_time(&start_time);
+    scheduler.wait();
+    geopm_time(&end_time);
+    EXPECT_LE(period, geopm_time_diff(&start_time, &end_time));
+    EXPECT_EQ(1ULL, scheduler.num_loop());
+    EXPECT_EQ(0ULL, scheduler.num_overrun());
+    // the jitter is the lateness of the return with respect to the
+    // deadline, so it is non-zero when the scheduler does not spin
+    EXPECT_LT(0.0, scheduler.jitter_max());
+    EXPECT_EQ(scheduler.jitter_max(), scheduler.jitter_mean());
+}
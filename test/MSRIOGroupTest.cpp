@@ -89,6 +89,33 @@ class MockMSRIO : public geopm::MSRIO
         std::vector<std::string> m_test_dev_path;
 };
 
+// MSRIOGroup with the spare CPU check for the reader thread replaced
+class AsyncMSRIOGroup : public geopm::MSRIOGroup
+{
+    public:
+        AsyncMSRIOGroup(IPlatformTopo &topo, std::unique_ptr<geopm::IMSRIO> msrio, int cpuid, int num_cpu,
+                        double async_period, bool is_spare_cpu);
+        virtual ~AsyncMSRIOGroup() = default;
+    protected:
+        bool async_cpu(int &cpu) override;
+        const bool m_is_spare_cpu;
+};
+
+AsyncMSRIOGroup::AsyncMSRIOGroup(IPlatformTopo &topo, std::unique_ptr<geopm::IMSRIO> msrio, int cpuid, int num_cpu,
+                                 double async_period, bool is_spare_cpu)
+    : MSRIOGroup(topo, std::move(msrio), cpuid, num_cpu, async_period)
+    , m_is_spare_cpu(is_spare_cpu)
+{
+
+}
+
+bool AsyncMSRIOGroup::async_cpu(int &cpu)
+{
+    // Leave the reader unpinned so that it starts even when the test
+    // runs on a single CPU
+    cpu = -1;
+    return m_is_spare_cpu;
+}
 
 void MSRIOGroupTest::mock_enable_fixed_counters(void)
 {
@@ -100,7 +127,8 @@ void MSRIOGroupTest::mock_enable_fixed_counters(void)
 }
 
 MockMSRIO::MockMSRIO(int num_cpu)
-   : M_MAX_OFFSET(4096)
+   : MSRIO(num_cpu)
+   , M_MAX_OFFSET(4096)
    , m_num_cpu(num_cpu)
 {
     union field_u {
@@ -389,6 +417,92 @@ TEST_F(MSRIOGroupTest, sample_raw)
     close(fd_1);
 }
 
+TEST_F(MSRIOGroupTest, sample_overflow)
+{
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_CPU, _, _)).Times(1 + m_num_cpu * 15);
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_CPU)).Times(1 + m_num_cpu * 15);
+
+    int inst_idx = m_msrio_group->push_signal("MSR::PERF_FIXED_CTR0:INST_RETIRED_ANY",
+                                              IPlatformTopo::M_DOMAIN_CPU, 0);
+    int fd = open(m_test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd);
+    // 40 bit counter wraps twice, but is only sampled at the end
+    std::vector<uint64_t> values {0xFFFFFFFFF0, 0x10, 0xFFFFFFFFF0, 0x20};
+    for (auto value : values) {
+        size_t num_write = pwrite(fd, &value, sizeof(value), 0x309);
+        ASSERT_EQ(num_write, sizeof(value));
+        m_msrio_group->read_batch();
+    }
+    EXPECT_EQ(2.0 * (1ULL << 40) + 0x20, m_msrio_group->sample(inst_idx));
+    close(fd);
+}
+
+TEST_F(MSRIOGroupTest, sample_async)
+{
+    std::unique_ptr<MockMSRIO> msrio(new MockMSRIO(m_num_cpu));
+    std::vector<std::string> test_dev_path = msrio->test_dev_paths();
+    // reader thread period of one millisecond
+    AsyncMSRIOGroup async_group(m_topo, std::move(msrio), 0x657, m_num_cpu, 0.001, true);
+
+    EXPECT_TRUE(async_group.is_valid_signal("MSR::BATCH_AGE"));
+    EXPECT_EQ(IPlatformTopo::M_DOMAIN_BOARD, async_group.signal_domain_type("MSR::BATCH_AGE"));
+    GEOPM_EXPECT_THROW_MESSAGE(async_group.read_signal("MSR::BATCH_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_RUNTIME, "not available before read_batch()");
+    int freq_idx = async_group.push_signal("MSR::PERF_STATUS:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    int age_idx = async_group.push_signal("MSR::BATCH_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0);
+    EXPECT_EQ(age_idx, async_group.push_signal("MSR::BATCH_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0));
+    EXPECT_NE(freq_idx, age_idx);
+
+    int fd_0 = open(test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    uint64_t value = 0xB00;
+    size_t num_write = pwrite(fd_0, &value, sizeof(value), 0x198);
+    ASSERT_EQ(num_write, sizeof(value));
+
+    // first read_batch waits for the first snapshot
+    async_group.read_batch();
+    EXPECT_EQ(1.1e9, async_group.sample(freq_idx));
+    double age = async_group.sample(age_idx);
+    EXPECT_LE(0.0, age);
+    EXPECT_GT(1.0, age);
+
+    // new value is eventually picked up by the reader thread
+    value = 0xC00;
+    num_write = pwrite(fd_0, &value, sizeof(value), 0x198);
+    ASSERT_EQ(num_write, sizeof(value));
+    double freq = 0.0;
+    for (int retry = 0; retry < 1000 && freq != 1.2e9; ++retry) {
+        usleep(1000);
+        async_group.read_batch();
+        freq = async_group.sample(freq_idx);
+    }
+    EXPECT_EQ(1.2e9, freq);
+    close(fd_0);
+}
+
+TEST_F(MSRIOGroupTest, sample_async_no_spare_cpu)
+{
+    std::unique_ptr<MockMSRIO> msrio(new MockMSRIO(m_num_cpu));
+    std::vector<std::string> test_dev_path = msrio->test_dev_paths();
+    // no CPU other than the caller's, so no reader thread is started
+    AsyncMSRIOGroup async_group(m_topo, std::move(msrio), 0x657, m_num_cpu, 0.001, false);
+    int freq_idx = async_group.push_signal("MSR::PERF_STATUS:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    int age_idx = async_group.push_signal("MSR::BATCH_AGE", IPlatformTopo::M_DOMAIN_BOARD, 0);
+
+    int fd_0 = open(test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    // every read_batch() reads the MSRs synchronously
+    std::vector<uint64_t> values {0xB00, 0xC00, 0xD00};
+    for (auto value : values) {
+        size_t num_write = pwrite(fd_0, &value, sizeof(value), 0x198);
+        ASSERT_EQ(num_write, sizeof(value));
+        async_group.read_batch();
+        EXPECT_EQ((value >> 8) * 1e8, async_group.sample(freq_idx));
+        EXPECT_LE(0.0, async_group.sample(age_idx));
+    }
+    close(fd_0);
+}
+
 TEST_F(MSRIOGroupTest, read_signal)
 {
     EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, _, _)).Times(1);
@@ -553,6 +667,44 @@ TEST_F(MSRIOGroupTest, adjust)
     close(fd_0);
 }
 
+TEST_F(MSRIOGroupTest, adjust_combined)
+{
+    EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_PACKAGE)).Times(4);
+    EXPECT_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, _, _)).Times(4);
+
+    int fd_0 = open(m_test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    uint64_t initial;
+    ASSERT_EQ(8, pread(fd_0, &initial, sizeof(initial), 0x610));
+
+    // Expected register contents from one write per control
+    m_msrio_group->write_control("MSR::PKG_POWER_LIMIT:PL1_POWER_LIMIT", IPlatformTopo::M_DOMAIN_PACKAGE, 0, 160);
+    m_msrio_group->write_control("MSR::PKG_POWER_LIMIT:PL1_TIME_WINDOW", IPlatformTopo::M_DOMAIN_PACKAGE, 0, 0.015);
+    uint64_t expected;
+    ASSERT_EQ(8, pread(fd_0, &expected, sizeof(expected), 0x610));
+    EXPECT_NE(initial, expected);
+    ASSERT_EQ(8, pwrite(fd_0, &initial, sizeof(initial), 0x610));
+
+    // Both fields of the MSR are set by a single combined write
+    int power_idx = m_msrio_group->push_control("MSR::PKG_POWER_LIMIT:PL1_POWER_LIMIT", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    int window_idx = m_msrio_group->push_control("MSR::PKG_POWER_LIMIT:PL1_TIME_WINDOW", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    m_msrio_group->adjust(power_idx, 160);
+    m_msrio_group->adjust(window_idx, 0.015);
+    m_msrio_group->write_batch();
+    uint64_t actual;
+    ASSERT_EQ(8, pread(fd_0, &actual, sizeof(actual), 0x610));
+    EXPECT_EQ(expected, actual);
+
+    // Unchanged settings are not written again
+    uint64_t other = 0x1234;
+    ASSERT_EQ(8, pwrite(fd_0, &other, sizeof(other), 0x610));
+    m_msrio_group->write_batch();
+    ASSERT_EQ(8, pread(fd_0, &actual, sizeof(actual), 0x610));
+    EXPECT_EQ(other, actual);
+
+    close(fd_0);
+}
+
 TEST_F(MSRIOGroupTest, write_control)
 {
     EXPECT_CALL(m_topo, num_domain(IPlatformTopo::M_DOMAIN_PACKAGE)).Times(2);
@@ -708,3 +860,141 @@ TEST_F(MSRIOGroupTest, register_msr_control)
                                GEOPM_ERROR_INVALID, "field_name: BAD could not be found");
 
 }
+
+TEST_F(MSRIOGroupTest, save_restore)
+{
+    int fd_0 = open(m_test_dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    int fd_1 = open(m_test_dev_path[1].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_1);
+    uint64_t value;
+    size_t num_read;
+    size_t num_write;
+    uint64_t perf_ctl_0;
+    num_read = pread(fd_0, &perf_ctl_0, sizeof(perf_ctl_0), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+
+    m_msrio_group->save_control();
+    m_msrio_group->write_control("MSR::PERF_CTL:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0, 3e9);
+    num_read = pread(fd_0, &value, sizeof(value), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(0x1E00ULL, (value & 0xFF00));
+    // Control MSR changed outside of the IOGroup
+    value = 0;
+    num_write = pwrite(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_write);
+
+    m_msrio_group->restore_control();
+    // Every control MSR on every CPU is restored
+    num_read = pread(fd_0, &value, sizeof(value), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(perf_ctl_0, value);
+    num_read = pread(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(0x0610ULL, (value & 0x7FFF));
+
+    close(fd_1);
+    close(fd_0);
+}
+
+TEST_F(MSRIOGroupTest, save_restore_scoped)
+{
+    std::unique_ptr<MockMSRIO> msrio(new MockMSRIO(m_num_cpu));
+    std::vector<std::string> dev_path = msrio->test_dev_paths();
+    MSRIOGroup group(m_topo, std::move(msrio), 0x657, m_num_cpu, 0.0, true);
+    int fd_0 = open(dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    int fd_1 = open(dev_path[1].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_1);
+    uint64_t value;
+    size_t num_read;
+    size_t num_write;
+    uint64_t perf_ctl_0;
+    num_read = pread(fd_0, &perf_ctl_0, sizeof(perf_ctl_0), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+    uint64_t fixed_ctr_ctrl_1;
+    num_read = pread(fd_1, &fixed_ctr_ctrl_1, sizeof(fixed_ctr_ctrl_1), 0x38D);
+    EXPECT_EQ(8ULL, num_read);
+    ASSERT_EQ(0x1ULL, (fixed_ctr_ctrl_1 & 0x1));
+
+    // Controls pushed before and after the save are both restored
+    int ctl_0 = group.push_control("MSR::PERF_CTL:FREQ", IPlatformTopo::M_DOMAIN_PACKAGE, 0);
+    group.save_control();
+    int ctl_1 = group.push_control("MSR::PERF_FIXED_CTR_CTRL:EN0_OS", IPlatformTopo::M_DOMAIN_CPU, 1);
+    group.adjust(ctl_0, 1e9);
+    group.adjust(ctl_1, 0);
+    group.write_batch();
+    group.write_control("MSR::PKG_POWER_LIMIT:PL1_POWER_LIMIT", IPlatformTopo::M_DOMAIN_PACKAGE, 0, 300);
+    num_read = pread(fd_0, &value, sizeof(value), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(0xA00ULL, (value & 0xFF00));
+    num_read = pread(fd_1, &value, sizeof(value), 0x38D);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(fixed_ctr_ctrl_1 & ~0x1ULL, value);
+    // Control MSR the IOGroup never touched changed outside of it
+    value = 0;
+    num_write = pwrite(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_write);
+
+    group.restore_control();
+    num_read = pread(fd_0, &value, sizeof(value), 0x199);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(perf_ctl_0, value);
+    num_read = pread(fd_1, &value, sizeof(value), 0x38D);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(fixed_ctr_ctrl_1, value);
+    num_read = pread(fd_0, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(0x0610ULL, (value & 0x7FFF));
+    num_read = pread(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(0x0ULL, value);
+
+    close(fd_1);
+    close(fd_0);
+}
+
+TEST_F(MSRIOGroupTest, write_control_power_package)
+{
+    std::unique_ptr<MockMSRIO> msrio(new MockMSRIO(m_num_cpu));
+    std::vector<std::string> dev_path = msrio->test_dev_paths();
+    MSRIOGroup group(m_topo, std::move(msrio), 0x657, m_num_cpu, 0.0, true);
+    // a package with two cpus
+    ON_CALL(m_topo, domain_cpus(IPlatformTopo::M_DOMAIN_PACKAGE, 0, _))
+        .WillByDefault(SetArgReferee<2>(std::set<int>{0, 1}));
+    int fd_0 = open(dev_path[0].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_0);
+    int fd_1 = open(dev_path[1].c_str(), O_RDWR);
+    ASSERT_NE(-1, fd_1);
+    uint64_t value;
+    size_t num_read;
+    uint64_t pkg_power_limit_0;
+    num_read = pread(fd_0, &pkg_power_limit_0, sizeof(pkg_power_limit_0), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    uint64_t pkg_power_limit_1;
+    num_read = pread(fd_1, &pkg_power_limit_1, sizeof(pkg_power_limit_1), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+
+    // as with push_control() only the first cpu of the package is
+    // saved and written with the PL1 limit; the limit enable is
+    // still written on every cpu
+    group.save_control();
+    group.write_control("POWER_PACKAGE", IPlatformTopo::M_DOMAIN_PACKAGE, 0, 300);
+    num_read = pread(fd_0, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_NE(pkg_power_limit_0 & 0x7FFF, value & 0x7FFF);
+    num_read = pread(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(pkg_power_limit_1 & 0x7FFF, value & 0x7FFF);
+
+    group.restore_control();
+    num_read = pread(fd_0, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(pkg_power_limit_0, value);
+    num_read = pread(fd_1, &value, sizeof(value), 0x610);
+    EXPECT_EQ(8ULL, num_read);
+    EXPECT_EQ(pkg_power_limit_1, value);
+
+    close(fd_1);
+    close(fd_0);
+}
@@ -50,25 +50,36 @@ class TestMSRIO : public geopm::MSRIO
 {
     public:
         TestMSRIO(int num_cpu);
+        TestMSRIO(int num_cpu, int num_worker);
         virtual ~TestMSRIO();
         char *msr_space_ptr(int cpu_idx, off_t offset);
+        int num_worker_start(void) const;
     protected:
         void msr_path(int cpu_idx,
                       bool is_fallback,
                       std::string &path) override;
         void msr_batch_path(std::string &path) override;
+        void worker_cpu(int max_num_cpu, std::vector<int> &cpu) override;
         const char **msr_words(void) const;
 
         const size_t M_MAX_OFFSET;
         const int m_num_cpu;
         std::vector<std::string> m_test_dev_path;
         std::vector<char *> m_msr_space;
+        int m_num_worker_start;
 };
 
 TestMSRIO::TestMSRIO(int num_cpu)
-    : MSRIO(num_cpu)
+    : TestMSRIO(num_cpu, 0)
+{
+
+}
+
+TestMSRIO::TestMSRIO(int num_cpu, int num_worker)
+    : MSRIO(num_cpu, num_worker)
     , M_MAX_OFFSET(4096)
     , m_num_cpu(num_cpu)
+    , m_num_worker_start(0)
 {
     for (int cpu_idx = 0; cpu_idx < m_num_cpu + 1; ++cpu_idx) {
         char tmp_path[NAME_MAX] = "/tmp/test_msrio_dev_cpu_XXXXXX";
@@ -121,11 +132,24 @@ void TestMSRIO::msr_batch_path(std::string &path)
     path = "test_dev_msr_safe";
 }
 
+void TestMSRIO::worker_cpu(int max_num_cpu, std::vector<int> &cpu)
+{
+    // Leave the workers unpinned so that they start even when the
+    // test runs on a single CPU
+    ++m_num_worker_start;
+    cpu.assign(max_num_cpu, -1);
+}
+
 char* TestMSRIO::msr_space_ptr(int cpu_idx, off_t offset)
 {
     return m_msr_space[cpu_idx] + offset;
 }
 
+int TestMSRIO::num_worker_start(void) const
+{
+    return m_num_worker_start;
+}
+
 const char **TestMSRIO::msr_words(void) const
 {
     static const char *instance[] = {
@@ -762,6 +786,84 @@ TEST_F(MSRIOTest, read_batch)
     EXPECT_EQ(expected, actual);
 }
 
+TEST_F(MSRIOTest, read_batch_parallel)
+{
+    // enough operations across several CPUs to use the fallback
+    // worker threads if they were enabled, here they are not
+    std::vector<std::string> words {"software", "engineer", "document", "everyday",
+                                    "modeling", "standout", "patience", "goodwill"};
+    std::vector<uint64_t> offsets {0xd28, 0x520, 0x468, 0x570, 0x918, 0xd80, 0xa40, 0x688};
+
+    std::vector<int> read_cpu_idx;
+    std::vector<uint64_t> read_offset;
+    std::vector<uint64_t> expected;
+    for (int repeat = 0; repeat < 4; ++repeat) {
+        for (int ci = 0; ci < m_num_cpu; ++ci) {
+            auto wi = words.begin();
+            for (auto oi : offsets) {
+                read_cpu_idx.push_back(ci);
+                read_offset.push_back(oi);
+                uint64_t result;
+                memcpy(&result, wi->data(), 8);
+                expected.push_back(result);
+                ++wi;
+            }
+        }
+    }
+    m_msrio->config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    for (int iter = 0; iter < 3; ++iter) {
+        std::vector<uint64_t> actual;
+        m_msrio->read_batch(actual);
+        EXPECT_EQ(expected, actual);
+    }
+
+    // offset past the end of the fake device fails on every CPU
+    read_offset.assign(read_offset.size(), 0x2000);
+    m_msrio->config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    std::vector<uint64_t> actual;
+    EXPECT_THROW(m_msrio->read_batch(actual), geopm::Exception);
+}
+
+TEST_F(MSRIOTest, read_batch_worker)
+{
+    // same batch as read_batch_parallel, but with workers enabled
+    TestMSRIO msrio(m_num_cpu, 3);
+    std::vector<std::string> words {"software", "engineer", "document", "everyday",
+                                    "modeling", "standout", "patience", "goodwill"};
+    std::vector<uint64_t> offsets {0xd28, 0x520, 0x468, 0x570, 0x918, 0xd80, 0xa40, 0x688};
+
+    std::vector<int> read_cpu_idx;
+    std::vector<uint64_t> read_offset;
+    std::vector<uint64_t> expected;
+    for (int repeat = 0; repeat < 4; ++repeat) {
+        for (int ci = 0; ci < m_num_cpu; ++ci) {
+            auto wi = words.begin();
+            for (auto oi : offsets) {
+                read_cpu_idx.push_back(ci);
+                read_offset.push_back(oi);
+                uint64_t result;
+                memcpy(&result, wi->data(), 8);
+                expected.push_back(result);
+                ++wi;
+            }
+        }
+    }
+    msrio.config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    for (int iter = 0; iter < 3; ++iter) {
+        std::vector<uint64_t> actual;
+        msrio.read_batch(actual);
+        EXPECT_EQ(expected, actual);
+    }
+    // workers are started once and reused by every batch
+    EXPECT_EQ(1, msrio.num_worker_start());
+
+    // offset past the end of the fake device fails on every CPU
+    read_offset.assign(read_offset.size(), 0x2000);
+    msrio.config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    std::vector<uint64_t> actual;
+    EXPECT_THROW(msrio.read_batch(actual), geopm::Exception);
+}
+
 TEST_F(MSRIOTest, write_batch)
 {
     std::vector<int> cpu_idx;
@@ -820,3 +922,32 @@ TEST_F(MSRIOTest, write_batch)
     EXPECT_THROW(m_msrio->config_batch(write_cpu_idx, {}, {}, {}, {}), geopm::Exception);
     EXPECT_THROW(m_msrio->config_batch({}, {}, write_cpu_idx, write_offset, {}), geopm::Exception);
 }
+
+TEST_F(MSRIOTest, write_batch_cache)
+{
+    std::vector<int> write_cpu_idx {0, 1};
+    std::vector<uint64_t> write_offset {0x520, 0x520};
+    std::vector<uint64_t> write_mask {0x00000000000000FF, 0x00000000000000FF};
+    m_msrio->config_batch({}, {}, write_cpu_idx, write_offset, write_mask);
+
+    // first write reads the MSR to preserve the bits outside the mask
+    m_msrio->write_batch({'E', 'E'});
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(0, 0x520), "Engineer", 8));
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(1, 0x520), "Engineer", 8));
+
+    // the last value written is cached: a repeated value is not
+    // written and a new value is merged with the cached value
+    memcpy(m_msrio->msr_space_ptr(0, 0x520), "external", 8);
+    memcpy(m_msrio->msr_space_ptr(1, 0x520), "external", 8);
+    m_msrio->write_batch({'E', 'G'});
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(0, 0x520), "external", 8));
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(1, 0x520), "Gngineer", 8));
+
+    // a single MSR write invalidates the cache
+    m_msrio->write_msr(0, 0x520, 'X', 0xFF);
+    m_msrio->write_batch({'E', 'G'});
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(0, 0x520), "External", 8));
+    EXPECT_EQ(0, memcmp(m_msrio->msr_space_ptr(1, 0x520), "Gngineer", 8));
+
+    EXPECT_THROW(m_msrio->write_batch({0x100, 'G'}), geopm::Exception);
+}
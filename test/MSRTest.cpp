@@ -187,6 +187,7 @@ TEST_F(MSRTest, msr)
     EXPECT_THROW(msr->control(2, -1.0, field, mask), geopm::Exception);
     EXPECT_THROW(msr->signal_name(-1), geopm::Exception);
     EXPECT_THROW(msr->control_name(-1), geopm::Exception);
+    EXPECT_THROW(msr->signal_encode(-1), geopm::Exception);
 
     int msr_idx = 0;
     for (auto msr_it = m_msrs.begin(); msr_it != m_msrs.end(); ++msr_it, msr_idx++) {
@@ -210,6 +211,7 @@ TEST_F(MSRTest, msr)
             uint64_t num_overflow = 0;
             double value = msr->signal(signal_idx, m_signal_field, field_last, num_overflow);
             EXPECT_DOUBLE_EQ(m_expected_sig_values[signal_idx], value) << "signal_idx: " << signal_idx;
+            EXPECT_EQ(msr->decode_function(signal_idx), msr->signal_encode(signal_idx).function);
         }
 
         // controls
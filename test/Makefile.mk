@@ -61,6 +61,11 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/CircularBufferTest.buffer_size \
               test/gtest_links/CircularBufferTest.buffer_values \
               test/gtest_links/CircularBufferTest.buffer_capacity \
+              test/gtest_links/CircularBufferTest.buffer_capacity_wrapped \
+              test/gtest_links/WindowStatisticsTest.empty \
+              test/gtest_links/WindowStatisticsTest.window \
+              test/gtest_links/WindowStatisticsTest.nan \
+              test/gtest_links/WindowStatisticsTest.match_agg \
               test/gtest_links/GlobalPolicyTest.mode_tdp_balance_static \
               test/gtest_links/GlobalPolicyTest.mode_freq_uniform_static \
               test/gtest_links/GlobalPolicyTest.mode_freq_hybrid_static \
@@ -80,9 +85,15 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/GlobalPolicyTest.negative_c_interface \
               test/gtest_links/ExceptionTest.hello \
               test/gtest_links/ProfileIOSampleTest.hello \
+              test/gtest_links/KprofileIOSampleTest.cpu_rank \
+              test/gtest_links/KprofileIOSampleTest.per_cpu_fill \
+              test/gtest_links/KprofileIOSampleTest.per_cpu_runtime \
               test/gtest_links/ProfileTableTest.hello \
               test/gtest_links/ProfileTableTest.name_set_fill_short \
               test/gtest_links/ProfileTableTest.name_set_fill_long \
+              test/gtest_links/ProfileTableTest.ring_order \
+              test/gtest_links/ProfileTableTest.ring_drop \
+              test/gtest_links/ProfileTableTest.ring_init \
               test/gtest_links/RegionTest.identifier \
               test/gtest_links/RegionTest.sample_message \
               test/gtest_links/RegionTest.signal_last \
@@ -100,6 +111,7 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/RegionTest.negative_signal_invalid \
               test/gtest_links/RegionTest.negative_signal_derivative_tree \
               test/gtest_links/RegionTest.telemetry_timestamp \
+              test/gtest_links/SampleFilterTest.is_send \
               test/gtest_links/SampleRegulatorTest.insert_platform \
               test/gtest_links/SampleRegulatorTest.insert_profile \
               test/gtest_links/SampleRegulatorTest.align_profile \
@@ -153,6 +165,7 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/SharedMemoryTest.invalid_construction \
               test/gtest_links/SharedMemoryTest.share_data \
               test/gtest_links/SharedMemoryTest.share_data_ipc \
+              test/gtest_links/SharedMemoryTest.user_wait \
               test/gtest_links/EnvironmentTest.construction0 \
               test/gtest_links/EnvironmentTest.construction1 \
               test/gtest_links/SchedTest.test_proc_cpuset_0 \
@@ -173,8 +186,10 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/ControlMessageTest.is_shutdown \
               test/gtest_links/ControlMessageTest.loop_begin_0 \
               test/gtest_links/ControlMessageTest.loop_begin_1 \
+              test/gtest_links/ControlMessageTest.wait_wake \
               test/gtest_links/CommMPIImpTest.mpi_comm_ops \
               test/gtest_links/CommMPIImpTest.mpi_reduce \
+              test/gtest_links/CommMPIImpTest.mpi_reduce_sum \
               test/gtest_links/CommMPIImpTest.mpi_allreduce \
               test/gtest_links/CommMPIImpTest.mpi_gather \
               test/gtest_links/CommMPIImpTest.mpi_gatherv \
@@ -184,11 +199,15 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/CommMPIImpTest.mpi_mem_ops \
               test/gtest_links/CommMPIImpTest.mpi_barrier \
               test/gtest_links/CommMPIImpTest.mpi_win_ops \
+              test/gtest_links/CommMPIImpTest.mpi_win_flush_ops \
               test/gtest_links/MSRIOTest.read_aligned \
               test/gtest_links/MSRIOTest.read_unaligned \
               test/gtest_links/MSRIOTest.write \
               test/gtest_links/MSRIOTest.read_batch \
+              test/gtest_links/MSRIOTest.read_batch_parallel \
+              test/gtest_links/MSRIOTest.read_batch_worker \
               test/gtest_links/MSRIOTest.write_batch \
+              test/gtest_links/MSRIOTest.write_batch_cache \
               test/gtest_links/MSRTest.msr \
               test/gtest_links/MSRTest.msr_overflow \
               test/gtest_links/MSRTest.msr_signal \
@@ -241,17 +260,24 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/MSRIOGroupTest.push_signal \
               test/gtest_links/MSRIOGroupTest.sample \
               test/gtest_links/MSRIOGroupTest.sample_raw \
+              test/gtest_links/MSRIOGroupTest.sample_overflow \
+              test/gtest_links/MSRIOGroupTest.sample_async \
+              test/gtest_links/MSRIOGroupTest.sample_async_no_spare_cpu \
               test/gtest_links/MSRIOGroupTest.read_signal \
               test/gtest_links/MSRIOGroupTest.signal_alias \
               test/gtest_links/MSRIOGroupTest.control_error \
               test/gtest_links/MSRIOGroupTest.push_control \
               test/gtest_links/MSRIOGroupTest.adjust \
+              test/gtest_links/MSRIOGroupTest.adjust_combined \
               test/gtest_links/MSRIOGroupTest.write_control \
               test/gtest_links/MSRIOGroupTest.control_alias \
               test/gtest_links/MSRIOGroupTest.whitelist \
               test/gtest_links/MSRIOGroupTest.cpuid \
               test/gtest_links/MSRIOGroupTest.register_msr_signal \
               test/gtest_links/MSRIOGroupTest.register_msr_control \
+              test/gtest_links/MSRIOGroupTest.save_restore \
+              test/gtest_links/MSRIOGroupTest.save_restore_scoped \
+              test/gtest_links/MSRIOGroupTest.write_control_power_package \
               test/gtest_links/PlatformIOTest.signal_control_names \
               test/gtest_links/PlatformIOTest.domain_type \
               test/gtest_links/PlatformIOTest.push_signal \
@@ -274,6 +300,8 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/CombinedSignalTest.sample_sum \
               test/gtest_links/CombinedSignalTest.sample_flat_derivative \
               test/gtest_links/CombinedSignalTest.sample_slope_derivative \
+              test/gtest_links/CombinedSignalTest.sample_derivative_window \
+              test/gtest_links/CombinedSignalTest.sample_derivative_long_run \
               test/gtest_links/ProfileTestIntegration.config \
               test/gtest_links/ProfileTestIntegration.misconfig_ctl_shmem \
               test/gtest_links/ProfileTestIntegration.misconfig_tprof_shmem \
@@ -292,19 +320,37 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/TreeCommLevelTest.receive_up_incomplete \
               test/gtest_links/TreeCommLevelTest.receive_down_complete \
               test/gtest_links/TreeCommLevelTest.receive_down_incomplete \
+              test/gtest_links/TreeCommLevelTest.send_up_threshold \
+              test/gtest_links/ChildMatrixTest.layout \
+              test/gtest_links/ChildMatrixTest.aggregate_sample \
+              test/gtest_links/LoopSchedulerTest.invalid_construction \
+              test/gtest_links/LoopSchedulerTest.wait \
+              test/gtest_links/LoopSchedulerTest.overrun \
+              test/gtest_links/LoopSchedulerTest.first_wait \
+              test/gtest_links/SequenceTreeCommLevelTest.send_receive_up \
+              test/gtest_links/SequenceTreeCommLevelTest.send_receive_down \
+              test/gtest_links/SequenceTreeCommLevelTest.remote_send \
+              test/gtest_links/SequenceTreeCommLevelTest.remote_receive_separate \
+              test/gtest_links/SequenceTreeCommLevelTest.send_up_threshold \
               test/gtest_links/TreeCommTest.geometry \
               test/gtest_links/TreeCommTest.geometry_nonroot \
               test/gtest_links/TreeCommTest.send_receive \
               test/gtest_links/TreeCommTest.overhead_send \
+              test/gtest_links/TreeCommTest.topology_fan_out \
+              test/gtest_links/TreeCommTest.switch_group \
+              test/gtest_links/TreeCommTest.sample_threshold \
               test/gtest_links/MonitorAgentTest.fixed_signal_list \
               test/gtest_links/MonitorAgentTest.sample_platform \
               test/gtest_links/MonitorAgentTest.descend_nothing \
               test/gtest_links/MonitorAgentTest.ascend_aggregates_signals \
               test/gtest_links/ReporterTest.generate \
+              test/gtest_links/ReporterTest.generate_summary \
+              test/gtest_links/ReporterTest.generate_summary_union \
               test/gtest_links/KontrollerTest.single_node \
               test/gtest_links/KontrollerTest.two_level_controller_2 \
               test/gtest_links/KontrollerTest.two_level_controller_1 \
               test/gtest_links/KontrollerTest.two_level_controller_0 \
+              test/gtest_links/KontrollerTest.sample_threshold \
               test/gtest_links/ManagerIOTest.write_json_file \
               test/gtest_links/ManagerIOTest.write_shm \
               test/gtest_links/ManagerIOTest.negative_write_json_file \
@@ -319,6 +365,10 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/TracerTest.columns \
               test/gtest_links/TracerTest.update_samples \
               test/gtest_links/TracerTest.region_entry_exit \
+              test/gtest_links/TracerTest.binary \
+              test/gtest_links/TracerTest.binary_not_closed \
+              test/gtest_links/TracerTest.binary_many_records \
+              test/gtest_links/TracerTest.update_writer \
               test/gtest_links/AgentFactoryTest.static_info_monitor \
               test/gtest_links/ApplicationIOTest.passthrough \
               test/gtest_links/KruntimeRegulatorTest.exceptions \
@@ -331,6 +381,9 @@ GTEST_TESTS = test/gtest_links/PlatformFactoryTest.platform_register \
               test/gtest_links/EpochRuntimeRegulatorTest.rank_enter_exit_trace \
               test/gtest_links/EpochRuntimeRegulatorTest.all_ranks_enter_exit \
               test/gtest_links/EpochRuntimeRegulatorTest.epoch_runtime \
+              test/gtest_links/EpochRuntimeRegulatorTest.epoch_energy_sample \
+              test/gtest_links/EpochRuntimeRegulatorTest.epoch_energy_before_read_batch \
+              test/gtest_links/EpochRuntimeRegulatorTest.epoch_energy_every_batch \
               test/gtest_links/PowerBalancerTest.power_cap \
               test/gtest_links/PowerBalancerTest.is_runtime_stable \
               test/gtest_links/PowerBalancerTest.balance \
@@ -369,10 +422,12 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/PlatformImpTest.cpp \
                           test/PlatformTopologyTest.cpp \
                           test/CircularBufferTest.cpp \
+                          test/WindowStatisticsTest.cpp \
                           test/GlobalPolicyTest.cpp \
                           test/ManagerIOTest.cpp \
                           test/ExceptionTest.cpp \
                           test/ProfileTableTest.cpp \
+                          test/SampleFilterTest.cpp \
                           test/SampleRegulatorTest.cpp \
                           test/RegionTest.cpp \
                           test/PolicyTest.cpp \
@@ -402,6 +457,7 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/MockProfileTable.hpp \
                           test/MockProfileThreadTable.hpp \
                           test/MockSampleScheduler.hpp \
+                          test/MockLoopScheduler.hpp \
                           test/MockPlatform.hpp \
                           test/MockProfileSampler.hpp \
                           test/MockGlobalPolicy.hpp \
@@ -436,12 +492,15 @@ test_geopm_test_SOURCES = test/geopm_test.cpp \
                           test/MockPlatformIO.hpp \
                           test/MockPlatformTopo.hpp \
                           test/ProfileIOSampleTest.cpp \
+                          test/KprofileIOSampleTest.cpp \
                           test/ProfileIOGroupTest.cpp \
                           test/MockProfileIOSample.hpp \
                           test/CombinedSignalTest.cpp \
                           test/MockRuntimeRegulator.hpp \
                           test/ProfileTest.cpp \
                           test/TreeCommLevelTest.cpp \
+                          test/ChildMatrixTest.cpp \
+                          test/LoopSchedulerTest.cpp \
                           test/TreeCommTest.cpp \
                           test/MockTreeCommLevel.hpp \
                           test/MonitorAgentTest.cpp \
@@ -478,6 +537,22 @@ if GEOPM_DISABLE_NULL_PTR
     test_geopm_test_CFLAGS += -fno-delete-null-pointer-checks
     test_geopm_test_CXXFLAGS += -fno-delete-null-pointer-checks
 endif
+check_PROGRAMS += test/geopm_msrio_bench
+test_geopm_msrio_bench_SOURCES = test/geopm_msrio_bench.cpp
+test_geopm_msrio_bench_LDADD = libgeopmpolicy.la
+
+check_PROGRAMS += test/geopm_msriogroup_bench
+test_geopm_msriogroup_bench_SOURCES = test/geopm_msriogroup_bench.cpp
+test_geopm_msriogroup_bench_LDADD = libgeopmpolicy.la
+
+check_PROGRAMS += test/geopm_shm_rendezvous_bench
+test_geopm_shm_rendezvous_bench_SOURCES = test/geopm_shm_rendezvous_bench.cpp
+test_geopm_shm_rendezvous_bench_LDADD = libgeopmpolicy.la
+
+check_PROGRAMS += test/geopm_window_stats_bench
+test_geopm_window_stats_bench_SOURCES = test/geopm_window_stats_bench.cpp
+test_geopm_window_stats_bench_LDADD = libgeopmpolicy.la
+
 if ENABLE_OPENMP
     test_geopm_static_modes_test_SOURCES = test/geopm_static_modes_test.cpp
     test_geopm_static_modes_test_LDADD = libgeopmpolicy.la
@@ -63,6 +63,10 @@ class MockAgent : public geopm::Agent
                            std::vector<std::string>(void));
         MOCK_METHOD1(trace_values,
                      void(std::vector<double> &values));
+        MOCK_CONST_METHOD0(sample_threshold,
+                           std::vector<geopm::SampleFilter::m_threshold_s>(void));
+        MOCK_CONST_METHOD0(loop_scheduler,
+                           const geopm::ILoopScheduler *(void));
 };
 
 #endif
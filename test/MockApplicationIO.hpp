@@ -60,6 +60,8 @@ class MockApplicationIO : public geopm::IApplicationIO
                            double(void));
         MOCK_CONST_METHOD0(total_epoch_ignore_runtime,
                            double(void));
+        MOCK_CONST_METHOD0(total_app_num_drop,
+                           size_t(void));
         MOCK_CONST_METHOD0(total_app_mpi_runtime,
                            double(void));
         MOCK_CONST_METHOD0(total_epoch_runtime,
@@ -74,6 +76,8 @@ class MockApplicationIO : public geopm::IApplicationIO
                            int(uint64_t region_id));
         MOCK_METHOD1(update,
                      void(std::shared_ptr<geopm::Comm> comm));
+        MOCK_METHOD0(notify_read_batch,
+                     void(void));
         MOCK_METHOD0(profile_io_group,
                      std::shared_ptr<geopm::IOGroup>(void));
         MOCK_CONST_METHOD0(region_info,
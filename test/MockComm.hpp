@@ -70,6 +70,24 @@ class MockComm : public geopm::Comm
             void (size_t window_id, bool isExclusive, int rank, int assert));
         MOCK_CONST_METHOD2(window_unlock,
             void (size_t window_id, int rank));
+        MOCK_CONST_METHOD0(is_node_local,
+            bool (void));
+        MOCK_METHOD2(window_create_shared,
+            size_t (size_t size, void **base));
+        MOCK_CONST_METHOD2(window_shared_query,
+            void *(size_t window_id, int rank));
+        MOCK_CONST_METHOD1(window_lock_all,
+            void (size_t window_id));
+        MOCK_CONST_METHOD1(window_unlock_all,
+            void (size_t window_id));
+        MOCK_CONST_METHOD2(window_flush,
+            void (size_t window_id, int rank));
+        MOCK_CONST_METHOD2(window_flush_local,
+            void (size_t window_id, int rank));
+        MOCK_CONST_METHOD1(window_sync,
+            void (size_t window_id));
+        MOCK_CONST_METHOD1(window_is_unified,
+            bool (size_t window_id));
         MOCK_CONST_METHOD2(coordinate,
             void (int rank, std::vector<int> &coord));
         MOCK_CONST_METHOD1(coordinate,
@@ -82,6 +100,8 @@ class MockComm : public geopm::Comm
             bool (bool is_true));
         MOCK_CONST_METHOD4(reduce_max,
             void (double *send_buf, double *recv_buf, size_t count, int root));
+        MOCK_CONST_METHOD4(reduce_sum,
+            void (double *send_buf, double *recv_buf, size_t count, int root));
         MOCK_CONST_METHOD5(gather,
             void (const void *send_buf, size_t send_size, void *recv_buf,
                 size_t recv_size, int root));
@@ -44,10 +44,16 @@ class MockKprofileIOSample : public geopm::IKprofileIOSample {
                      void(std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_begin, std::vector<std::pair<uint64_t, struct geopm_prof_message_s> >::const_iterator prof_sample_end));
         MOCK_CONST_METHOD0(per_cpu_region_id,
                            std::vector<uint64_t>(void));
+        MOCK_CONST_METHOD1(per_cpu_region_id,
+                           void(std::vector<uint64_t> &result));
         MOCK_CONST_METHOD1(per_cpu_progress,
                            std::vector<double>(const struct geopm_time_s &extrapolation_time));
+        MOCK_CONST_METHOD2(per_cpu_progress,
+                           void(const struct geopm_time_s &extrapolation_time, std::vector<double> &result));
+        MOCK_CONST_METHOD2(per_cpu_runtime,
+                           void(uint64_t region_id, std::vector<double> &result));
         MOCK_CONST_METHOD1(per_cpu_runtime,
-                           std::vector<double>(uint64_t region_id));
+                           void(std::vector<double> &result));
         MOCK_CONST_METHOD1(per_rank_runtime,
                            std::vector<double>(uint64_t region_id));
         MOCK_CONST_METHOD0(total_app_runtime,
@@ -43,6 +43,8 @@ class MockProfileSampler : public geopm::IProfileSampler
     public:
         MOCK_CONST_METHOD0(capacity,
                      size_t (void));
+        MOCK_CONST_METHOD0(num_drop,
+                     size_t (void));
         MOCK_METHOD3(sample,
                      void (std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > &content,
                            size_t &length,
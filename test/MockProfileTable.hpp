@@ -53,6 +53,10 @@ class MockProfileTable : public geopm::IProfileTable
                 bool (size_t header_offset));
         MOCK_METHOD2(name_set,
                 bool (size_t header_offset, std::set<std::string> &name));
+        MOCK_CONST_METHOD0(num_drop,
+                size_t (void));
+        MOCK_CONST_METHOD0(is_ordered,
+                bool (void));
 };
 
 #endif
@@ -41,11 +41,12 @@ class MockReporter : public geopm::IReporter
 {
     public:
         MOCK_METHOD0(init, void(void));
-        MOCK_METHOD7(generate,
+        MOCK_METHOD8(generate,
                      void(const std::string &agent_name,
                           const std::vector<std::pair<std::string, std::string> > &agent_report_header,
                           const std::vector<std::pair<std::string, std::string> > &agent_node_report,
                           const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report,
+                          const std::vector<std::pair<std::string, std::string> > &controller_report,
                           const geopm::IApplicationIO &application_io,
                           std::shared_ptr<geopm::Comm> comm,
                           const geopm::ITreeComm &tree_comm));
@@ -51,6 +51,10 @@ class MockTracer : public geopm::ITracer
                           std::list<geopm_region_info_s> region_entry_exit));
         MOCK_METHOD0(flush,
                      void(void));
+        MOCK_CONST_METHOD0(num_stall,
+                           size_t(void));
+        MOCK_CONST_METHOD0(num_byte_drop,
+                           size_t(void));
 };
 
 #endif
@@ -101,6 +101,8 @@ class MockTreeComm : public geopm::ITreeComm
         }
         MOCK_CONST_METHOD0(overhead_send,
                      size_t(void));
+        MOCK_METHOD2(sample_threshold,
+                     void(int level, const std::vector<geopm::SampleFilter::m_threshold_s> &threshold));
         MOCK_METHOD1(broadcast_string,
                      void(const std::string &str));
         MOCK_METHOD0(broadcast_string,
@@ -54,6 +54,8 @@ class MockTreeCommLevel : public geopm::ITreeCommLevel {
                      bool(std::vector<double> &policy));
         MOCK_CONST_METHOD0(overhead_send,
                      size_t(void));
+        MOCK_METHOD1(sample_threshold,
+                     void(const std::vector<geopm::SampleFilter::m_threshold_s> &threshold));
 };
 
 #endif
@@ -309,9 +309,9 @@ TEST_F(PlatformIOTest, signal_power)
         EXPECT_CALL(*it, read_batch()).Times(3);
         if (it->is_valid_signal("TIME")) {
             EXPECT_CALL(*it, sample(0))
-                .WillOnce(Return(2.0)).WillOnce(Return(2.0))
-                .WillOnce(Return(3.0)).WillOnce(Return(3.0))
-                .WillOnce(Return(4.0)).WillOnce(Return(4.0));
+                .WillOnce(Return(2.0))
+                .WillOnce(Return(3.0))
+                .WillOnce(Return(4.0));
         }
         if (it->is_valid_signal("ENERGY_PACKAGE")) {
             EXPECT_CALL(*it, sample(0))
@@ -326,7 +326,7 @@ TEST_F(PlatformIOTest, signal_power)
                 .WillOnce(Return(777.77));
         }
         if (it->is_valid_signal("REGION_ID#")) {
-            EXPECT_CALL(*it, sample(0)).Times(6 * M_NUM_CPU)
+            EXPECT_CALL(*it, sample(0)).Times(3 * M_NUM_CPU)
                 .WillRepeatedly(Return(42));
         }
     }
@@ -433,9 +433,9 @@ TEST_F(PlatformIOTest, sample_region_total)
     double rid2sig = geopm_field_to_signal(rid2);
 
     // expected return values and counts for each iteration
-    // sample count: 4 times for each signal in sample_total, 4 times in read_batch for each signal = 24
+    // sample count: each of the 4 per-cpu signals is sampled once per read_batch
     // note that these counts will change if number of CPUs per domain changes
-    int rid_sample_count = 24;
+    int rid_sample_count = 4;
     // rid 1 enters at batch 0 and exits at batch 2
     // rid 2 enters at batch 2 and exits at batch 4
     // rid 1 enters at batch 4 and is still running at batch 5
@@ -451,12 +451,12 @@ TEST_F(PlatformIOTest, sample_region_total)
     for (int batch = 0; batch < num_batch; ++batch) {
         for (auto &it : m_iogroup_ptr) {
             if (it->is_valid_signal("ENERGY_PACKAGE")) {
-                EXPECT_CALL(*it, sample(0)).Times(2)
-                    .WillRepeatedly(Return(energy[batch]));
+                EXPECT_CALL(*it, sample(0))
+                    .WillOnce(Return(energy[batch]));
             }
             if (it->is_valid_signal("TIME")) {
-                EXPECT_CALL(*it, sample(0)).Times(2)
-                    .WillRepeatedly(Return(time[batch]));
+                EXPECT_CALL(*it, sample(0))
+                    .WillOnce(Return(time[batch]));
             }
             if (it->is_valid_signal("REGION_ID#")) {
                 EXPECT_CALL(*it, sample(0)).Times(rid_sample_count)
@@ -470,7 +470,13 @@ TEST_F(PlatformIOTest, sample_region_total)
         EXPECT_EQ(exp_rid1_time[batch], m_platio->sample_region_total(time_idx, rid1));
         EXPECT_EQ(exp_rid2_nrg[batch], m_platio->sample_region_total(nrg_idx, rid2));
         EXPECT_EQ(exp_rid2_time[batch], m_platio->sample_region_total(time_idx, rid2));
+        // region never seen
+        EXPECT_EQ(0.0, m_platio->sample_region_total(nrg_idx, 0x666));
     }
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_region_total(-1, rid1), GEOPM_ERROR_INVALID,
+                               "not pushed with push_region_signal_total()");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_region_total(m_platio->num_signal(), rid1), GEOPM_ERROR_INVALID,
+                               "not pushed with push_region_signal_total()");
 }
 
 TEST_F(PlatformIOTest, adjust)
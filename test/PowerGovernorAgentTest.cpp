@@ -140,7 +140,11 @@ TEST_F(PowerGovernorAgentTest, wait)
     geopm_time(&start_time);
     m_agent->wait();
     geopm_time(&end_time);
-    EXPECT_NEAR(0.005, geopm_time_diff(&start_time, &end_time), 0.0001);
+    // the wait sleeps rather than spins, so allow for the test
+    // process being descheduled, but never return early
+    double elapsed = geopm_time_diff(&start_time, &end_time);
+    EXPECT_LE(0.005, elapsed);
+    EXPECT_GT(0.010, elapsed);
 }
 
 TEST_F(PowerGovernorAgentTest, sample_platform)
@@ -214,7 +218,7 @@ TEST_F(PowerGovernorAgentTest, ascend)
     }
 
     // once per m_ascend_period if converged
-    in_sample = {{2.3, true}, {3.4, true}};
+    in_sample = {{2.3, true, 1.0}, {3.4, true, 2.0}};
     // average of power samples
     std::vector<double> expected {(2.3 + 3.4)/2.0, true, 1.5};
     EXPECT_TRUE(m_agent->ascend(in_sample, out_sample));
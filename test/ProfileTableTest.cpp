@@ -279,3 +279,90 @@ TEST_F(ProfileTableTest, name_set_fill_long)
     ASSERT_EQ(input_set, output_set);
     ASSERT_LT(1, count);
 }
+
+TEST_F(ProfileTableTest, ring_order)
+{
+    geopm::ProfileRingTable ring(m_small_size, (void *)m_small_ptr);
+    size_t capacity = ring.capacity();
+    ASSERT_LT(4ULL, capacity);
+    EXPECT_EQ(0ULL, ring.size());
+    EXPECT_TRUE(ring.is_ordered());
+    EXPECT_FALSE(m_table->is_ordered());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(capacity);
+    struct geopm_prof_message_s message;
+    message.rank = 0;
+    message.region_id = 1234;
+    message.timestamp = {{0, 0}};
+    size_t length = 0;
+    uint64_t expect_idx = 1;
+    // Fill and drain several times so that the sequence wraps
+    // around the end of the ring.
+    for (int iter = 0; iter < 5; ++iter) {
+        size_t num_insert = capacity / 2 + iter;
+        for (size_t i = 0; i < num_insert; ++i) {
+            message.progress = (double)(expect_idx + i);
+            ring.insert(expect_idx + i, message);
+        }
+        EXPECT_EQ(num_insert, ring.size());
+        ring.dump(contents.begin(), length);
+        ASSERT_EQ(num_insert, length);
+        for (size_t i = 0; i < length; ++i) {
+            EXPECT_EQ(expect_idx, contents[i].first);
+            EXPECT_EQ((double)expect_idx, contents[i].second.progress);
+            ++expect_idx;
+        }
+        EXPECT_EQ(0ULL, ring.size());
+    }
+    EXPECT_EQ(0ULL, ring.num_drop());
+    EXPECT_THROW(ring.insert(0, message), geopm::Exception);
+}
+
+TEST_F(ProfileTableTest, ring_drop)
+{
+    geopm::ProfileRingTable ring(m_small_size, (void *)m_small_ptr);
+    size_t capacity = ring.capacity();
+    struct geopm_prof_message_s message;
+    message.rank = 0;
+    message.region_id = 1234;
+    message.timestamp = {{0, 0}};
+    for (size_t i = 1; i <= capacity + 3; ++i) {
+        message.progress = (double)i;
+        EXPECT_NO_THROW(ring.insert(i, message));
+    }
+    EXPECT_EQ(3ULL, ring.num_drop());
+    EXPECT_EQ(capacity, ring.size());
+    std::vector<std::pair<uint64_t, struct geopm_prof_message_s> > contents(capacity);
+    size_t length = 0;
+    ring.dump(contents.begin(), length);
+    ASSERT_EQ(capacity, length);
+    // The oldest values are kept and the newest are dropped.
+    EXPECT_EQ(1ULL, contents.front().first);
+    EXPECT_EQ(capacity, contents.back().first);
+    ring.insert(1, message);
+    EXPECT_EQ(1ULL, ring.size());
+    EXPECT_EQ(3ULL, ring.num_drop());
+    // Names are passed through the same buffer as the base class.
+    std::set<std::string> input_set = {"hello", "goodbye"};
+    std::set<std::string> output_set;
+    for (auto &name : input_set) {
+        ring.key(name);
+    }
+    EXPECT_TRUE(ring.name_fill(0));
+    EXPECT_TRUE(ring.name_set(0, output_set));
+    EXPECT_EQ(input_set, output_set);
+}
+
+TEST_F(ProfileTableTest, ring_init)
+{
+    // The ring owns the layout of the buffer: only the three cache
+    // line header is cleared and no hash table locks are written.
+    size_t header_size = 3 * 64;
+    std::vector<char> buffer(m_small_size, 'x');
+    geopm::ProfileRingTable ring(buffer.size(), (void *)buffer.data());
+    EXPECT_EQ(0ULL, ring.size());
+    EXPECT_EQ(0ULL, ring.num_drop());
+    EXPECT_EQ(std::vector<char>(header_size, '\0'),
+              std::vector<char>(buffer.begin(), buffer.begin() + header_size));
+    EXPECT_EQ(std::vector<char>(buffer.size() - header_size, 'x'),
+              std::vector<char>(buffer.begin() + header_size, buffer.end()));
+}
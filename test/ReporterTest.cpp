@@ -30,8 +30,12 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+#include <unistd.h>
+
 #include <sstream>
 #include <fstream>
+#include <iterator>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -68,6 +72,40 @@ class ReporterTestMockComm : public MockComm
         {
             memcpy(recv_buf, send_buf, send_size);
         }
+        void reduce_max(double *send_buf, double *recv_buf, size_t count, int root) const override
+        {
+            memcpy(recv_buf, send_buf, count * sizeof(double));
+        }
+        void reduce_sum(double *send_buf, double *recv_buf, size_t count, int root) const override
+        {
+            memcpy(recv_buf, send_buf, count * sizeof(double));
+        }
+};
+
+// Mock for one level of the region set merge at the level root; the
+// peer's region entries are appended to the root's
+class ReporterTestLevelComm : public MockComm
+{
+    public:
+        ReporterTestLevelComm(const std::string &peer_entry)
+            : m_peer_entry(peer_entry)
+        {
+
+        }
+        void gather(const void *send_buf, size_t send_size, void *recv_buf,
+                    size_t recv_size, int root) const override
+        {
+            ((size_t *)recv_buf)[0] = *((size_t *)send_buf);
+            ((size_t *)recv_buf)[1] = m_peer_entry.size();
+        }
+        void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
+                     const std::vector<size_t> &recv_sizes,
+                     const std::vector<off_t> &rank_offset, int root) const override
+        {
+            memcpy((char *)recv_buf + rank_offset[0], send_buf, send_size);
+            memcpy((char *)recv_buf + rank_offset[1], m_peer_entry.data(), m_peer_entry.size());
+        }
+        std::string m_peer_entry;
 };
 
 class ReporterTest : public testing::Test
@@ -82,6 +120,8 @@ class ReporterTest : public testing::Test
         };
         ReporterTest();
         void TearDown(void);
+        void expect_init(void);
+        void expect_generate(int num_rank = 1);
         std::string m_report_name = "test_reporter.out";
 
         MockPlatformIO m_platform_io;
@@ -146,6 +186,15 @@ ReporterTest::ReporterTest()
     ON_CALL(m_application_io, region_name_set())
         .WillByDefault(Return(m_region_set));
 
+    expect_init();
+
+    m_comm = std::make_shared<ReporterTestMockComm>();
+    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0);
+    m_reporter->init();
+}
+
+void ReporterTest::expect_init(void)
+{
     EXPECT_CALL(m_platform_io, push_signal("TIME", _, _))
         .WillOnce(Return(M_TIME_IDX));
     EXPECT_CALL(m_platform_io, push_region_signal_total(M_TIME_IDX, _, _));
@@ -161,20 +210,9 @@ ReporterTest::ReporterTest()
     EXPECT_CALL(m_platform_io, push_signal("CYCLES_THREAD", _, _))
         .WillOnce(Return(M_CLK_CORE_IDX));
     EXPECT_CALL(m_platform_io, push_region_signal_total(M_CLK_CORE_IDX, _, _));
-
-    m_comm = std::make_shared<ReporterTestMockComm>();
-    m_reporter = geopm::make_unique<Reporter>(m_report_name, m_platform_io, 0);
-    m_reporter->init();
 }
 
-void ReporterTest::TearDown(void)
-{
-    std::remove(m_report_name.c_str());
-}
-
-void check_report(std::istream &expected, std::istream &result);
-
-TEST_F(ReporterTest, generate)
+void ReporterTest::expect_generate(int num_rank)
 {
     EXPECT_CALL(m_application_io, report_name()).WillOnce(Return(m_report_name));
     EXPECT_CALL(m_application_io, profile_name());
@@ -183,6 +221,7 @@ TEST_F(ReporterTest, generate)
     EXPECT_CALL(m_application_io, total_app_energy_pkg()).WillOnce(Return(2222));
     EXPECT_CALL(m_application_io, total_app_energy_dram()).WillOnce(Return(2222));
     EXPECT_CALL(m_application_io, total_app_mpi_runtime()).WillOnce(Return(45));
+    EXPECT_CALL(m_application_io, total_app_num_drop()).WillOnce(Return(3));
     EXPECT_CALL(m_application_io, total_epoch_ignore_runtime()).Times(2)
         .WillRepeatedly(Return(0.7));
     EXPECT_CALL(m_application_io, total_epoch_runtime()).WillOnce(Return(70.0));
@@ -241,7 +280,19 @@ TEST_F(ReporterTest, generate)
             .WillOnce(Return(rid.second));
     }
     EXPECT_CALL(*m_comm, rank()).WillOnce(Return(0));
-    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(1));
+    EXPECT_CALL(*m_comm, num_rank()).WillOnce(Return(num_rank));
+}
+
+void ReporterTest::TearDown(void)
+{
+    std::remove(m_report_name.c_str());
+}
+
+void check_report(std::istream &expected, std::istream &result);
+
+TEST_F(ReporterTest, generate)
+{
+    expect_generate();
 
     std::vector<std::pair<std::string, std::string> >  agent_header {
         {"one", "1"},
@@ -249,6 +300,8 @@ TEST_F(ReporterTest, generate)
     std::vector<std::pair<std::string, std::string> >  agent_node_report {
         {"three", "3"},
         {"four", "4"} };
+    std::vector<std::pair<std::string, std::string> >  controller_report {
+        {"five", "5"} };
 
     // Check for labels at start of line but ignore numbers
     // Note that region lines start with tab
@@ -313,17 +366,151 @@ TEST_F(ReporterTest, generate)
         "    mpi-runtime (sec): 45\n"
         "    ignore-time (sec): 0.7\n"
         "    geopmctl memory HWM:\n"
-        "    geopmctl network BW (B/sec): 678\n\n";
+        "    geopmctl network BW (B/sec): 678\n"
+        "    profile-drop (count): 3\n"
+        "Controller:\n"
+        "    five: 5\n\n";
 
     std::istringstream exp_stream(expected);
 
     m_reporter->generate("my_agent", agent_header, agent_node_report, m_region_agent_detail,
-                         m_application_io,
+                         controller_report, m_application_io,
                          m_comm, m_tree_comm);
     std::ifstream report(m_report_name);
     check_report(exp_stream, report);
 }
 
+TEST_F(ReporterTest, generate_summary)
+{
+    expect_init();
+    Reporter reporter(m_report_name, m_platform_io, 0, true, true);
+    reporter.init();
+    expect_generate();
+    EXPECT_CALL(*m_comm, broadcast(_, _, 0)).Times(2);
+
+    std::vector<std::pair<std::string, std::string> >  agent_header {
+        {"one", "1"},
+        {"two", "2"} };
+    std::vector<std::pair<std::string, std::string> >  agent_node_report {
+        {"three", "3"},
+        {"four", "4"} };
+
+    // Only statistics reduced over hosts are in the main report
+    std::string expected_header = "#####\n"
+        "Profile: " + m_profile_name + "\n"
+        "Agent: my_agent\n"
+        "one: 1\n"
+        "two: 2\n"
+        "Policy Mode:\n"
+        "Tree Decider:\n"
+        "Leaf Decider:\n"
+        "Power Budget:\n";
+    std::string expected = expected_header +
+        "\n"
+        "Host count: 1\n"
+        "Region all2all (\n"
+        "    host-count: 1\n"
+        "    runtime (sec): min=33.33 max=33.33 mean=33.33 sum=33.33\n"
+        "    sync-runtime (sec): min=555.5 max=555.5 mean=555.5 sum=555.5\n"
+        "    package-energy (joules): min=389 max=389 mean=389 sum=389\n"
+        "    dram-energy (joules): min=389 max=389 mean=389 sum=389\n"
+        "    frequency (%): min=81.8182 max=81.8182 mean=81.8182 sum=81.8182\n"
+        "    frequency (Hz): min=0.818182 max=0.818182 mean=0.818182 sum=0.818182\n"
+        "    mpi-runtime (sec): min=3.4 max=3.4 mean=3.4 sum=3.4\n"
+        "    count: min=20 max=20 mean=20 sum=20\n"
+        "Region model-init (\n"
+        "    host-count: 1\n"
+        "    runtime (sec): min=22.11 max=22.11 mean=22.11 sum=22.11\n"
+        "    sync-runtime (sec): min=333.5 max=333.5 mean=333.5 sum=333.5\n"
+        "    package-energy (joules): min=444.5 max=444.5 mean=444.5 sum=444.5\n"
+        "    dram-energy (joules): min=444.5 max=444.5 mean=444.5 sum=444.5\n"
+        "    frequency (%): min=84.8485 max=84.8485 mean=84.8485 sum=84.8485\n"
+        "    frequency (Hz): min=0.848485 max=0.848485 mean=0.848485 sum=0.848485\n"
+        "    mpi-runtime (sec): min=5.6 max=5.6 mean=5.6 sum=5.6\n"
+        "    count: min=1 max=1 mean=1 sum=1\n"
+        "Region unmarked-region (\n"
+        "    host-count: 1\n"
+        "    runtime (sec): min=12.13 max=12.13 mean=12.13 sum=12.13\n"
+        "    sync-runtime (sec): min=444 max=444 mean=444 sum=444\n"
+        "    package-energy (joules): min=111.5 max=111.5 mean=111.5 sum=111.5\n"
+        "    dram-energy (joules): min=111.5 max=111.5 mean=111.5 sum=111.5\n"
+        "    frequency (%): min=77.2727 max=77.2727 mean=77.2727 sum=77.2727\n"
+        "    frequency (Hz): min=0.772727 max=0.772727 mean=0.772727 sum=0.772727\n"
+        "    mpi-runtime (sec): min=1.2 max=1.2 mean=1.2 sum=1.2\n"
+        "    count: min=0 max=0 mean=0 sum=0\n"
+        "Region epoch (\n"
+        "    host-count: 1\n"
+        "    runtime (sec): min=77.7 max=77.7 mean=77.7 sum=77.7\n"
+        "    sync-runtime (sec): min=666 max=666 mean=666 sum=666\n"
+        "    package-energy (joules): min=4444 max=4444 mean=4444 sum=4444\n"
+        "    dram-energy (joules): min=4444 max=4444 mean=4444 sum=4444\n"
+        "    frequency (%): min=0 max=0 mean=0 sum=0\n"
+        "    frequency (Hz): min=0 max=0 mean=0 sum=0\n"
+        "    mpi-runtime (sec): min=4.2 max=4.2 mean=4.2 sum=4.2\n"
+        "    count: min=0 max=0 mean=0 sum=0\n"
+        "Application Totals:\n"
+        "    runtime (sec): min=56 max=56 mean=56 sum=56\n"
+        "    package-energy (joules): min=2222 max=2222 mean=2222 sum=2222\n"
+        "    dram-energy (joules): min=2222 max=2222 mean=2222 sum=2222\n"
+        "    mpi-runtime (sec): min=45 max=45 mean=45 sum=45\n"
+        "    ignore-time (sec): min=0.7 max=0.7 mean=0.7 sum=0.7\n"
+        "    geopmctl network BW (B/sec): min=678 max=678 mean=678 sum=678\n"
+        "    profile-drop (count): min=3 max=3 mean=3 sum=3\n" "\n";
+    std::istringstream exp_stream(expected);
+
+    reporter.generate("my_agent", agent_header, agent_node_report, m_region_agent_detail,
+                      {}, m_application_io,
+                      m_comm, m_tree_comm);
+    std::ifstream report(m_report_name);
+    check_report(exp_stream, report);
+
+    // The host detail is written to the node file
+    char hostname[NAME_MAX];
+    gethostname(hostname, NAME_MAX);
+    std::string node_report_name = m_report_name + "-" + hostname;
+    std::ifstream node_report(node_report_name);
+    ASSERT_TRUE(node_report.good());
+    std::string node_report_str((std::istreambuf_iterator<char>(node_report)),
+                                std::istreambuf_iterator<char>());
+    EXPECT_THAT(node_report_str, HasSubstr("Profile: " + m_profile_name + "\n"));
+    EXPECT_THAT(node_report_str, HasSubstr("Host: " + std::string(hostname) + "\nthree: 3\nfour: 4\n"));
+    EXPECT_THAT(node_report_str, HasSubstr("    agent other stat: 2\n"));
+    EXPECT_THAT(node_report_str, HasSubstr("    profile-drop (count): 3\n"));
+    std::remove(node_report_name.c_str());
+}
+
+TEST_F(ReporterTest, generate_summary_union)
+{
+    expect_init();
+    Reporter reporter(m_report_name, m_platform_io, 0, true, false);
+    reporter.init();
+    expect_generate(2);
+    // The second host's region set is merged at rank zero in a
+    // single level; only its entries are received, not its report
+    std::ostringstream peer_entry;
+    peer_entry << std::hex << geopm_crc32_str(0, "all2all") << std::dec << " all2all" << '\0';
+    auto level_comm = std::make_shared<ReporterTestLevelComm>(peer_entry.str());
+    EXPECT_CALL(*level_comm, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*level_comm, num_rank()).WillOnce(Return(2));
+    EXPECT_CALL(*m_comm, split(testing::TypedEq<int>(0), testing::TypedEq<int>(0)))
+        .WillOnce(Return(level_comm));
+    EXPECT_CALL(*m_comm, broadcast(_, _, 0)).Times(2);
+
+    reporter.generate("my_agent", {}, {}, m_region_agent_detail,
+                      {}, m_application_io,
+                      m_comm, m_tree_comm);
+    std::ifstream report(m_report_name);
+    std::string report_str((std::istreambuf_iterator<char>(report)),
+                           std::istreambuf_iterator<char>());
+    EXPECT_THAT(report_str, HasSubstr("Host count: 2\n"));
+    for (const std::string name : {"all2all", "model-init", "unmarked-region", "epoch"}) {
+        std::string region_line = "Region " + name + " (";
+        size_t pos = report_str.find(region_line);
+        EXPECT_NE(std::string::npos, pos);
+        EXPECT_EQ(std::string::npos, report_str.find(region_line, pos + 1));
+    }
+}
+
 void check_report(std::istream &expected, std::istream &result)
 {
     char exp_line[1024];
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "SampleFilter.hpp"
+
+using geopm::SampleFilter;
+
+TEST(SampleFilterTest, is_send)
+{
+    SampleFilter filter;
+    // no thresholds: always send
+    EXPECT_TRUE(filter.is_send({1.0, 2.0}));
+    EXPECT_TRUE(filter.is_send({1.0, 2.0}));
+
+    filter.threshold({{0.1, 0.0, 0}, {0.0, 0.5, 3}});
+    EXPECT_TRUE(filter.is_send({10.0, 2.0}));
+    // relative change of the first value within 10%
+    EXPECT_FALSE(filter.is_send({10.9, 2.0}));
+    EXPECT_TRUE(filter.is_send({11.1, 2.0}));
+    // absolute change of the second value compared to last sent
+    EXPECT_FALSE(filter.is_send({11.1, 2.4}));
+    EXPECT_TRUE(filter.is_send({11.1, 2.6}));
+    // second value may be held back three times
+    EXPECT_FALSE(filter.is_send({11.1, 2.6}));
+    EXPECT_FALSE(filter.is_send({11.1, 2.6}));
+    EXPECT_FALSE(filter.is_send({11.1, 2.6}));
+    EXPECT_TRUE(filter.is_send({11.1, 2.6}));
+    // NaN compares as a change unless it was last sent
+    EXPECT_TRUE(filter.is_send({NAN, 2.6}));
+    EXPECT_FALSE(filter.is_send({NAN, 2.6}));
+    EXPECT_TRUE(filter.is_send({11.1, 2.6}));
+}
@@ -31,6 +31,8 @@
  */
 
 #include <iostream>
+#include <thread>
+#include <time.h>
 #include <sys/stat.h>
 
 #include "gtest/gtest.h"
@@ -157,3 +159,27 @@ TEST_F(SharedMemoryTest, share_data_ipc)
         exit(0);
     }
 }
+
+TEST_F(SharedMemoryTest, user_wait)
+{
+    // The user sleeps until the region is created instead of
+    // polling shm_open().
+    m_shm_key += "-user_wait";
+    std::thread create_thread([this] ()
+    {
+        usleep(200000);
+        config_shmem();
+    });
+    struct timespec cpu_begin;
+    struct timespec cpu_end;
+    (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_begin);
+    m_shmem_u = new geopm::SharedMemoryUser(m_shm_key, 5);
+    (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+    create_thread.join();
+    EXPECT_EQ(m_size, m_shmem_u->size());
+    double cpu_sec = (cpu_end.tv_sec - cpu_begin.tv_sec) +
+                     (cpu_end.tv_nsec - cpu_begin.tv_nsec) * 1E-9;
+    EXPECT_GT(0.1, cpu_sec);
+    cleanup_shmem_u();
+    cleanup_shmem();
+}
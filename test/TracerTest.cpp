@@ -197,6 +197,154 @@ TEST_F(TracerTest, region_entry_exit)
      check_trace(expected, result);
 }
 
+TEST_F(TracerTest, binary)
+{
+    Tracer tracer(m_path, m_hostname, m_agent, m_profile, true, m_platform_io, m_extra_cols, 1, true);
+    EXPECT_CALL(m_platform_io, sample(_)).Times(2 * (m_default_cols.size() + m_extra_cols.size()))
+        .WillRepeatedly(Return(2.2));
+
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    std::vector<double> agent_vals {88.8, 77.7};
+    // hint bits are removed from the region id
+    uint64_t hinted_id = geopm_region_id_set_hint(GEOPM_REGION_HINT_COMPUTE, 0x123);
+    std::list<geopm_region_info_s> short_regions = {
+        {hinted_id, 0.0, 3.2},
+        {0x123, 1.0, 3.2},
+    };
+    tracer.columns(agent_cols);
+    tracer.update(agent_vals, short_regions);
+    tracer.update(agent_vals, {});
+    tracer.flush();
+
+    std::string expected_str = "# \"geopm_version\"\n"
+        "# \"profile_name\" : \"" + m_profile + "\"\n"
+        "# \"power_budget\"\n"
+        "# \"tree_decider\"\n"
+        "# \"leaf_decider\"\n"
+        "# \"node_name\" : \"" + m_hostname + "\"\n"
+        "# \"agent\" : \"" + m_agent + "\"\n"
+        "seconds|region_id|progress-0|runtime-0|pkg_energy-0|dram_energy-0|"
+        "power_package|power_dram|frequency|extra|col1|col2\n"
+        "2.2e+00|0x0000000000000123|0.0|3.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|7.8e+01\n"
+        "2.2e+00|0x0000000000000123|1.0|3.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|7.8e+01\n"
+        "2.2e+00|0x000199009999999a|2.2|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|7.8e+01\n"
+        "2.2e+00|0x000199009999999a|2.2|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|7.8e+01\n";
+    std::istringstream expected(expected_str);
+    std::stringstream result;
+    Tracer::binary_to_text(m_path + "-" + m_hostname, result);
+    check_trace(expected, result);
+
+    // text trace is not a valid binary trace
+    std::ofstream text_trace(m_path + "-" + m_hostname);
+    text_trace << expected_str;
+    text_trace.close();
+    GEOPM_EXPECT_THROW_MESSAGE(Tracer::binary_to_text(m_path + "-" + m_hostname, result),
+                               GEOPM_ERROR_FILE_PARSE, "is not a valid binary trace");
+}
+
+TEST_F(TracerTest, binary_not_closed)
+{
+    std::string path = m_path + "-" + m_hostname;
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    std::vector<double> agent_vals {88.8, 77.7};
+    size_t num_update = 3;
+    EXPECT_CALL(m_platform_io, sample(_)).Times(num_update * (m_default_cols.size() + m_extra_cols.size()))
+        .WillRepeatedly(Return(2.2));
+    std::stringstream result;
+    {
+        Tracer tracer(m_path, m_hostname, m_agent, m_profile, true, m_platform_io, m_extra_cols, 1, true);
+        tracer.columns(agent_cols);
+        for (size_t update_idx = 0; update_idx < num_update; ++update_idx) {
+            tracer.update(agent_vals, {});
+        }
+        // The file is still padded out to the mapped size, as it is
+        // left if the controller is killed before flush()
+        std::ifstream binary(path, std::ios::binary | std::ios::ate);
+        size_t record_size = (m_default_cols.size() + m_extra_cols.size() + agent_cols.size()) * sizeof(double);
+        EXPECT_LT(num_update * record_size + 4096, (size_t)binary.tellg());
+        Tracer::binary_to_text(path, result);
+    }
+    std::string line;
+    size_t num_line = 0;
+    size_t num_record = 0;
+    while (std::getline(result, line)) {
+        ++num_line;
+        if (line[0] != '#' && num_line > 8) {
+            EXPECT_EQ(0u, line.find("2.2e+00|0x000199009999999a|2.2|")) << line;
+            ++num_record;
+        }
+    }
+    EXPECT_EQ(num_update, num_record);
+}
+
+TEST_F(TracerTest, binary_many_records)
+{
+    // enough records that conversion reads the file in several blocks
+    std::string path = m_path + "-" + m_hostname;
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    size_t num_update = 12000;
+    EXPECT_CALL(m_platform_io, sample(_)).Times(num_update * (m_default_cols.size() + m_extra_cols.size()))
+        .WillRepeatedly(Return(2.2));
+    {
+        Tracer tracer(m_path, m_hostname, m_agent, m_profile, true, m_platform_io, m_extra_cols, 1, true);
+        tracer.columns(agent_cols);
+        for (size_t update_idx = 0; update_idx < num_update; ++update_idx) {
+            tracer.update({88.8, (double)update_idx}, {});
+        }
+        tracer.flush();
+    }
+    std::stringstream result;
+    Tracer::binary_to_text(path, result);
+    std::string line;
+    size_t num_line = 0;
+    size_t num_record = 0;
+    std::string last_line;
+    while (std::getline(result, line)) {
+        ++num_line;
+        if (line[0] != '#' && num_line > 8) {
+            ++num_record;
+            last_line = line;
+        }
+    }
+    EXPECT_EQ(num_update, num_record);
+    EXPECT_EQ("2.2e+00|0x000199009999999a|2.2|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|1.2e+04",
+              last_line);
+}
+
+TEST_F(TracerTest, update_writer)
+{
+    Tracer tracer(m_path, m_hostname, m_agent, m_profile, true, m_platform_io, m_extra_cols, 1);
+    // enough rows to pass several full buffers to the writer thread
+    int num_update = 40000;
+    EXPECT_CALL(m_platform_io, sample(_)).Times(num_update * (m_default_cols.size() + m_extra_cols.size()))
+        .WillRepeatedly(Return(2.2));
+
+    std::vector<std::string> agent_cols {"col1", "col2"};
+    std::vector<double> agent_vals {88.8, 77.7};
+    tracer.columns(agent_cols);
+    for (int idx = 0; idx < num_update; ++idx) {
+        tracer.update(agent_vals, {});
+    }
+    tracer.flush();
+
+    std::string expected_line = "2.2e+00|0x000199009999999a|2.2|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|2.2e+00|8.9e+01|7.8e+01";
+    std::ifstream result(m_path + "-" + m_hostname);
+    ASSERT_TRUE(result.good()) << strerror(errno);
+    std::string line;
+    int num_line = 0;
+    while (std::getline(result, line)) {
+        if (line[0] != '#' && line.find("seconds") != 0) {
+            // dropped data never leaves partial lines behind
+            EXPECT_EQ(expected_line, line);
+            ++num_line;
+        }
+    }
+    EXPECT_EQ((num_update - num_line) * (expected_line.size() + 1), tracer.num_byte_drop());
+    // far less than the 128 MiB held before dropping
+    EXPECT_EQ(0u, tracer.num_byte_drop());
+    EXPECT_EQ(num_update, num_line);
+}
+
 /// @todo This is shared with ReporterTest; can be put in common file
 void check_trace(std::istream &expected, std::istream &result)
 {
@@ -41,9 +41,12 @@
 #include "geopm_test.hpp"
 
 using geopm::TreeCommLevel;
+using geopm::SequenceTreeCommLevel;
 using testing::Return;
 using testing::Invoke;
 using testing::SetArgPointee;
+using testing::DoAll;
+using testing::InSequence;
 using testing::_;
 
 class TreeCommLevelTest : public ::testing::Test
@@ -334,3 +337,298 @@ TEST_F(TreeCommLevelTest, receive_down_incomplete)
         EXPECT_TRUE(std::isnan(pp));
     }
 }
+
+TEST_F(TreeCommLevelTest, send_up_threshold)
+{
+    m_level_rank_1->sample_threshold({{0.1, 0.0, 0}, {0.0, 1.0, 0}, {0.0, 0.0, 2}});
+    EXPECT_CALL(*m_comm_1, window_lock(_, _, _, _)).Times(4);
+    EXPECT_CALL(*m_comm_1, window_unlock(_, _)).Times(4);
+    EXPECT_CALL(*m_comm_1, window_put(_, sizeof(double), _, _, _)).Times(4); // ready flag
+    EXPECT_CALL(*m_comm_1, window_put(_, 3 * sizeof(double), _, _, _)).Times(2); // sample message
+
+    // first sample is always sent
+    m_level_rank_1->send_up({10.0, 10.0, 10.0});
+    // within thresholds: only the ready flag is sent
+    m_level_rank_1->send_up({10.5, 10.5, 10.0});
+    EXPECT_EQ(2 * sizeof(double) + 3 * sizeof(double), m_level_rank_1->overhead_send());
+    m_level_rank_1->send_up({10.5, 10.5, 10.0});
+    EXPECT_EQ(3 * sizeof(double) + 3 * sizeof(double), m_level_rank_1->overhead_send());
+    // held back twice, reached max stale of the last value
+    m_level_rank_1->send_up({10.0, 10.0, 10.0});
+    EXPECT_EQ(4 * sizeof(double) + 6 * sizeof(double), m_level_rank_1->overhead_send());
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_1->sample_threshold({{0.1, 0.0, 0}}),
+                               GEOPM_ERROR_INVALID, "threshold vector is not sized correctly");
+}
+
+class SequenceTreeCommLevelTest : public ::testing::Test
+{
+    protected:
+        void SetUp();
+        void TearDown();
+        int m_num_up = 3;
+        int m_num_down = 2;
+        int m_num_rank = 2;
+        size_t m_sample_slot = sizeof(uint64_t) + 2 * sizeof(double) * m_num_up;
+        size_t m_policy_slot = sizeof(uint64_t) + 2 * sizeof(double) * m_num_down;
+        std::shared_ptr<MockComm> m_comm_0;
+        std::shared_ptr<MockComm> m_comm_1;
+        std::shared_ptr<SequenceTreeCommLevel> m_level_rank_0;
+        std::shared_ptr<SequenceTreeCommLevel> m_level_rank_1;
+        std::vector<char> m_sample_mem;
+        std::vector<char> m_policy_mem_0;
+        std::vector<char> m_policy_mem_1;
+};
+
+void SequenceTreeCommLevelTest::SetUp()
+{
+    // Both ranks share a node: the mailboxes are plain memory that
+    // each mock hands out from window_create_shared().
+    m_sample_mem.resize(m_num_rank * m_sample_slot, 'x');
+    m_policy_mem_0.resize(m_policy_slot, 'x');
+    m_policy_mem_1.resize(m_policy_slot, 'x');
+    m_comm_0 = std::make_shared<MockComm>();
+    m_comm_1 = std::make_shared<MockComm>();
+
+    EXPECT_CALL(*m_comm_0, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*m_comm_1, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*m_comm_0, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*m_comm_1, rank()).WillOnce(Return(1));
+    EXPECT_CALL(*m_comm_0, is_node_local()).WillOnce(Return(true));
+    EXPECT_CALL(*m_comm_1, is_node_local()).WillOnce(Return(true));
+
+    EXPECT_CALL(*m_comm_0, window_create_shared(m_sample_mem.size(), _))
+        .WillOnce(DoAll(SetArgPointee<1>(m_sample_mem.data()), Return(11)));
+    EXPECT_CALL(*m_comm_0, window_shared_query(11, 0))
+        .WillOnce(Return(m_sample_mem.data()));
+    EXPECT_CALL(*m_comm_0, window_create_shared(m_policy_slot, _))
+        .WillOnce(DoAll(SetArgPointee<1>(m_policy_mem_0.data()), Return(12)));
+    EXPECT_CALL(*m_comm_0, window_shared_query(12, 0))
+        .WillOnce(Return(m_policy_mem_0.data()));
+    EXPECT_CALL(*m_comm_0, window_shared_query(12, 1))
+        .WillOnce(Return(m_policy_mem_1.data()));
+
+    EXPECT_CALL(*m_comm_1, window_create_shared(0, _))
+        .WillOnce(DoAll(SetArgPointee<1>(nullptr), Return(21)));
+    EXPECT_CALL(*m_comm_1, window_shared_query(21, 0))
+        .WillOnce(Return(m_sample_mem.data()));
+    EXPECT_CALL(*m_comm_1, window_create_shared(m_policy_slot, _))
+        .WillOnce(DoAll(SetArgPointee<1>(m_policy_mem_1.data()), Return(22)));
+
+    EXPECT_CALL(*m_comm_0, barrier());
+    EXPECT_CALL(*m_comm_1, barrier());
+    EXPECT_CALL(*m_comm_0, window_lock_all(11));
+    EXPECT_CALL(*m_comm_0, window_lock_all(12));
+    EXPECT_CALL(*m_comm_1, window_lock_all(21));
+    EXPECT_CALL(*m_comm_1, window_lock_all(22));
+    for (size_t window : {11, 12}) {
+        EXPECT_CALL(*m_comm_0, window_is_unified(window)).WillOnce(Return(true));
+    }
+    for (size_t window : {21, 22}) {
+        EXPECT_CALL(*m_comm_1, window_is_unified(window)).WillOnce(Return(true));
+    }
+    // unified windows are read without synchronization
+    EXPECT_CALL(*m_comm_0, window_sync(_)).Times(0);
+    EXPECT_CALL(*m_comm_1, window_sync(_)).Times(0);
+
+    m_level_rank_0 = std::make_shared<SequenceTreeCommLevel>(m_comm_0, m_num_up, m_num_down);
+    m_level_rank_1 = std::make_shared<SequenceTreeCommLevel>(m_comm_1, m_num_up, m_num_down);
+}
+
+void SequenceTreeCommLevelTest::TearDown()
+{
+    EXPECT_CALL(*m_comm_0, barrier());
+    EXPECT_CALL(*m_comm_1, barrier());
+    EXPECT_CALL(*m_comm_0, window_unlock_all(_)).Times(2);
+    EXPECT_CALL(*m_comm_1, window_unlock_all(_)).Times(2);
+    EXPECT_CALL(*m_comm_0, window_destroy(_)).Times(2);
+    EXPECT_CALL(*m_comm_1, window_destroy(_)).Times(2);
+    // shared windows own their memory
+    EXPECT_CALL(*m_comm_0, free_mem(_)).Times(0);
+    EXPECT_CALL(*m_comm_1, free_mem(_)).Times(0);
+    m_level_rank_0.reset();
+    m_level_rank_1.reset();
+}
+
+TEST_F(SequenceTreeCommLevelTest, send_receive_up)
+{
+    EXPECT_CALL(*m_comm_0, window_put(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*m_comm_1, window_put(_, _, _, _, _)).Times(0);
+    std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, NAN));
+
+    // nothing sent yet
+    EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
+    m_level_rank_1->send_up({1.1, 2.2, 3.3});
+    // root sample still missing
+    EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
+    EXPECT_TRUE(std::isnan(sample_out[1][0]));
+    m_level_rank_0->send_up({4.4, 5.5, 6.6});
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    std::vector<std::vector<double> > expect {{4.4, 5.5, 6.6}, {1.1, 2.2, 3.3}};
+    EXPECT_EQ(expect, sample_out);
+    // samples are only consumed once
+    EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
+
+    // second message goes to the other buffer, third reuses the first
+    m_level_rank_1->send_up({7.7, 8.8, 9.9});
+    m_level_rank_1->send_up({10.1, 11.1, 12.1});
+    m_level_rank_0->send_up({13.1, 14.1, 15.1});
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    expect = {{13.1, 14.1, 15.1}, {10.1, 11.1, 12.1}};
+    EXPECT_EQ(expect, sample_out);
+
+    EXPECT_EQ(0u, m_level_rank_0->overhead_send());
+    EXPECT_EQ(3 * (sizeof(uint64_t) + m_num_up * sizeof(double)), m_level_rank_1->overhead_send());
+
+    // NaN samples are received but not complete
+    m_level_rank_0->send_up({NAN, 1.0, 1.0});
+    m_level_rank_1->send_up({1.0, 1.0, 1.0});
+    EXPECT_FALSE(m_level_rank_0->receive_up(sample_out));
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_1->send_up({1.0}),
+                               GEOPM_ERROR_INVALID, "sample vector is not sized correctly");
+    sample_out.resize(1);
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_0->receive_up(sample_out),
+                               GEOPM_ERROR_INVALID, "sample vector is not sized correctly");
+}
+
+TEST_F(SequenceTreeCommLevelTest, send_receive_down)
+{
+    EXPECT_CALL(*m_comm_0, window_put(_, _, _, _, _)).Times(0);
+    std::vector<double> policy_out;
+    EXPECT_FALSE(m_level_rank_0->receive_down(policy_out));
+    EXPECT_FALSE(m_level_rank_1->receive_down(policy_out));
+
+    std::vector<std::vector<double> > policy {{2.2, 3.3}, {2.9, 3.9}};
+    m_level_rank_0->send_down(policy);
+    size_t msg_size = sizeof(uint64_t) + m_num_down * sizeof(double);
+    EXPECT_EQ(msg_size, m_level_rank_0->overhead_send());
+    EXPECT_TRUE(m_level_rank_0->receive_down(policy_out));
+    EXPECT_EQ(policy[0], policy_out);
+    EXPECT_TRUE(m_level_rank_1->receive_down(policy_out));
+    EXPECT_EQ(policy[1], policy_out);
+    // latest policy remains available
+    EXPECT_TRUE(m_level_rank_1->receive_down(policy_out));
+    EXPECT_EQ(policy[1], policy_out);
+
+    // unchanged policy is not resent
+    m_level_rank_0->send_down(policy);
+    EXPECT_EQ(msg_size, m_level_rank_0->overhead_send());
+    policy[1] = {4.4, 5.5};
+    m_level_rank_0->send_down(policy);
+    EXPECT_EQ(2 * msg_size, m_level_rank_0->overhead_send());
+    EXPECT_TRUE(m_level_rank_1->receive_down(policy_out));
+    EXPECT_EQ(policy[1], policy_out);
+
+    policy = {{7.7, 6.6}};
+    GEOPM_EXPECT_THROW_MESSAGE(m_level_rank_0->send_down(policy),
+                               GEOPM_ERROR_INVALID, "policy vector is not sized correctly");
+}
+
+TEST_F(SequenceTreeCommLevelTest, remote_send)
+{
+    // Ranks on different nodes use puts within a single epoch
+    auto comm = std::make_shared<MockComm>();
+    std::vector<char> policy_mem(m_policy_slot);
+    EXPECT_CALL(*comm, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm, rank()).WillOnce(Return(1));
+    EXPECT_CALL(*comm, is_node_local()).WillOnce(Return(false));
+    EXPECT_CALL(*comm, window_create(0, NULL)).WillOnce(Return(31));
+    EXPECT_CALL(*comm, alloc_mem(m_policy_slot, _))
+        .WillOnce(SetArgPointee<1>(policy_mem.data()));
+    EXPECT_CALL(*comm, window_create(m_policy_slot, policy_mem.data())).WillOnce(Return(32));
+    EXPECT_CALL(*comm, window_lock_all(31));
+    EXPECT_CALL(*comm, window_lock_all(32));
+    EXPECT_CALL(*comm, window_lock(_, _, _, _)).Times(0);
+    EXPECT_CALL(*comm, window_is_unified(_)).WillRepeatedly(Return(true));
+    {
+        SequenceTreeCommLevel level(comm, m_num_up, m_num_down);
+        size_t msg_size = m_num_up * sizeof(double);
+        {
+            InSequence seq;
+            // first message lands in the second buffer of the slot
+            // for rank 1; every put completes at the target before
+            // the next one is issued
+            EXPECT_CALL(*comm, window_put(_, msg_size, 0, m_sample_slot + sizeof(uint64_t) + msg_size, 31));
+            EXPECT_CALL(*comm, window_flush(31, 0));
+            EXPECT_CALL(*comm, window_put(_, sizeof(uint64_t), 0, m_sample_slot, 31));
+            EXPECT_CALL(*comm, window_flush(31, 0));
+            EXPECT_CALL(*comm, window_put(_, msg_size, 0, m_sample_slot + sizeof(uint64_t), 31));
+            EXPECT_CALL(*comm, window_flush(31, 0));
+            EXPECT_CALL(*comm, window_put(_, sizeof(uint64_t), 0, m_sample_slot, 31));
+            EXPECT_CALL(*comm, window_flush(31, 0));
+        }
+        EXPECT_CALL(*comm, window_flush_local(_, _)).Times(0);
+        level.send_up({1.1, 2.2, 3.3});
+        level.send_up({4.4, 5.5, 6.6});
+        EXPECT_EQ(2 * (sizeof(uint64_t) + msg_size), level.overhead_send());
+
+        EXPECT_CALL(*comm, barrier());
+        EXPECT_CALL(*comm, window_unlock_all(31));
+        EXPECT_CALL(*comm, window_unlock_all(32));
+        EXPECT_CALL(*comm, window_destroy(_)).Times(2);
+        EXPECT_CALL(*comm, free_mem(policy_mem.data()));
+    }
+}
+
+TEST_F(SequenceTreeCommLevelTest, remote_receive_separate)
+{
+    // Root of a level spread over nodes whose windows use the
+    // separate memory model must synchronize before reading
+    auto comm = std::make_shared<MockComm>();
+    std::vector<char> sample_mem(m_num_rank * m_sample_slot);
+    std::vector<char> policy_mem(m_policy_slot);
+    EXPECT_CALL(*comm, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*comm, is_node_local()).WillOnce(Return(false));
+    EXPECT_CALL(*comm, alloc_mem(sample_mem.size(), _))
+        .WillOnce(SetArgPointee<1>(sample_mem.data()));
+    EXPECT_CALL(*comm, window_create(sample_mem.size(), sample_mem.data())).WillOnce(Return(41));
+    EXPECT_CALL(*comm, alloc_mem(m_policy_slot, _))
+        .WillOnce(SetArgPointee<1>(policy_mem.data()));
+    EXPECT_CALL(*comm, window_create(0, NULL)).WillOnce(Return(42));
+    EXPECT_CALL(*comm, window_lock_all(41));
+    EXPECT_CALL(*comm, window_lock_all(42));
+    EXPECT_CALL(*comm, window_is_unified(41)).WillOnce(Return(false));
+    EXPECT_CALL(*comm, window_is_unified(42)).WillOnce(Return(false));
+    {
+        SequenceTreeCommLevel level(comm, m_num_up, m_num_down);
+        std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, NAN));
+        std::vector<double> policy_out;
+        EXPECT_CALL(*comm, window_sync(41));
+        EXPECT_FALSE(level.receive_up(sample_out));
+        EXPECT_CALL(*comm, window_sync(42));
+        EXPECT_FALSE(level.receive_down(policy_out));
+
+        EXPECT_CALL(*comm, barrier());
+        EXPECT_CALL(*comm, window_unlock_all(_)).Times(2);
+        EXPECT_CALL(*comm, window_destroy(_)).Times(2);
+        EXPECT_CALL(*comm, free_mem(_)).Times(2);
+    }
+}
+
+TEST_F(SequenceTreeCommLevelTest, send_up_threshold)
+{
+    m_level_rank_1->sample_threshold({{0.0, 1.0, 0}, {0.0, 1.0, 0}, {0.0, 1.0, 0}});
+    std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, NAN));
+    m_level_rank_0->send_up({4.4, 5.5, 6.6});
+    m_level_rank_1->send_up({1.1, 2.2, 3.3});
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    std::vector<std::vector<double> > expect {{4.4, 5.5, 6.6}, {1.1, 2.2, 3.3}};
+    EXPECT_EQ(expect, sample_out);
+
+    // held back sample still completes, the last values sent are used
+    m_level_rank_0->send_up({4.5, 5.5, 6.6});
+    m_level_rank_1->send_up({1.2, 2.2, 3.3});
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    expect = {{4.5, 5.5, 6.6}, {1.1, 2.2, 3.3}};
+    EXPECT_EQ(expect, sample_out);
+    EXPECT_EQ(2 * sizeof(uint64_t) + m_num_up * sizeof(double), m_level_rank_1->overhead_send());
+
+    // changed sample goes to the buffer not holding the cached one
+    m_level_rank_0->send_up({4.6, 5.5, 6.6});
+    m_level_rank_1->send_up({3.3, 2.2, 3.3});
+    EXPECT_TRUE(m_level_rank_0->receive_up(sample_out));
+    expect = {{4.6, 5.5, 6.6}, {3.3, 2.2, 3.3}};
+    EXPECT_EQ(expect, sample_out);
+}
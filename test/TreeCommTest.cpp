@@ -35,6 +35,8 @@
 #include <utility>
 #include <algorithm>
 #include <numeric>
+#include <fstream>
+#include <cstdio>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -48,10 +50,12 @@
 
 using geopm::ITreeCommLevel;
 using geopm::TreeComm;
+using geopm::ITreeComm;
 using testing::_;
 using testing::Return;
 using testing::DoAll;
 using testing::SetArgReferee;
+using testing::Invoke;
 
 class TreeCommTest : public ::testing::Test
 {
@@ -206,3 +210,89 @@ TEST_F(TreeCommTest, overhead_send)
 
     EXPECT_EQ(expected_overhead, m_tree_comm->overhead_send());
 }
+
+TEST_F(TreeCommTest, topology_fan_out)
+{
+    // 8 switches with 8 nodes each
+    std::vector<int> group(64);
+    for (size_t idx = 0; idx < group.size(); ++idx) {
+        group[idx] = idx / 8;
+    }
+    std::vector<int> expect {8, 8};
+    EXPECT_EQ(expect, ITreeComm::fan_out(m_mock_comm, group));
+
+    // 12 switches with 6 nodes each, listed out of order
+    group.resize(72);
+    for (size_t idx = 0; idx < group.size(); ++idx) {
+        group[idx] = idx % 12;
+    }
+    expect = {12, 6};
+    EXPECT_EQ(expect, ITreeComm::fan_out(m_mock_comm, group));
+
+    // Switches of uneven size: 4 + 4 + 8 nodes, every leaf of 4
+    // stays on one switch but a leaf of 8 or 16 would not
+    group = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2};
+    expect = {4, 4};
+    EXPECT_EQ(expect, ITreeComm::fan_out(m_mock_comm, group));
+
+    // No leaf size divides a prime node count evenly
+    group.assign(17, 0);
+    EXPECT_CALL(*m_mock_comm, dimension_create(17, _))
+        .WillOnce(SetArgReferee<1>(std::vector<int>{17, 1}));
+    expect = {17};
+    EXPECT_EQ(expect, ITreeComm::fan_out(m_mock_comm, group));
+
+    group = {0};
+    EXPECT_EQ(std::vector<int>{}, ITreeComm::fan_out(m_mock_comm, group));
+}
+
+TEST_F(TreeCommTest, switch_group)
+{
+    std::string path("TreeCommTest.switch_group.topo");
+    std::ofstream topo(path);
+    topo << "# host switch\n"
+         << "node0 sw-a\n"
+         << "node1 sw-a\n"
+         << "\n"
+         << "node2 sw-b\n"
+         << "node3 sw-b\n";
+    topo.close();
+
+    // node2 is on the second switch listed; the other simulated
+    // ranks report sw-b, sw-a and a host missing from the file.
+    std::vector<int> gathered {1, 0, 1, 2};
+    EXPECT_CALL(*m_mock_comm, num_rank()).WillOnce(Return(gathered.size()));
+    EXPECT_CALL(*m_mock_comm, gather(_, sizeof(int), _, sizeof(int), 0))
+        .WillOnce(Invoke([gathered] (const void *send_buf, size_t send_size, void *recv_buf,
+                                     size_t recv_size, int root)
+                         {
+                             EXPECT_EQ(1, *(const int *)send_buf);
+                             memcpy(recv_buf, gathered.data(), gathered.size() * sizeof(int));
+                         }));
+    EXPECT_CALL(*m_mock_comm, broadcast(_, gathered.size() * sizeof(int), 0));
+    // rank zero's switch is renumbered to zero to stay at the root
+    std::vector<int> expect {0, 1, 0, 2};
+    EXPECT_EQ(expect, ITreeComm::switch_group(m_mock_comm, path, "node2"));
+
+    EXPECT_CALL(*m_mock_comm, gather(_, _, _, _, _)).Times(0);
+    EXPECT_EQ(std::vector<int>{}, ITreeComm::switch_group(m_mock_comm, "", "node2"));
+
+    topo.open(path);
+    topo << "node0\n";
+    topo.close();
+    GEOPM_EXPECT_THROW_MESSAGE(ITreeComm::switch_group(m_mock_comm, path, "node0"),
+                               GEOPM_ERROR_FILE_PARSE, "no switch given for host node0");
+    std::remove(path.c_str());
+    GEOPM_EXPECT_THROW_MESSAGE(ITreeComm::switch_group(m_mock_comm, path, "node0"),
+                               GEOPM_ERROR_FILE_PARSE, "unable to open topology file");
+}
+
+TEST_F(TreeCommTest, sample_threshold)
+{
+    root_setup();
+    std::vector<geopm::SampleFilter::m_threshold_s> threshold {{0.1, 0.0, 5}, {0.0, 1.0, 0}, {0.0, 0.0, 0}};
+    EXPECT_CALL(*(m_level_ptr[1]), sample_threshold(_));
+    m_tree_comm->sample_threshold(1, threshold);
+    GEOPM_EXPECT_THROW_MESSAGE(m_tree_comm->sample_threshold(-1, threshold),
+                               GEOPM_ERROR_LEVEL_RANGE, "TreeComm::sample_threshold()");
+}
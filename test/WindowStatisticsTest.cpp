@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "geopm_error.h"
+#include "WindowStatistics.hpp"
+#include "PlatformIO.hpp"
+#include "geopm_test.hpp"
+
+using geopm::WindowStatistics;
+using geopm::IPlatformIO;
+
+TEST(WindowStatisticsTest, empty)
+{
+    WindowStatistics stats(4);
+    EXPECT_EQ(0, stats.size());
+    EXPECT_EQ(4, stats.capacity());
+    EXPECT_TRUE(std::isnan(stats.sum()));
+    EXPECT_TRUE(std::isnan(stats.mean()));
+    EXPECT_TRUE(std::isnan(stats.variance()));
+    EXPECT_TRUE(std::isnan(stats.median()));
+    EXPECT_TRUE(std::isnan(stats.percentile(90.0)));
+    EXPECT_TRUE(std::isnan(stats.min()));
+    EXPECT_TRUE(std::isnan(stats.max()));
+    GEOPM_EXPECT_THROW_MESSAGE(stats.percentile(101.0), GEOPM_ERROR_INVALID, "between 0 and 100");
+    WindowStatistics zero;
+    GEOPM_EXPECT_THROW_MESSAGE(zero.insert(1.0), GEOPM_ERROR_RUNTIME, "0 size");
+}
+
+TEST(WindowStatisticsTest, window)
+{
+    WindowStatistics stats(4);
+    for (double value : {5.0, 1.0, 4.0, 2.0, 3.0}) {
+        stats.insert(value);
+    }
+    // 5.0 has left the window
+    std::vector<double> expect {1.0, 4.0, 2.0, 3.0};
+    EXPECT_EQ(expect, stats.make_vector());
+    EXPECT_EQ(1.0, stats.value(0));
+    EXPECT_EQ(10.0, stats.sum());
+    EXPECT_EQ(2.5, stats.mean());
+    EXPECT_EQ(2.5, stats.median());
+    EXPECT_EQ(1.0, stats.min());
+    EXPECT_EQ(4.0, stats.max());
+    EXPECT_EQ(1.0, stats.percentile(0.0));
+    EXPECT_EQ(4.0, stats.percentile(100.0));
+    EXPECT_DOUBLE_EQ(3.25, stats.percentile(75.0));
+    EXPECT_DOUBLE_EQ(5.0 / 3.0, stats.variance());
+
+    stats.set_capacity(2);
+    EXPECT_EQ(2, stats.size());
+    EXPECT_EQ(stats.make_vector(), std::vector<double>({stats.value(0), stats.value(1)}));
+    EXPECT_EQ(stats.value(0) + stats.value(1), stats.sum());
+    stats.clear();
+    EXPECT_EQ(0, stats.size());
+    EXPECT_TRUE(std::isnan(stats.median()));
+}
+
+TEST(WindowStatisticsTest, nan)
+{
+    // NAN is kept in the window but skipped by every statistic
+    WindowStatistics stats(3);
+    stats.insert(1.0);
+    stats.insert(NAN);
+    stats.insert(3.0);
+    EXPECT_EQ(3, stats.size());
+    EXPECT_TRUE(std::isnan(stats.value(1)));
+    EXPECT_EQ(4.0, stats.sum());
+    EXPECT_EQ(2.0, stats.mean());
+    EXPECT_EQ(2.0, stats.variance());
+    EXPECT_EQ(2.0, stats.median());
+    EXPECT_EQ(3.0, stats.percentile(100.0));
+    EXPECT_EQ(1.0, stats.min());
+    EXPECT_EQ(3.0, stats.max());
+    stats.insert(5.0);
+    stats.insert(7.0);
+    EXPECT_EQ(5.0, stats.mean());
+    EXPECT_EQ(5.0, stats.median());
+
+    // a window of only NAN has no statistics
+    stats.insert(NAN);
+    stats.insert(NAN);
+    EXPECT_EQ(7.0, stats.mean());
+    EXPECT_EQ(0.0, stats.variance());
+    stats.insert(NAN);
+    EXPECT_EQ(3, stats.size());
+    EXPECT_TRUE(std::isnan(stats.sum()));
+    EXPECT_TRUE(std::isnan(stats.mean()));
+    EXPECT_TRUE(std::isnan(stats.variance()));
+    EXPECT_TRUE(std::isnan(stats.median()));
+    EXPECT_TRUE(std::isnan(stats.percentile(50.0)));
+    EXPECT_TRUE(std::isnan(stats.min()));
+    EXPECT_TRUE(std::isnan(stats.max()));
+
+    // shrinking the window keeps the same policy
+    WindowStatistics shrink(4);
+    for (double value : std::vector<double>({NAN, 2.0, NAN, 4.0})) {
+        shrink.insert(value);
+    }
+    shrink.set_capacity(3);
+    EXPECT_EQ(6.0, shrink.sum());
+    EXPECT_EQ(3.0, shrink.median());
+}
+
+TEST(WindowStatisticsTest, match_agg)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(100.0, 200.0);
+    for (unsigned int window : {1, 2, 7, 16, 64}) {
+        WindowStatistics stats(window);
+        for (int idx = 0; idx < 1000; ++idx) {
+            // repeat values so that duplicates are removed from the
+            // sorted window
+            double value = idx % 3 ? dist(gen) : 150.0;
+            stats.insert(value);
+            std::vector<double> contents = stats.make_vector();
+            EXPECT_NEAR(IPlatformIO::agg_sum(contents), stats.sum(), 1e-9);
+            EXPECT_NEAR(IPlatformIO::agg_average(contents), stats.mean(), 1e-9);
+            EXPECT_EQ(IPlatformIO::agg_median(contents), stats.median());
+            EXPECT_EQ(IPlatformIO::agg_min(contents), stats.min());
+            EXPECT_EQ(IPlatformIO::agg_max(contents), stats.max());
+            EXPECT_NEAR(IPlatformIO::agg_stddev(contents), stats.stddev(), 1e-6);
+        }
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/// Compares the serial and threaded fallback paths of
+/// MSRIO::read_batch() using a file backed fake /dev/cpu tree.
+///
+/// usage: geopm_msrio_bench [NUM_CPU [NUM_MSR [NUM_ITER [NUM_WORKER]]]]
+
+#include <unistd.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+
+#include "geopm_time.h"
+#include "Exception.hpp"
+#include "MSRIO.hpp"
+
+class BenchMSRIO : public geopm::MSRIO
+{
+    public:
+        BenchMSRIO(const std::vector<std::string> &dev_path, int num_worker)
+            : MSRIO(dev_path.size(), num_worker)
+            , m_dev_path(dev_path)
+        {
+
+        }
+        virtual ~BenchMSRIO() = default;
+    private:
+        void msr_path(int cpu_idx,
+                      bool is_fallback,
+                      std::string &path) override
+        {
+            path = m_dev_path[cpu_idx];
+        }
+        void msr_batch_path(std::string &path) override
+        {
+            // Force the pread() fallback
+            path = "/dev/null/msr_batch";
+        }
+        const std::vector<std::string> &m_dev_path;
+};
+
+static double bench(const std::vector<std::string> &dev_path, int num_worker,
+                    int num_msr, int num_iter)
+{
+    BenchMSRIO msrio(dev_path, num_worker);
+    std::vector<int> read_cpu_idx;
+    std::vector<uint64_t> read_offset;
+    for (size_t cpu_idx = 0; cpu_idx < dev_path.size(); ++cpu_idx) {
+        for (int msr_idx = 0; msr_idx < num_msr; ++msr_idx) {
+            read_cpu_idx.push_back(cpu_idx);
+            read_offset.push_back(msr_idx * sizeof(uint64_t));
+        }
+    }
+    msrio.config_batch(read_cpu_idx, read_offset, {}, {}, {});
+    std::vector<uint64_t> raw_value;
+    // First call opens the files and starts any worker threads
+    msrio.read_batch(raw_value);
+    struct geopm_time_s begin;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iter; ++iter) {
+        msrio.read_batch(raw_value);
+    }
+    return geopm_time_since(&begin) / num_iter;
+}
+
+int main(int argc, char **argv)
+{
+    int num_cpu = argc > 1 ? atoi(argv[1]) : 272;
+    int num_msr = argc > 2 ? atoi(argv[2]) : 4;
+    int num_iter = argc > 3 ? atoi(argv[3]) : 1000;
+    int num_worker = argc > 4 ? atoi(argv[4]) : 3;
+    if (num_cpu <= 0 || num_msr <= 0 || num_msr > 512 || num_iter <= 0 || num_worker < 0) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_CPU [NUM_MSR [NUM_ITER [NUM_WORKER]]]]" << std::endl;
+        return -1;
+    }
+
+    int err = 0;
+    std::vector<std::string> dev_path;
+    for (int cpu_idx = 0; !err && cpu_idx < num_cpu; ++cpu_idx) {
+        char tmp_path[NAME_MAX] = "/tmp/geopm_msrio_bench_XXXXXX";
+        int fd = mkstemp(tmp_path);
+        if (fd == -1) {
+            err = -1;
+            break;
+        }
+        dev_path.push_back(tmp_path);
+        err = ftruncate(fd, 4096);
+        close(fd);
+    }
+    if (!err) {
+        try {
+            double serial = bench(dev_path, 0, num_msr, num_iter);
+            double threaded = bench(dev_path, num_worker, num_msr, num_iter);
+            std::cout << "CPUs: " << num_cpu << " MSRs per CPU: " << num_msr
+                      << " iterations: " << num_iter << std::endl;
+            std::cout << std::setprecision(3) << std::scientific
+                      << "serial read_batch (s):              " << serial << std::endl
+                      << "read_batch with " << num_worker << " workers (s):    " << threaded << std::endl;
+        }
+        catch (const std::exception &ex) {
+            std::cerr << "Error: " << ex.what() << std::endl;
+            err = -1;
+        }
+    }
+    else {
+        std::cerr << "Error: unable to create fake MSR device files" << std::endl;
+    }
+    for (auto &path : dev_path) {
+        unlink(path.c_str());
+    }
+    return err;
+}
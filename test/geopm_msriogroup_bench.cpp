@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/// Measures the time and resident memory taken to construct an
+/// MSRIOGroup, the cost of the first read of a signal in every
+/// domain, and the cost of a batch read and decode of every MSR field.
+/// MSR access goes to a stub for these, so only the bookkeeping is
+/// measured.  The cost of save_control() plus restore_control() is
+/// measured against a file backed fake /dev/cpu tree, both for every
+/// control and for only the pushed controls, and both with controls
+/// left unchanged, where the restore skips every write, and with
+/// controls modified before the restore.  The files do not support
+/// the msr-safe batch ioctl, so this times the pread() and pwrite()
+/// fallback.
+///
+/// usage: geopm_msriogroup_bench [NUM_CPU [NUM_ITER [CPUID]]]
+
+#include <unistd.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm_time.h"
+#include "Exception.hpp"
+#include "MSRIO.hpp"
+#include "MSRIOGroup.hpp"
+#include "PlatformTopo.hpp"
+
+class BenchMSRIO : public geopm::IMSRIO
+{
+    public:
+        BenchMSRIO() = default;
+        virtual ~BenchMSRIO() = default;
+        uint64_t read_msr(int cpu_idx, uint64_t offset) override
+        {
+            return 0;
+        }
+        void write_msr(int cpu_idx, uint64_t offset, uint64_t raw_value, uint64_t write_mask) override
+        {
+
+        }
+        void read_msr_batch(const std::vector<int> &cpu_idx,
+                            const std::vector<uint64_t> &offset,
+                            std::vector<uint64_t> &raw_value) override
+        {
+            raw_value.assign(cpu_idx.size(), 0);
+        }
+        void write_msr_batch(const std::vector<int> &cpu_idx,
+                             const std::vector<uint64_t> &offset,
+                             const std::vector<uint64_t> &raw_value,
+                             const std::vector<uint64_t> &write_mask) override
+        {
+
+        }
+        void config_batch(const std::vector<int> &read_cpu_idx,
+                          const std::vector<uint64_t> &read_offset,
+                          const std::vector<int> &write_cpu_idx,
+                          const std::vector<uint64_t> &write_offset,
+                          const std::vector<uint64_t> &write_mask) override
+        {
+
+        }
+        void read_batch(std::vector<uint64_t> &raw_value) override
+        {
+
+        }
+        void write_batch(const std::vector<uint64_t> &raw_value) override
+        {
+
+        }
+};
+
+/// MSRIO backed by regular files in place of /dev/cpu/*/msr.
+class FileMSRIO : public geopm::MSRIO
+{
+    public:
+        FileMSRIO(const std::vector<std::string> &dev_path)
+            : MSRIO(dev_path.size())
+            , m_dev_path(dev_path)
+        {
+
+        }
+        virtual ~FileMSRIO() = default;
+    private:
+        void msr_path(int cpu_idx,
+                      bool is_fallback,
+                      std::string &path) override
+        {
+            path = m_dev_path[cpu_idx];
+        }
+        void msr_batch_path(std::string &path) override
+        {
+            // Force the pread() fallback
+            path = "/dev/null/msr_batch";
+        }
+        const std::vector<std::string> &m_dev_path;
+};
+
+/// Single package topology with one CPU per core.
+class BenchTopo : public geopm::IPlatformTopo
+{
+    public:
+        BenchTopo(int num_cpu)
+            : m_num_cpu(num_cpu)
+        {
+
+        }
+        virtual ~BenchTopo() = default;
+        int num_domain(int domain_type) const override
+        {
+            return domain_type == M_DOMAIN_CPU || domain_type == M_DOMAIN_CORE ? m_num_cpu : 1;
+        }
+        void domain_cpus(int domain_type, int domain_idx, std::set<int> &cpu_idx) const override
+        {
+            cpu_idx.clear();
+            if (domain_type == M_DOMAIN_CPU || domain_type == M_DOMAIN_CORE) {
+                cpu_idx.insert(domain_idx);
+            }
+            else {
+                for (int idx = 0; idx < m_num_cpu; ++idx) {
+                    cpu_idx.insert(idx);
+                }
+            }
+        }
+        int domain_idx(int domain_type, int cpu_idx) const override
+        {
+            return domain_type == M_DOMAIN_CPU || domain_type == M_DOMAIN_CORE ? cpu_idx : 0;
+        }
+        int define_cpu_group(const std::vector<int> &cpu_domain_idx) override
+        {
+            throw geopm::Exception("BenchTopo::define_cpu_group(): not implemented",
+                                   GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        bool is_domain_within(int inner_domain, int outer_domain) const override
+        {
+            return inner_domain == outer_domain || outer_domain == M_DOMAIN_BOARD ||
+                   outer_domain == M_DOMAIN_PACKAGE || inner_domain == M_DOMAIN_CPU;
+        }
+    private:
+        int m_num_cpu;
+};
+
+/// Average time for save_control() plus restore_control() on a new
+/// MSRIOGroup.  If is_scoped, FREQUENCY and POWER_PACKAGE are pushed
+/// in every domain and only those controls are saved.  If is_modify,
+/// FREQUENCY and POWER_PACKAGE are written in every domain between
+/// the save and the restore, outside of the timed region, so that
+/// the restore has MSRs to write back; otherwise every MSR already
+/// holds its saved value and the restore only reads.
+static double save_restore_time(geopm::IPlatformTopo &topo,
+                                const std::vector<std::string> &dev_path,
+                                int cpuid, bool is_scoped, bool is_modify,
+                                int num_iter)
+{
+    int num_cpu = dev_path.size();
+    double result = 0.0;
+    for (int iter = 0; iter < num_iter; ++iter) {
+        geopm::MSRIOGroup group(topo, std::unique_ptr<geopm::IMSRIO>(new FileMSRIO(dev_path)),
+                                cpuid, num_cpu, 0.0, is_scoped);
+        if (is_scoped) {
+            for (const auto &name : {"FREQUENCY", "POWER_PACKAGE"}) {
+                int domain_type = group.control_domain_type(name);
+                for (int domain_idx = 0; domain_idx < topo.num_domain(domain_type); ++domain_idx) {
+                    group.push_control(name, domain_type, domain_idx);
+                }
+            }
+        }
+        struct geopm_time_s begin;
+        geopm_time(&begin);
+        group.save_control();
+        result += geopm_time_since(&begin);
+        if (is_modify) {
+            // The fake MSRs start at zero so these settings differ
+            // from the saved values
+            for (const auto &setting : {std::make_pair("FREQUENCY", 1.3e9),
+                                        std::make_pair("POWER_PACKAGE", 200.0)}) {
+                int domain_type = group.control_domain_type(setting.first);
+                for (int domain_idx = 0; domain_idx < topo.num_domain(domain_type); ++domain_idx) {
+                    group.write_control(setting.first, domain_type, domain_idx, setting.second);
+                }
+            }
+        }
+        geopm_time(&begin);
+        group.restore_control();
+        result += geopm_time_since(&begin);
+    }
+    return result / num_iter;
+}
+
+/// Resident set size of this process in bytes.
+static long resident_bytes(void)
+{
+    long result = 0;
+    long size = 0;
+    long resident = 0;
+    FILE *fid = fopen("/proc/self/statm", "r");
+    if (fid) {
+        if (fscanf(fid, "%ld %ld", &size, &resident) == 2) {
+            result = resident * sysconf(_SC_PAGESIZE);
+        }
+        fclose(fid);
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int num_cpu = argc > 1 ? atoi(argv[1]) : 272;
+    int num_iter = argc > 2 ? atoi(argv[2]) : 20;
+    int cpuid = argc > 3 ? strtol(argv[3], NULL, 0) : geopm::MSRIOGroup::M_CPUID_KNL;
+    if (num_cpu <= 0 || num_iter <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_CPU [NUM_ITER [CPUID]]]" << std::endl;
+        return -1;
+    }
+
+    int err = 0;
+    try {
+        BenchTopo topo(num_cpu);
+        // Measure memory before the heap is reused by the timing loop
+        long rss_before = resident_bytes();
+        std::unique_ptr<geopm::MSRIOGroup> group(
+            new geopm::MSRIOGroup(topo, std::unique_ptr<geopm::IMSRIO>(new BenchMSRIO), cpuid, num_cpu));
+        long rss_construct = resident_bytes() - rss_before;
+
+        struct geopm_time_s begin;
+        geopm_time(&begin);
+        int domain_type = group->signal_domain_type("FREQUENCY");
+        for (int domain_idx = 0; domain_idx < topo.num_domain(domain_type); ++domain_idx) {
+            (void)group->read_signal("FREQUENCY", domain_type, domain_idx);
+        }
+        double read_time = geopm_time_since(&begin);
+        long rss_read = resident_bytes() - rss_before;
+        group.reset();
+
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iter; ++iter) {
+            geopm::MSRIOGroup tmp_group(topo, std::unique_ptr<geopm::IMSRIO>(new BenchMSRIO), cpuid, num_cpu);
+        }
+        double construct_time = geopm_time_since(&begin) / num_iter;
+
+        // Push every MSR field signal in every domain and time the
+        // batch read plus the decode of all of them
+        group.reset(new geopm::MSRIOGroup(topo, std::unique_ptr<geopm::IMSRIO>(new BenchMSRIO), cpuid, num_cpu));
+        std::vector<int> signal_idx;
+        for (const auto &name : group->signal_names()) {
+            if (name.find("MSR::") == 0 && name.find(':', 5) != std::string::npos) {
+                int signal_domain = group->signal_domain_type(name);
+                for (int domain_idx = 0; domain_idx < topo.num_domain(signal_domain); ++domain_idx) {
+                    signal_idx.push_back(group->push_signal(name, signal_domain, domain_idx));
+                }
+            }
+        }
+        int num_batch = 50 * num_iter;
+        double total = 0.0;
+        group->read_batch();
+        geopm_time(&begin);
+        for (int batch = 0; batch < num_batch; ++batch) {
+            group->read_batch();
+            for (auto idx : signal_idx) {
+                total += group->sample(idx);
+            }
+        }
+        double batch_time = geopm_time_since(&begin) / num_batch;
+        group.reset();
+
+        std::vector<std::string> dev_path;
+        for (int cpu_idx = 0; cpu_idx < num_cpu; ++cpu_idx) {
+            char tmp_path[NAME_MAX] = "/tmp/geopm_msriogroup_bench_XXXXXX";
+            int fd = mkstemp(tmp_path);
+            if (fd == -1) {
+                err = -1;
+                break;
+            }
+            dev_path.push_back(tmp_path);
+            // Sparse file spanning every MSR offset in use
+            err = ftruncate(fd, 0x10000);
+            close(fd);
+            if (err) {
+                break;
+            }
+        }
+        double save_full_time = 0.0;
+        double save_scoped_time = 0.0;
+        double save_full_modify_time = 0.0;
+        double save_scoped_modify_time = 0.0;
+        if (!err) {
+            save_full_time = save_restore_time(topo, dev_path, cpuid, false, false, num_iter);
+            save_scoped_time = save_restore_time(topo, dev_path, cpuid, true, false, num_iter);
+            save_full_modify_time = save_restore_time(topo, dev_path, cpuid, false, true, num_iter);
+            save_scoped_modify_time = save_restore_time(topo, dev_path, cpuid, true, true, num_iter);
+        }
+        for (const auto &path : dev_path) {
+            unlink(path.c_str());
+        }
+        if (err) {
+            throw geopm::Exception("unable to create fake MSR device files",
+                                   GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+
+        std::cout << "CPUs: " << num_cpu << " CPUID: 0x" << std::hex << cpuid << std::dec
+                  << " iterations: " << num_iter << std::endl;
+        std::cout << std::setprecision(3) << std::scientific
+                  << "construction (s):                  " << construct_time << std::endl
+                  << "first FREQUENCY read, all (s):     " << read_time << std::endl
+                  << "read_batch and sample " << std::setw(6) << signal_idx.size()
+                  << " (s): " << batch_time << std::endl
+                  << "save and restore, all controls, unchanged (s): " << save_full_time << std::endl
+                  << "save and restore, pushed only, unchanged (s):  " << save_scoped_time << std::endl
+                  << "save and restore, all controls, modified (s):  " << save_full_modify_time << std::endl
+                  << "save and restore, pushed only, modified (s):   " << save_scoped_modify_time << std::endl;
+        std::cout << "RSS after construction (KiB):      " << rss_construct / 1024 << std::endl
+                  << "RSS after reads (KiB):             " << rss_read / 1024 << std::endl;
+        if (std::isnan(total)) {
+            std::cerr << "Warning: decoded signal is NAN" << std::endl;
+        }
+    }
+    catch (const std::exception &ex) {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        err = -1;
+    }
+    return err;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/// Measures the time for many processes waiting in the
+/// SharedMemoryUser constructor to attach once the segments they wait
+/// on are created, and the CPU time those processes use while
+/// waiting.  This models the application ranks on a node starting
+/// before the controller has created their shared memory.
+///
+/// usage: geopm_shm_rendezvous_bench [NUM_RANK [DELAY_SEC]]
+///
+/// NUM_RANK processes are forked (default 256) and the segments are
+/// created DELAY_SEC seconds later (default 1).
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "geopm_time.h"
+#include "SharedMemory.hpp"
+
+int main(int argc, char **argv)
+{
+    int num_rank = argc > 1 ? atoi(argv[1]) : 256;
+    double delay = argc > 2 ? atof(argv[2]) : 1.0;
+    if (num_rank <= 0 || delay < 0.0) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_RANK [DELAY_SEC]]" << std::endl;
+        return -1;
+    }
+    std::string key_base("/geopm-shm-rendezvous-bench-" + std::to_string(getpid()) + "-");
+
+    std::vector<pid_t> child(num_rank);
+    for (int rank = 0; rank < num_rank; ++rank) {
+        child[rank] = fork();
+        if (child[rank] == 0) {
+            int err = 0;
+            try {
+                geopm::SharedMemoryUser shmem_u(key_base + std::to_string(rank), 30);
+            }
+            catch (...) {
+                err = 1;
+            }
+            _exit(err);
+        }
+        else if (child[rank] < 0) {
+            std::cerr << "Error: fork() failed" << std::endl;
+            return -1;
+        }
+    }
+
+    usleep(delay * 1E6);
+    struct geopm_time_s begin;
+    geopm_time(&begin);
+    std::vector<std::unique_ptr<geopm::SharedMemory> > shmem;
+    for (int rank = 0; rank < num_rank; ++rank) {
+        shmem.emplace_back(new geopm::SharedMemory(key_base + std::to_string(rank), 4096));
+    }
+    int num_fail = 0;
+    for (auto pid : child) {
+        int status = 0;
+        (void)waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+            ++num_fail;
+        }
+    }
+    double attach_time = geopm_time_since(&begin);
+    shmem.clear();
+
+    struct rusage usage;
+    (void)getrusage(RUSAGE_CHILDREN, &usage);
+    double cpu_time = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                      (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1E-6;
+
+    std::cout << std::setw(6) << "ranks"
+              << std::setw(20) << "attach all (s)"
+              << std::setw(20) << "wait cpu/rank (s)" << std::endl;
+    std::cout << std::setw(6) << num_rank << std::setprecision(3) << std::scientific
+              << std::setw(20) << attach_time
+              << std::setw(20) << cpu_time / num_rank << std::endl;
+    if (num_fail) {
+        std::cerr << "Error: " << num_fail << " ranks failed to attach" << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015, 2016, 2017, 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY LOG OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/// Compares the per-sample cost of keeping the median of a sliding
+/// window with WindowStatistics against copying the window out of a
+/// CircularBuffer and calling IPlatformIO::agg_median() as
+/// PowerBalancer::runtime_sample() did.
+///
+/// usage: geopm_window_stats_bench [WINDOW [NUM_SAMPLE]]
+///
+/// When WINDOW is not given the benchmark is run for windows of 8,
+/// 64, 512 and 4096 samples.
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "geopm_time.h"
+#include "CircularBuffer.hpp"
+#include "WindowStatistics.hpp"
+#include "PlatformIO.hpp"
+
+int main(int argc, char **argv)
+{
+    std::vector<int> window_list {8, 64, 512, 4096};
+    if (argc > 1) {
+        window_list = {atoi(argv[1])};
+    }
+    int num_sample = argc > 2 ? atoi(argv[2]) : 100000;
+    if (window_list[0] <= 0 || num_sample <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [WINDOW [NUM_SAMPLE]]" << std::endl;
+        return -1;
+    }
+
+    std::vector<double> sample(num_sample);
+    unsigned int seed = 42;
+    for (auto &it : sample) {
+        it = 1.0 + (rand_r(&seed) % 100000) * 1E-6;
+    }
+
+    std::cout << "samples: " << num_sample << std::endl;
+    std::cout << std::setw(8) << "window"
+              << std::setw(22) << "copy + sort (s)"
+              << std::setw(22) << "WindowStatistics (s)" << std::endl;
+    for (auto window : window_list) {
+        geopm::CircularBuffer<double> buffer(window);
+        geopm::WindowStatistics stats(window);
+        double check_copy = 0.0;
+        double check_stats = 0.0;
+
+        struct geopm_time_s begin;
+        geopm_time(&begin);
+        for (auto it : sample) {
+            buffer.insert(it);
+            check_copy += geopm::IPlatformIO::agg_median(buffer.make_vector());
+        }
+        double copy_time = geopm_time_since(&begin) / num_sample;
+
+        geopm_time(&begin);
+        for (auto it : sample) {
+            stats.insert(it);
+            check_stats += stats.median();
+        }
+        double stats_time = geopm_time_since(&begin) / num_sample;
+
+        if (check_copy != check_stats) {
+            std::cerr << "Error: median results differ for window " << window << std::endl;
+            return -1;
+        }
+        std::cout << std::setw(8) << window << std::setprecision(3) << std::scientific
+                  << std::setw(22) << copy_time
+                  << std::setw(22) << stats_time << std::endl;
+    }
+    return 0;
+}